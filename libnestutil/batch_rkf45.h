@@ -0,0 +1,391 @@
+/*
+ *  batch_rkf45.h
+ *
+ *  This file is part of NEST.
+ *
+ *  Copyright (C) 2004 The NEST Initiative
+ *
+ *  NEST is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  NEST is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with NEST.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifndef BATCH_RKF45_H
+#define BATCH_RKF45_H
+
+// C++ includes:
+#include <algorithm>
+#include <cfloat>
+#include <cmath>
+#include <cstddef>
+
+/**
+ * Runge-Kutta-Fehlberg (4, 5) integrator with adaptive step size for a
+ * batch of independent ODE systems of the same dimension.
+ *
+ * The states of the systems are held in structure-of-arrays layout:
+ * element d of system i is y[ d * max_size + i ]. Each call of apply()
+ * advances every selected system by one step of its own size. Stepper,
+ * step size control and evolution perform the same operations as
+ * gsl_odeiv_step_rkf45, gsl_odeiv_control_yp_new and
+ * gsl_odeiv_evolve_apply, so that each system takes the same steps as
+ * when integrated on its own by GSL.
+ *
+ * The right-hand sides of all systems are evaluated in a single call of
+ * System::dynamics( y, f ), instead of one call through a function
+ * pointer per system and stage, and all stages are loops over the
+ * systems that the compiler can vectorize. The right-hand sides are
+ * evaluated for all max_size systems, also for those that wait while
+ * others repeat a step with a smaller step size; their results are
+ * discarded.
+ *
+ * The class has no constructor, so that value-initialization zeroes the
+ * work arrays.
+ *
+ * @tparam System    provides void dynamics( const double y[], double f[] )
+ *                   const, which computes the right-hand sides of all
+ *                   max_size systems in the layout above, and, for
+ *                   evolve(), void step_taken( size_t i )
+ * @tparam dim       number of state variables per system
+ * @tparam max_size  maximal number of systems
+ */
+template < typename System, size_t dim, size_t max_size >
+class BatchRKF45
+{
+public:
+  /**
+   * Set the absolute and relative error bounds of system i, as
+   * gsl_odeiv_control_yp_new( eps_abs, eps_rel ).
+   */
+  void set_tolerance( const size_t i, const double eps_abs, const double eps_rel );
+
+  /**
+   * Advance each system i < n with active[ i ] by one step, as
+   * gsl_odeiv_evolve_apply( ..., &t[ i ], t1, &h[ i ], y ) does.
+   * On return, t[ i ] is the time reached, at most t1, and h[ i ] the
+   * step size to try next. The states of the other systems are unchanged.
+   */
+  void apply( const System& sys,
+    const size_t n,
+    const bool active[],
+    double t[],
+    const double t1,
+    double h[],
+    double y[] );
+
+  /**
+   * Advance each system i < n from time 0 to t1 by repeated calls of
+   * apply(), as repeated calls of gsl_odeiv_evolve_apply() do. After
+   * each step of system i, sys.step_taken( i ) is called, which may
+   * modify the state y of the system, e.g. to reset it after a spike.
+   * On return, h[ i ] is the step size to try next.
+   */
+  void evolve( System& sys, const size_t n, const double t1, double h[], double y[] );
+
+private:
+  static const size_t size_ = dim * max_size;
+
+  //! Order of the stepper, used for step size control
+  static const unsigned int order_ = 5;
+
+  /**
+   * Perform one step of size h_[ i ] for all systems, as rkf45_apply().
+   * Only systems with trying_[ i ] are written to y. The stages are
+   * computed for all max_size systems, so that the loops have a fixed
+   * trip count.
+   */
+  void step_( const System& sys, double y[] );
+
+  /**
+   * Adjust step size h of system i from the error estimate of the last
+   * step, as std_control_hadjust(). Returns -1 if the step size was
+   * decreased, 1 if it was increased and 0 otherwise.
+   */
+  int hadjust_( const size_t i, const double y[], double& h ) const;
+
+  double eps_abs_[ max_size ];
+  double eps_rel_[ max_size ];
+
+  double t_[ max_size ];    //!< time reached by evolve()
+  bool active_[ max_size ]; //!< system has not reached t1 in evolve()
+
+  double h_[ max_size ];    //!< size of the current step
+  bool final_[ max_size ];  //!< current step ends at t1
+  bool trying_[ max_size ]; //!< system still needs to take a step
+
+  double y0_[ size_ ]; //!< states at the beginning of apply()
+  double ytmp_[ size_ ];
+  double dydt_in_[ size_ ];
+  double dydt_out_[ size_ ];
+  double yerr_[ size_ ];
+  double k2_[ size_ ];
+  double k3_[ size_ ];
+  double k4_[ size_ ];
+  double k5_[ size_ ];
+  double k6_[ size_ ];
+};
+
+template < typename System, size_t dim, size_t max_size >
+inline void
+BatchRKF45< System, dim, max_size >::set_tolerance( const size_t i, const double eps_abs, const double eps_rel )
+{
+  eps_abs_[ i ] = eps_abs;
+  eps_rel_[ i ] = eps_rel;
+}
+
+template < typename System, size_t dim, size_t max_size >
+void
+BatchRKF45< System, dim, max_size >::apply( const System& sys,
+  const size_t n,
+  const bool active[],
+  double t[],
+  const double t1,
+  double h[],
+  double y[] )
+{
+  std::copy( y, y + size_, y0_ );
+  sys.dynamics( y, dydt_in_ );
+
+  size_t n_trying = 0;
+  for ( size_t i = 0; i < n; ++i )
+  {
+    trying_[ i ] = active[ i ];
+    h_[ i ] = h[ i ];
+    n_trying += active[ i ];
+  }
+
+  // Systems whose step size was decreased repeat the step, while the
+  // others wait.
+  while ( n_trying > 0 )
+  {
+    for ( size_t i = 0; i < n; ++i )
+    {
+      const double dt = t1 - t[ i ];
+      final_[ i ] = dt >= 0.0 and h_[ i ] > dt;
+      if ( trying_[ i ] and final_[ i ] )
+      {
+        h_[ i ] = dt;
+      }
+    }
+
+    step_( sys, y );
+
+    n_trying = 0;
+    for ( size_t i = 0; i < n; ++i )
+    {
+      if ( not trying_[ i ] )
+      {
+        continue;
+      }
+
+      const double t_new = final_[ i ] ? t1 : t[ i ] + h_[ i ];
+      const double h_old = h_[ i ];
+      if ( hadjust_( i, y, h_[ i ] ) < 0 )
+      {
+        if ( std::fabs( h_[ i ] ) < std::fabs( h_old ) and t_new + h_[ i ] != t_new )
+        {
+          // undo step and try again with the decreased step size
+          for ( size_t d = 0; d < dim; ++d )
+          {
+            y[ d * max_size + i ] = y0_[ d * max_size + i ];
+          }
+          ++n_trying;
+          continue;
+        }
+        h_[ i ] = h_old;
+      }
+
+      t[ i ] = t_new;
+      h[ i ] = h_[ i ];
+      trying_[ i ] = false;
+    }
+  }
+}
+
+template < typename System, size_t dim, size_t max_size >
+void
+BatchRKF45< System, dim, max_size >::evolve( System& sys, const size_t n, const double t1, double h[], double y[] )
+{
+  size_t n_active = n;
+  for ( size_t i = 0; i < n; ++i )
+  {
+    t_[ i ] = 0.0;
+    active_[ i ] = true;
+  }
+
+  // Each call of apply() takes one step for every system that has not
+  // reached t1 yet.
+  while ( n_active > 0 )
+  {
+    apply( sys, n, active_, t_, t1, h, y );
+
+    for ( size_t i = 0; i < n; ++i )
+    {
+      if ( not active_[ i ] )
+      {
+        continue;
+      }
+
+      sys.step_taken( i );
+
+      if ( not( t_[ i ] < t1 ) )
+      {
+        active_[ i ] = false;
+        --n_active;
+      }
+    }
+  }
+}
+
+template < typename System, size_t dim, size_t max_size >
+void
+BatchRKF45< System, dim, max_size >::step_( const System& sys, double y[] )
+{
+  static const double ah[] = { 1.0 / 4.0, 3.0 / 8.0, 12.0 / 13.0, 1.0, 1.0 / 2.0 };
+  static const double b3[] = { 3.0 / 32.0, 9.0 / 32.0 };
+  static const double b4[] = { 1932.0 / 2197.0, -7200.0 / 2197.0, 7296.0 / 2197.0 };
+  static const double b5[] = { 8341.0 / 4104.0, -32832.0 / 4104.0, 29440.0 / 4104.0, -845.0 / 4104.0 };
+  static const double b6[] = {
+    -6080.0 / 20520.0, 41040.0 / 20520.0, -28352.0 / 20520.0, 9295.0 / 20520.0, -5643.0 / 20520.0
+  };
+  static const double c1 = 902880.0 / 7618050.0;
+  static const double c3 = 3953664.0 / 7618050.0;
+  static const double c4 = 3855735.0 / 7618050.0;
+  static const double c5 = -1371249.0 / 7618050.0;
+  static const double c6 = 277020.0 / 7618050.0;
+  static const double ec[] = { 0.0, 1.0 / 360.0, 0.0, -128.0 / 4275.0, -2197.0 / 75240.0, 1.0 / 50.0, 2.0 / 55.0 };
+
+  const double* const k1 = dydt_in_;
+
+  for ( size_t d = 0; d < dim; ++d )
+  {
+    for ( size_t i = 0, j = d * max_size; i < max_size; ++i, ++j )
+    {
+      ytmp_[ j ] = y[ j ] + ah[ 0 ] * h_[ i ] * k1[ j ];
+    }
+  }
+  sys.dynamics( ytmp_, k2_ );
+
+  for ( size_t d = 0; d < dim; ++d )
+  {
+    for ( size_t i = 0, j = d * max_size; i < max_size; ++i, ++j )
+    {
+      ytmp_[ j ] = y[ j ] + h_[ i ] * ( b3[ 0 ] * k1[ j ] + b3[ 1 ] * k2_[ j ] );
+    }
+  }
+  sys.dynamics( ytmp_, k3_ );
+
+  for ( size_t d = 0; d < dim; ++d )
+  {
+    for ( size_t i = 0, j = d * max_size; i < max_size; ++i, ++j )
+    {
+      ytmp_[ j ] = y[ j ] + h_[ i ] * ( b4[ 0 ] * k1[ j ] + b4[ 1 ] * k2_[ j ] + b4[ 2 ] * k3_[ j ] );
+    }
+  }
+  sys.dynamics( ytmp_, k4_ );
+
+  for ( size_t d = 0; d < dim; ++d )
+  {
+    for ( size_t i = 0, j = d * max_size; i < max_size; ++i, ++j )
+    {
+      ytmp_[ j ] =
+        y[ j ] + h_[ i ] * ( b5[ 0 ] * k1[ j ] + b5[ 1 ] * k2_[ j ] + b5[ 2 ] * k3_[ j ] + b5[ 3 ] * k4_[ j ] );
+    }
+  }
+  sys.dynamics( ytmp_, k5_ );
+
+  for ( size_t d = 0; d < dim; ++d )
+  {
+    for ( size_t i = 0, j = d * max_size; i < max_size; ++i, ++j )
+    {
+      ytmp_[ j ] = y[ j ]
+        + h_[ i ] * ( b6[ 0 ] * k1[ j ] + b6[ 1 ] * k2_[ j ] + b6[ 2 ] * k3_[ j ] + b6[ 3 ] * k4_[ j ]
+                      + b6[ 4 ] * k5_[ j ] );
+    }
+  }
+  sys.dynamics( ytmp_, k6_ );
+
+  for ( size_t d = 0; d < dim; ++d )
+  {
+    for ( size_t i = 0, j = d * max_size; i < max_size; ++i, ++j )
+    {
+      const double d_i = c1 * k1[ j ] + c3 * k3_[ j ] + c4 * k4_[ j ] + c5 * k5_[ j ] + c6 * k6_[ j ];
+      const double y_new = y[ j ] + h_[ i ] * d_i;
+      y[ j ] = trying_[ i ] ? y_new : y[ j ];
+    }
+  }
+
+  // derivatives at output
+  sys.dynamics( y, dydt_out_ );
+
+  // difference between 4th and 5th order
+  for ( size_t d = 0; d < dim; ++d )
+  {
+    for ( size_t i = 0, j = d * max_size; i < max_size; ++i, ++j )
+    {
+      yerr_[ j ] = h_[ i ]
+        * ( ec[ 1 ] * k1[ j ] + ec[ 3 ] * k3_[ j ] + ec[ 4 ] * k4_[ j ] + ec[ 5 ] * k5_[ j ] + ec[ 6 ] * k6_[ j ] );
+    }
+  }
+}
+
+template < typename System, size_t dim, size_t max_size >
+int
+BatchRKF45< System, dim, max_size >::hadjust_( const size_t i, const double y[], double& h ) const
+{
+  // standard control with a_y = 0 and a_dydt = 1
+  const double a_y = 0.0;
+  const double a_dydt = 1.0;
+  const double S = 0.9;
+  const double h_old = h;
+
+  double rmax = DBL_MIN;
+  for ( size_t j = i; j < size_; j += max_size )
+  {
+    const double D0 = eps_rel_[ i ] * ( a_y * std::fabs( y[ j ] ) + a_dydt * std::fabs( h_old * dydt_out_[ j ] ) )
+      + eps_abs_[ i ];
+    const double r = std::fabs( yerr_[ j ] ) / std::fabs( D0 );
+    rmax = r > rmax ? r : rmax;
+  }
+
+  if ( rmax > 1.1 )
+  {
+    // decrease step, no more than factor of 5, but a fraction S more
+    // than scaling suggests
+    double r = S / std::pow( rmax, 1.0 / order_ );
+    if ( r < 0.2 )
+    {
+      r = 0.2;
+    }
+    h = r * h_old;
+    return -1;
+  }
+  else if ( rmax < 0.5 )
+  {
+    // increase step, no more than factor of 5
+    double r = S / std::pow( rmax, 1.0 / ( order_ + 1.0 ) );
+    if ( r > 5.0 )
+    {
+      r = 5.0;
+    }
+    if ( r < 1.0 )
+    {
+      r = 1.0; // no decrease caused by S < 1
+    }
+    h = r * h_old;
+    return 1;
+  }
+  return 0;
+}
+
+#endif // BATCH_RKF45_H
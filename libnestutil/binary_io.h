@@ -0,0 +1,129 @@
+/*
+ *  binary_io.h
+ *
+ *  This file is part of NEST.
+ *
+ *  Copyright (C) 2004 The NEST Initiative
+ *
+ *  NEST is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  NEST is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with NEST.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifndef BINARY_IO_H
+#define BINARY_IO_H
+
+// C++ includes:
+#include <cstddef>
+#include <deque>
+#include <istream>
+#include <ostream>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+/**
+ * Functions writing values to and reading them from binary streams.
+ *
+ * Values are written as their object representation, i.e. in the byte
+ * order and layout of the machine. Binary streams are thus meant to be
+ * read by the same build of NEST on the same platform, e.g., to restore
+ * a checkpoint. Containers are written as their size followed by their
+ * elements. The functions do not check for errors; callers should check
+ * the state of the stream or enable its exceptions.
+ */
+
+template < typename T >
+inline void
+write_binary( std::ostream& os, const T& value )
+{
+  static_assert( std::is_trivially_copyable< T >::value, "write_binary() requires a trivially copyable type" );
+  os.write( reinterpret_cast< const char* >( &value ), sizeof( T ) );
+}
+
+template < typename T >
+inline void
+read_binary( std::istream& is, T& value )
+{
+  static_assert( std::is_trivially_copyable< T >::value, "read_binary() requires a trivially copyable type" );
+  is.read( reinterpret_cast< char* >( &value ), sizeof( T ) );
+}
+
+inline void
+write_binary( std::ostream& os, const std::string& s )
+{
+  write_binary( os, s.size() );
+  os.write( s.data(), s.size() );
+}
+
+inline void
+read_binary( std::istream& is, std::string& s )
+{
+  size_t size = 0;
+  read_binary( is, size );
+  s.resize( size );
+  if ( size > 0 )
+  {
+    is.read( &s[ 0 ], size );
+  }
+}
+
+template < typename T >
+inline void
+write_binary( std::ostream& os, const std::vector< T >& v )
+{
+  write_binary( os, v.size() );
+  for ( typename std::vector< T >::const_iterator it = v.begin(); it != v.end(); ++it )
+  {
+    write_binary( os, *it );
+  }
+}
+
+template < typename T >
+inline void
+read_binary( std::istream& is, std::vector< T >& v )
+{
+  size_t size = 0;
+  read_binary( is, size );
+  v.resize( size );
+  for ( typename std::vector< T >::iterator it = v.begin(); it != v.end(); ++it )
+  {
+    read_binary( is, *it );
+  }
+}
+
+template < typename T >
+inline void
+write_binary( std::ostream& os, const std::deque< T >& d )
+{
+  write_binary( os, d.size() );
+  for ( typename std::deque< T >::const_iterator it = d.begin(); it != d.end(); ++it )
+  {
+    write_binary( os, *it );
+  }
+}
+
+template < typename T >
+inline void
+read_binary( std::istream& is, std::deque< T >& d )
+{
+  size_t size = 0;
+  read_binary( is, size );
+  d.resize( size );
+  for ( typename std::deque< T >::iterator it = d.begin(); it != d.end(); ++it )
+  {
+    read_binary( is, *it );
+  }
+}
+
+#endif // BINARY_IO_H
@@ -0,0 +1,140 @@
+/*
+ *  decay_table.h
+ *
+ *  This file is part of NEST.
+ *
+ *  Copyright (C) 2004 The NEST Initiative
+ *
+ *  NEST is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  NEST is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with NEST.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifndef DECAY_TABLE_H
+#define DECAY_TABLE_H
+
+// C++ includes:
+#include <cmath>
+#include <cstddef>
+#include <vector>
+
+/**
+ * Table of exponential decay factors exp( -n h / tau ) on a time grid.
+ *
+ * Plastic synapses evaluate exp( dt / tau ) for differences dt <= 0 of
+ * spike times. For spikes on the simulation grid, -dt is a multiple n h
+ * of the resolution h up to rounding, and the factor can be looked up
+ * instead of computed. DecayTable covers 0 <= n h < max_taus * tau and
+ * falls back to std::exp() for dt beyond the table or off the grid, e.g.,
+ * for precise spike times.
+ *
+ * A difference dt is taken to be on the grid if it deviates from n h by
+ * at most tolerance * h. The relative error of looked-up factors is thus
+ * bounded by tolerance * h / tau, plus the rounding error of std::exp().
+ * An empty table, as after default construction, always falls back.
+ */
+class DecayTable
+{
+public:
+  //! relative deviation from the grid, in units of h, still looked up
+  static const double tolerance;
+
+  //! length of the table in units of tau
+  static const double max_taus;
+
+  //! upper bound for the number of entries
+  static const size_t max_size;
+
+  DecayTable();
+
+  //! tabulate exp( -n h / tau )
+  void tabulate( double tau, double h );
+
+  //! remove all entries, so that all factors are computed
+  void clear();
+
+  //! return exp( dt / tau ) for dt <= 0
+  double operator()( double dt ) const;
+
+  //! return the bound for the relative error of looked-up factors
+  double get_max_rel_error() const;
+
+private:
+  std::vector< double > factors_;
+  double tau_;
+  double h_;
+  double h_inv_;
+};
+
+inline DecayTable::DecayTable()
+  : factors_()
+  , tau_( 1.0 )
+  , h_( 1.0 )
+  , h_inv_( 1.0 )
+{
+}
+
+inline void
+DecayTable::tabulate( double tau, double h )
+{
+  tau_ = tau;
+  h_ = h;
+  h_inv_ = 1.0 / h;
+
+  // compare before converting, as tau may be out of range
+  const double length = std::ceil( max_taus * tau * h_inv_ );
+  size_t size = max_size;
+  if ( not( length >= 0.0 ) )
+  {
+    size = 0;
+  }
+  else if ( length < max_size )
+  {
+    size = static_cast< size_t >( length );
+  }
+
+  factors_.resize( size );
+  for ( size_t n = 0; n < size; ++n )
+  {
+    factors_[ n ] = std::exp( -( n * h ) / tau );
+  }
+}
+
+inline void
+DecayTable::clear()
+{
+  std::vector< double >().swap( factors_ );
+}
+
+inline double
+DecayTable::operator()( double dt ) const
+{
+  const double steps = -dt * h_inv_;
+  if ( steps >= 0.0 and steps < factors_.size() )
+  {
+    const size_t n = static_cast< size_t >( steps + 0.5 );
+    if ( std::abs( steps - n ) <= tolerance and n < factors_.size() )
+    {
+      return factors_[ n ];
+    }
+  }
+  return std::exp( dt / tau_ );
+}
+
+inline double
+DecayTable::get_max_rel_error() const
+{
+  return tolerance * h_ / tau_;
+}
+
+#endif // DECAY_TABLE_H
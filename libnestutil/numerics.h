@@ -85,6 +85,27 @@ expm1( double x )
 #endif
 }
 
+/**
+ * Return x^y, with exact shortcuts for the exponents 0 and 1.
+ *
+ * Weight-dependent plasticity rules raise weights to exponents that are
+ * 0 (additive) or 1 (multiplicative) by default, for which std::pow() is
+ * needlessly costly. The result equals std::pow( x, y ) for all x and y.
+ */
+inline double
+pow( double x, double y )
+{
+  if ( y == 1.0 )
+  {
+    return x;
+  }
+  if ( y == 0.0 )
+  {
+    return 1.0;
+  }
+  return std::pow( x, y );
+}
+
 template < typename T >
 bool
 is_nan( T f )
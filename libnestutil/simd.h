@@ -0,0 +1,318 @@
+/*
+ *  simd.h
+ *
+ *  This file is part of NEST.
+ *
+ *  Copyright (C) 2004 The NEST Initiative
+ *
+ *  NEST is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  NEST is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with NEST.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifndef SIMD_H
+#define SIMD_H
+
+// C++ includes:
+#include <cstddef>
+
+#if defined( __AVX512F__ ) || defined( __AVX__ )
+#include <immintrin.h>
+#endif
+
+/**
+ * Thin wrappers around vector instructions on packed doubles, used by the
+ * population kernels of neuron models.
+ *
+ * The instruction set is chosen at compile time: AVX-512 if the compiler
+ * targets it (e.g. -march=native on a capable machine), else AVX, else
+ * plain scalar code. Only individually rounded operations are provided,
+ * no fused multiply-add, so that a kernel written with these functions
+ * gives bitwise the same results as the equivalent scalar code,
+ * independent of the vector width.
+ */
+namespace simd
+{
+
+#if defined( __AVX512F__ )
+
+const char* const instruction_set = "avx512";
+const size_t width = 8; //!< number of doubles per vector
+
+typedef __m512d Double;
+typedef __mmask8 Mask;
+
+inline Double
+load( const double* p )
+{
+  return _mm512_loadu_pd( p );
+}
+
+inline void
+store( double* p, const Double a )
+{
+  _mm512_storeu_pd( p, a );
+}
+
+inline Double
+set1( const double x )
+{
+  return _mm512_set1_pd( x );
+}
+
+inline Double
+add( const Double a, const Double b )
+{
+  return _mm512_add_pd( a, b );
+}
+
+inline Double
+sub( const Double a, const Double b )
+{
+  return _mm512_sub_pd( a, b );
+}
+
+inline Double
+mul( const Double a, const Double b )
+{
+  return _mm512_mul_pd( a, b );
+}
+
+inline Double
+div( const Double a, const Double b )
+{
+  return _mm512_div_pd( a, b );
+}
+
+//! Flip the sign, also of zeros
+inline Double
+neg( const Double a )
+{
+  const __m512i sign = _mm512_castpd_si512( _mm512_set1_pd( -0. ) );
+  return _mm512_castsi512_pd( _mm512_xor_si512( _mm512_castpd_si512( a ), sign ) );
+}
+
+inline Mask
+eq( const Double a, const Double b )
+{
+  return _mm512_cmp_pd_mask( a, b, _CMP_EQ_OQ );
+}
+
+inline Mask
+lt( const Double a, const Double b )
+{
+  return _mm512_cmp_pd_mask( a, b, _CMP_LT_OQ );
+}
+
+inline Mask
+ge( const Double a, const Double b )
+{
+  return _mm512_cmp_pd_mask( a, b, _CMP_GE_OQ );
+}
+
+//! Per lane m ? a : b
+inline Double
+select( const Mask m, const Double a, const Double b )
+{
+  return _mm512_mask_blend_pd( m, b, a );
+}
+
+//! Bit i is set if lane i of m is true
+inline unsigned int
+bits( const Mask m )
+{
+  return m;
+}
+
+#elif defined( __AVX__ )
+
+const char* const instruction_set = "avx";
+const size_t width = 4; //!< number of doubles per vector
+
+typedef __m256d Double;
+typedef __m256d Mask;
+
+inline Double
+load( const double* p )
+{
+  return _mm256_loadu_pd( p );
+}
+
+inline void
+store( double* p, const Double a )
+{
+  _mm256_storeu_pd( p, a );
+}
+
+inline Double
+set1( const double x )
+{
+  return _mm256_set1_pd( x );
+}
+
+inline Double
+add( const Double a, const Double b )
+{
+  return _mm256_add_pd( a, b );
+}
+
+inline Double
+sub( const Double a, const Double b )
+{
+  return _mm256_sub_pd( a, b );
+}
+
+inline Double
+mul( const Double a, const Double b )
+{
+  return _mm256_mul_pd( a, b );
+}
+
+inline Double
+div( const Double a, const Double b )
+{
+  return _mm256_div_pd( a, b );
+}
+
+//! Flip the sign, also of zeros
+inline Double
+neg( const Double a )
+{
+  return _mm256_xor_pd( a, _mm256_set1_pd( -0. ) );
+}
+
+inline Mask
+eq( const Double a, const Double b )
+{
+  return _mm256_cmp_pd( a, b, _CMP_EQ_OQ );
+}
+
+inline Mask
+lt( const Double a, const Double b )
+{
+  return _mm256_cmp_pd( a, b, _CMP_LT_OQ );
+}
+
+inline Mask
+ge( const Double a, const Double b )
+{
+  return _mm256_cmp_pd( a, b, _CMP_GE_OQ );
+}
+
+//! Per lane m ? a : b
+inline Double
+select( const Mask m, const Double a, const Double b )
+{
+  return _mm256_blendv_pd( b, a, m );
+}
+
+//! Bit i is set if lane i of m is true
+inline unsigned int
+bits( const Mask m )
+{
+  return _mm256_movemask_pd( m );
+}
+
+#else
+
+const char* const instruction_set = "none";
+const size_t width = 1; //!< number of doubles per vector
+
+typedef double Double;
+typedef bool Mask;
+
+inline Double
+load( const double* p )
+{
+  return *p;
+}
+
+inline void
+store( double* p, const Double a )
+{
+  *p = a;
+}
+
+inline Double
+set1( const double x )
+{
+  return x;
+}
+
+inline Double
+add( const Double a, const Double b )
+{
+  return a + b;
+}
+
+inline Double
+sub( const Double a, const Double b )
+{
+  return a - b;
+}
+
+inline Double
+mul( const Double a, const Double b )
+{
+  return a * b;
+}
+
+inline Double
+div( const Double a, const Double b )
+{
+  return a / b;
+}
+
+inline Double
+neg( const Double a )
+{
+  return -a;
+}
+
+inline Mask
+eq( const Double a, const Double b )
+{
+  return a == b;
+}
+
+inline Mask
+lt( const Double a, const Double b )
+{
+  return a < b;
+}
+
+inline Mask
+ge( const Double a, const Double b )
+{
+  return a >= b;
+}
+
+//! m ? a : b
+inline Double
+select( const Mask m, const Double a, const Double b )
+{
+  return m ? a : b;
+}
+
+//! Bit 0 is set if m is true
+inline unsigned int
+bits( const Mask m )
+{
+  return m;
+}
+
+#endif
+
+} // namespace simd
+
+#endif // SIMD_H
@@ -181,6 +181,28 @@ sort( BlockVector< T1 >& vec_sort, BlockVector< T2 >& vec_perm )
 #endif
 }
 
+/**
+ * Sorts the elements from position first to the end of two vectors
+ * according to elements in first vector, leaving the elements before
+ * first untouched.
+ */
+template < typename T1, typename T2 >
+void
+sort( BlockVector< T1 >& vec_sort, BlockVector< T2 >& vec_perm, const size_t first )
+{
+  if ( first >= vec_sort.size() )
+  {
+    return;
+  }
+#ifdef HAVE_BOOST
+  boost::sort::spreadsort::integer_sort( make_iterator_pair( vec_sort.begin() + first, vec_perm.begin() + first ),
+    make_iterator_pair( vec_sort.end(), vec_perm.end() ),
+    rightshift_iterator_pair() );
+#else
+  quicksort3way( vec_sort, vec_perm, first, vec_sort.size() - 1 );
+#endif
+}
+
 } // namespace sort
 
 #endif /* #ifndef SORT_H */
@@ -24,6 +24,17 @@
 
 #ifdef HAVE_GSL
 
+// C++ includes:
+#include <algorithm>
+#include <string>
+#include <vector>
+
+// Includes from libnestutil:
+#include "binary_io.h"
+
+// Includes from librandom:
+#include "librandom_exceptions.h"
+
 // nothing if GSL 1.2 or later not available
 
 librandom::GslRandomGen::GslRandomGen( const gsl_rng_type* type, unsigned long seed )
@@ -40,6 +51,28 @@ librandom::GslRandomGen::~GslRandomGen()
   gsl_rng_free( rng_ );
 }
 
+void
+librandom::GslRandomGen::save_state( std::ostream& os ) const
+{
+  const char* const state = static_cast< const char* >( gsl_rng_state( rng_ ) );
+  write_binary( os, std::string( gsl_rng_name( rng_ ) ) );
+  write_binary( os, std::vector< char >( state, state + gsl_rng_size( rng_ ) ) );
+}
+
+void
+librandom::GslRandomGen::load_state( std::istream& is )
+{
+  std::string name;
+  std::vector< char > state;
+  read_binary( is, name );
+  read_binary( is, state );
+  if ( name != gsl_rng_name( rng_ ) or state.size() != gsl_rng_size( rng_ ) )
+  {
+    throw UnsuitableRNG( "Invalid state for GSL generator " + std::string( gsl_rng_name( rng_ ) ) + "." );
+  }
+  std::copy( state.begin(), state.end(), static_cast< char* >( gsl_rng_state( rng_ ) ) );
+}
+
 // function initializing RngList
 // add further self-implemented RNG below
 void
@@ -67,6 +67,7 @@ namespace librandom
 class GslRandomGen : public RandomGen
 {
   friend class GSL_BinomialRandomDev;
+  friend class TypedRandomGen< GslRandomGen >;
 
 public:
   explicit GslRandomGen( const gsl_rng_type*, //!< given RNG, given seed
@@ -83,6 +84,9 @@ public:
     return RngPtr( new GslRandomGen( rng_type_, s ) );
   }
 
+  void save_state( std::ostream& ) const;
+  void load_state( std::istream& );
+
 
 private:
   void seed_( unsigned long );
@@ -30,6 +30,15 @@
 
 #include "knuthlfg.h"
 
+// C++ includes:
+#include <algorithm>
+
+// Includes from libnestutil:
+#include "binary_io.h"
+
+// Includes from librandom:
+#include "librandom_exceptions.h"
+
 const long librandom::KnuthLFG::KK_ = 100;
 const long librandom::KnuthLFG::LL_ = 37;
 const long librandom::KnuthLFG::MM_ = 1L << 30;
@@ -47,6 +56,35 @@ librandom::KnuthLFG::KnuthLFG( unsigned long seed )
   ran_start_( seed );
 }
 
+void
+librandom::KnuthLFG::save_state( std::ostream& os ) const
+{
+  write_binary( os, ran_x_ );
+  write_binary( os, ran_buffer_ );
+  const long next = next_ - ran_buffer_.begin();
+  write_binary( os, next );
+}
+
+void
+librandom::KnuthLFG::load_state( std::istream& is )
+{
+  std::vector< long > x;
+  std::vector< long > buffer;
+  long next = 0;
+  read_binary( is, x );
+  read_binary( is, buffer );
+  read_binary( is, next );
+  if ( x.size() != ran_x_.size() or buffer.size() != ran_buffer_.size() or next < 0 or next > KK_ )
+  {
+    throw UnsuitableRNG( "Invalid state for KnuthLFG." );
+  }
+
+  // copy elementwise, since end_ points into ran_buffer_
+  std::copy( x.begin(), x.end(), ran_x_.begin() );
+  std::copy( buffer.begin(), buffer.end(), ran_buffer_.begin() );
+  next_ = ran_buffer_.begin() + next;
+}
+
 void
 librandom::KnuthLFG::ran_array_( std::vector< long >& rbuff )
 {
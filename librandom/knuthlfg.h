@@ -47,6 +47,8 @@ namespace librandom
  */
 class KnuthLFG : public RandomGen
 {
+  friend class TypedRandomGen< KnuthLFG >;
+
 public:
   //! Create generator with given seed
   explicit KnuthLFG( unsigned long );
@@ -59,6 +61,9 @@ public:
     return RngPtr( new KnuthLFG( s ) );
   }
 
+  void save_state( std::ostream& ) const;
+  void load_state( std::istream& );
+
 private:
   //! implements seeding for RandomGen
   void seed_( unsigned long );
@@ -66,6 +71,9 @@ private:
   //! implements drawing a single [0,1) number for RandomGen
   double drand_();
 
+  //! implements drawing of n [0,1) numbers for RandomGen
+  void drand_array_( double*, const size_t );
+
 private:
   static const long KK_;          //!< the long lag
   static const long LL_;          //!< the short lag
@@ -114,6 +122,14 @@ KnuthLFG::drand_()
   return I2DFactor_ * ran_draw_();
 }
 
+inline void
+KnuthLFG::drand_array_( double* v, const size_t n )
+{
+  for ( size_t i = 0; i < n; ++i )
+  {
+    v[ i ] = I2DFactor_ * ran_draw_();
+  }
+}
 
 inline long
 KnuthLFG::mod_diff_( long x, long y )
@@ -57,6 +57,12 @@
 
 #include "mt19937.h"
 
+// Includes from libnestutil:
+#include "binary_io.h"
+
+// Includes from librandom:
+#include "librandom_exceptions.h"
+
 const unsigned int librandom::MT19937::N = 624;
 const unsigned int librandom::MT19937::M = 397;
 const unsigned long librandom::MT19937::MATRIX_A = 0x9908b0dfUL;
@@ -77,6 +83,28 @@ librandom::MT19937::seed_( unsigned long s )
   init_genrand( s );
 }
 
+void
+librandom::MT19937::save_state( std::ostream& os ) const
+{
+  write_binary( os, mt );
+  write_binary( os, mti );
+}
+
+void
+librandom::MT19937::load_state( std::istream& is )
+{
+  std::vector< unsigned long > state;
+  int index = 0;
+  read_binary( is, state );
+  read_binary( is, index );
+  if ( state.size() != N or index < 0 or static_cast< unsigned int >( index ) > N )
+  {
+    throw UnsuitableRNG( "Invalid state for MT19937." );
+  }
+  mt.swap( state );
+  mti = index;
+}
+
 void
 librandom::MT19937::init_genrand( unsigned long s )
 {
@@ -93,45 +121,33 @@ librandom::MT19937::init_genrand( unsigned long s )
   }
 }
 
-unsigned long
-librandom::MT19937::genrand_int32()
+void
+librandom::MT19937::generate_words_()
 {
   unsigned long y;
   static unsigned long mag01[ 2 ] = { 0x0UL, MATRIX_A };
   /* mag01[x] = x * MATRIX_A  for x=0,1 */
 
-  if ( static_cast< unsigned int >( mti ) >= N )
-  { /* generate N words at one time */
-    int kk;
-
-    if ( mti == N + 1 ) /* if init_genrand() has not been called, */
-    {
-      init_genrand( 5489UL ); /* a default initial seed is used */
-    }
-
-    for ( kk = 0; static_cast< unsigned int >( kk ) < N - M; kk++ )
-    {
-      y = ( mt[ kk ] & UPPER_MASK ) | ( mt[ kk + 1 ] & LOWER_MASK );
-      mt[ kk ] = mt[ kk + M ] ^ ( y >> 1 ) ^ mag01[ y & 0x1UL ];
-    }
-    for ( ; static_cast< unsigned int >( kk ) < N - 1; kk++ )
-    {
-      y = ( mt[ kk ] & UPPER_MASK ) | ( mt[ kk + 1 ] & LOWER_MASK );
-      mt[ kk ] = mt[ kk + ( M - N ) ] ^ ( y >> 1 ) ^ mag01[ y & 0x1UL ];
-    }
-    y = ( mt[ N - 1 ] & UPPER_MASK ) | ( mt[ 0 ] & LOWER_MASK );
-    mt[ N - 1 ] = mt[ M - 1 ] ^ ( y >> 1 ) ^ mag01[ y & 0x1UL ];
-
-    mti = 0;
-  }
+  /* generate N words at one time */
+  int kk;
 
-  y = mt[ mti++ ];
+  if ( mti == N + 1 ) /* if init_genrand() has not been called, */
+  {
+    init_genrand( 5489UL ); /* a default initial seed is used */
+  }
 
-  /* Tempering */
-  y ^= ( y >> 11 );
-  y ^= ( y << 7 ) & 0x9d2c5680UL;
-  y ^= ( y << 15 ) & 0xefc60000UL;
-  y ^= ( y >> 18 );
+  for ( kk = 0; static_cast< unsigned int >( kk ) < N - M; kk++ )
+  {
+    y = ( mt[ kk ] & UPPER_MASK ) | ( mt[ kk + 1 ] & LOWER_MASK );
+    mt[ kk ] = mt[ kk + M ] ^ ( y >> 1 ) ^ mag01[ y & 0x1UL ];
+  }
+  for ( ; static_cast< unsigned int >( kk ) < N - 1; kk++ )
+  {
+    y = ( mt[ kk ] & UPPER_MASK ) | ( mt[ kk + 1 ] & LOWER_MASK );
+    mt[ kk ] = mt[ kk + ( M - N ) ] ^ ( y >> 1 ) ^ mag01[ y & 0x1UL ];
+  }
+  y = ( mt[ N - 1 ] & UPPER_MASK ) | ( mt[ 0 ] & LOWER_MASK );
+  mt[ N - 1 ] = mt[ M - 1 ] ^ ( y >> 1 ) ^ mag01[ y & 0x1UL ];
 
-  return y;
+  mti = 0;
 }
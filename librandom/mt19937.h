@@ -74,6 +74,8 @@ namespace librandom
  */
 class MT19937 : public RandomGen
 {
+  friend class TypedRandomGen< MT19937 >;
+
 public:
   //! Create generator with given seed
   explicit MT19937( unsigned long );
@@ -86,6 +88,9 @@ public:
     return RngPtr( new MT19937( s ) );
   }
 
+  void save_state( std::ostream& ) const;
+  void load_state( std::istream& );
+
 private:
   //! implements seeding for RandomGen
   void seed_( unsigned long );
@@ -93,6 +98,9 @@ private:
   //! implements drawing a single [0,1) number for RandomGen
   double drand_();
 
+  //! implements drawing of n [0,1) numbers for RandomGen
+  void drand_array_( double*, const size_t );
+
 private:
   // functions inherited from C-version of mt19937
 
@@ -102,6 +110,9 @@ private:
   /* generates a random number on [0,0xffffffff]-interval */
   unsigned long genrand_int32();
 
+  /* refills mt[] with N new words; out of line so genrand_int32() inlines */
+  void generate_words_();
+
   /* generates a random number on [0,1)-real-interval */
   double genrand_real2();
 
@@ -124,6 +135,34 @@ librandom::MT19937::drand_()
   return genrand_real2();
 }
 
+inline void
+librandom::MT19937::drand_array_( double* v, const size_t n )
+{
+  for ( size_t i = 0; i < n; ++i )
+  {
+    v[ i ] = genrand_real2();
+  }
+}
+
+inline unsigned long
+librandom::MT19937::genrand_int32()
+{
+  if ( static_cast< unsigned int >( mti ) >= N )
+  {
+    generate_words_();
+  }
+
+  unsigned long y = mt[ mti++ ];
+
+  /* Tempering */
+  y ^= ( y >> 11 );
+  y ^= ( y << 7 ) & 0x9d2c5680UL;
+  y ^= ( y << 15 ) & 0xefc60000UL;
+  y ^= ( y >> 18 );
+
+  return y;
+}
+
 inline double
 librandom::MT19937::genrand_real2()
 {
@@ -0,0 +1,149 @@
+/*
+ *  philox.cpp
+ *
+ *  This file is part of NEST.
+ *
+ *  Copyright (C) 2004 The NEST Initiative
+ *
+ *  NEST is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  NEST is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with NEST.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "philox.h"
+
+// C++ includes:
+#include <cassert>
+
+// Includes from libnestutil:
+#include "binary_io.h"
+
+// Includes from librandom:
+#include "librandom_exceptions.h"
+
+const double librandom::Philox::I2DFactor_ = 1.0 / 4294967296.0;
+
+namespace
+{
+// multipliers and Weyl sequence constants of Philox4x32
+const uint64_t M0 = 0xD2511F53UL;
+const uint64_t M1 = 0xCD9E8D57UL;
+const uint32_t W0 = 0x9E3779B9UL;
+const uint32_t W1 = 0xBB67AE85UL;
+
+void
+philox4x32_10( const uint32_t in[ 4 ], const uint32_t key[ 2 ], uint32_t out[ 4 ] )
+{
+  uint32_t c0 = in[ 0 ];
+  uint32_t c1 = in[ 1 ];
+  uint32_t c2 = in[ 2 ];
+  uint32_t c3 = in[ 3 ];
+  uint32_t k0 = key[ 0 ];
+  uint32_t k1 = key[ 1 ];
+
+  for ( int r = 0; r < 10; ++r )
+  {
+    const uint64_t p0 = M0 * c0;
+    const uint64_t p1 = M1 * c2;
+    c0 = static_cast< uint32_t >( p1 >> 32 ) ^ c1 ^ k0;
+    c1 = static_cast< uint32_t >( p1 );
+    c2 = static_cast< uint32_t >( p0 >> 32 ) ^ c3 ^ k1;
+    c3 = static_cast< uint32_t >( p0 );
+    k0 += W0;
+    k1 += W1;
+  }
+
+  out[ 0 ] = c0;
+  out[ 1 ] = c1;
+  out[ 2 ] = c2;
+  out[ 3 ] = c3;
+}
+}
+
+librandom::Philox::Philox( unsigned long seed )
+{
+  self_test_(); // minimal check
+  seed_( seed );
+}
+
+void
+librandom::Philox::seed_( unsigned long seed )
+{
+  key_[ 0 ] = static_cast< uint32_t >( seed );
+  key_[ 1 ] = static_cast< uint32_t >( static_cast< uint64_t >( seed ) >> 32 );
+  set_stream( 0, 0 );
+}
+
+void
+librandom::Philox::set_stream( unsigned long stream, unsigned long substream )
+{
+  counter_[ 0 ] = 0;
+  counter_[ 1 ] = static_cast< uint32_t >( substream );
+  counter_[ 2 ] = static_cast< uint32_t >( stream );
+  counter_[ 3 ] = static_cast< uint32_t >( static_cast< uint64_t >( stream ) >> 32 );
+
+  // mark as needing refill
+  next_ = 4;
+}
+
+void
+librandom::Philox::save_state( std::ostream& os ) const
+{
+  write_binary( os, key_ );
+  write_binary( os, counter_ );
+  write_binary( os, block_ );
+  write_binary( os, next_ );
+}
+
+void
+librandom::Philox::load_state( std::istream& is )
+{
+  read_binary( is, key_ );
+  read_binary( is, counter_ );
+  read_binary( is, block_ );
+  read_binary( is, next_ );
+  if ( next_ > 4 )
+  {
+    throw UnsuitableRNG( "Invalid state for Philox." );
+  }
+}
+
+void
+librandom::Philox::generate_block_()
+{
+  philox4x32_10( counter_, key_, block_ );
+  ++counter_[ 0 ];
+  next_ = 0;
+}
+
+void
+librandom::Philox::self_test_()
+{
+  const uint32_t zero[ 4 ] = { 0, 0, 0, 0 };
+  const uint32_t ones[ 4 ] = { 0xffffffffUL, 0xffffffffUL, 0xffffffffUL, 0xffffffffUL };
+  const uint32_t pi[ 4 ] = { 0x243f6a88UL, 0x85a308d3UL, 0x13198a2eUL, 0x03707344UL };
+  const uint32_t pi_key[ 2 ] = { 0xa4093822UL, 0x299f31d0UL };
+  uint32_t out[ 4 ];
+
+  philox4x32_10( zero, zero, out );
+  assert( out[ 0 ] == 0x6627e8d5UL and out[ 1 ] == 0xe169c58dUL and out[ 2 ] == 0xbc57ac4cUL
+    and out[ 3 ] == 0x9b00dbd8UL );
+
+  philox4x32_10( ones, ones, out );
+  assert( out[ 0 ] == 0x408f276dUL and out[ 1 ] == 0x41c83b0eUL and out[ 2 ] == 0xa20bc7c6UL
+    and out[ 3 ] == 0x6d5451fdUL );
+
+  philox4x32_10( pi, pi_key, out );
+  assert( out[ 0 ] == 0xd16cfe09UL and out[ 1 ] == 0x94fdccebUL and out[ 2 ] == 0x5001e420UL
+    and out[ 3 ] == 0x24126ea1UL );
+}
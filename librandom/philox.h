@@ -0,0 +1,124 @@
+/*
+ *  philox.h
+ *
+ *  This file is part of NEST.
+ *
+ *  Copyright (C) 2004 The NEST Initiative
+ *
+ *  NEST is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  NEST is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with NEST.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifndef PHILOX_H
+#define PHILOX_H
+
+// C includes:
+#include <stdint.h>
+
+// Includes from librandom:
+#include "randomgen.h"
+
+namespace librandom
+{
+
+/**
+ * Built-in implementation of the counter-based Philox4x32-10 generator.
+ *
+ * Philox maps a 128-bit counter and a 64-bit key to four 32-bit random
+ * numbers by ten rounds of a bijection (Salmon et al., Parallel random
+ * numbers: as easy as 1, 2, 3, SC11, 2011). The generator has no state
+ * besides key and counter, so the n-th number of any stream can be
+ * computed directly.
+ *
+ * The key is the seed. The counter consists of a 64-bit stream number,
+ * a 32-bit substream number and a 32-bit block number. set_stream()
+ * selects stream and substream and rewinds the block number, so that
+ * independent streams can be generated on any thread, e.g., one stream
+ * for each neuron. Seeding selects stream 0, substream 0.
+ *
+ * The numbers drawn are 32-bit integers scaled to [0, 1), as for
+ * MT19937.
+ */
+class Philox : public RandomGen
+{
+  friend class TypedRandomGen< Philox >;
+
+public:
+  //! Create generator with given seed
+  explicit Philox( unsigned long );
+
+  ~Philox(){};
+
+  RngPtr
+  clone( unsigned long s )
+  {
+    return RngPtr( new Philox( s ) );
+  }
+
+  void save_state( std::ostream& ) const;
+  void load_state( std::istream& );
+
+  /**
+   * Select stream and substream and rewind to their first number.
+   * The numbers drawn afterwards depend only on seed, stream, substream
+   * and the number of numbers drawn since.
+   */
+  void set_stream( unsigned long stream, unsigned long substream );
+
+private:
+  //! implements seeding for RandomGen
+  void seed_( unsigned long );
+
+  //! implements drawing a single [0,1) number for RandomGen
+  double drand_();
+
+  //! implements drawing of n [0,1) numbers for RandomGen
+  void drand_array_( double*, const size_t );
+
+  //! compute block_ from counter_ and key_, then advance block number
+  void generate_block_();
+
+  //! check the generator against the known-answer tests of Random123
+  void self_test_();
+
+  static const double I2DFactor_; //!< int to double factor
+
+  uint32_t key_[ 2 ];     //!< the seed
+  uint32_t counter_[ 4 ]; //!< block number, substream, stream
+  uint32_t block_[ 4 ];   //!< numbers generated from last counter
+  unsigned int next_;     //!< next number in block_ to deliver
+};
+
+inline double
+Philox::drand_()
+{
+  if ( next_ == 4 )
+  {
+    generate_block_();
+  }
+  return I2DFactor_ * block_[ next_++ ];
+}
+
+inline void
+Philox::drand_array_( double* v, const size_t n )
+{
+  for ( size_t i = 0; i < n; ++i )
+  {
+    v[ i ] = drand_();
+  }
+}
+
+} // namespace librandom
+
+#endif // PHILOX_H
@@ -316,6 +316,46 @@ librandom::PoissonRandomDev::ldev( RngPtr r ) const
   } // mu < 10
 }
 
+void
+librandom::PoissonRandomDev::ldev( RngPtr r, long* v, const size_t n ) const
+{
+  assert( r.valid() );
+
+  if ( mu_ == 0.0 )
+  {
+    std::fill( v, v + n, 0 );
+    return;
+  }
+
+  if ( mu_ >= 10.0 )
+  {
+    // case A consumes a variable number of uniform numbers per deviate
+    for ( size_t i = 0; i < n; ++i )
+    {
+      v[ i ] = ldev( r );
+    }
+    return;
+  }
+
+  // case B: one uniform number per deviate, drawn in blocks
+  const size_t block_size = 64;
+  double U[ block_size ];
+  for ( size_t first = 0; first < n; first += block_size )
+  {
+    const size_t m = std::min( block_size, n - first );
+    r->drand( U, m );
+    for ( size_t i = 0; i < m; ++i )
+    {
+      unsigned long K = 0;
+      while ( U[ i ] > P_[ K ] && K != n_tab_ )
+      {
+        ++K;
+      }
+      v[ first + i ] = K;
+    }
+  }
+}
+
 void
 librandom::PoissonRandomDev::proc_f_( const unsigned K, double& px, double& py, double& fx, double& fy ) const
 {
@@ -138,6 +138,26 @@ public:
   using RandomDev::ldev;
 
   long ldev( RngPtr ) const; //!< draw integer, threaded
+
+  /**
+   * Draw n integers into v, threaded.
+   * The numbers are the same as those of n calls to ldev( RngPtr ).
+   * For lambda < 10, the uniform numbers are drawn in blocks, avoiding
+   * one virtual call into the RNG per deviate.
+   * @see has_fast_block_ldev()
+   */
+  void ldev( RngPtr, long* v, const size_t n ) const;
+
+  /**
+   * Return true if drawing in blocks is faster than drawing one by one.
+   * This is the case if each deviate is obtained from a single uniform
+   * random number by table lookup, i.e., for lambda < 10.
+   */
+  bool
+  has_fast_block_ldev() const
+  {
+    return mu_ < 10.0;
+  }
   bool
   has_ldev() const
   {
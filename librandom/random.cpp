@@ -25,6 +25,7 @@
 // C++ includes:
 #include <cassert>
 #include <string>
+#include <vector>
 
 // Includes from sli:
 #include "sliexceptions.h"
@@ -92,9 +93,15 @@ librandom::random_array( RdvDatum& rdv, const size_t n )
 
   if ( rdv->has_ldev() )
   {
+    // drawn as a block, so that deviates supporting it draw efficiently
+    std::vector< long > values( n );
+    if ( n > 0 )
+    {
+      rdv->ldev( &values[ 0 ], n );
+    }
     for ( size_t j = 0; j < n; ++j )
     {
-      result.push_back( rdv->ldev() );
+      result.push_back( values[ j ] );
     }
   }
   else
@@ -35,6 +35,7 @@
 #include "lognormal_randomdev.h"
 #include "mt19937.h"
 #include "normal_randomdev.h"
+#include "philox.h"
 #include "poisson_randomdev.h"
 #include "random.h"
 #include "random_datums.h"
@@ -119,6 +120,7 @@ RandomNumbers::init( SLIInterpreter* i )
   // add built-in rngs
   register_rng_< librandom::KnuthLFG >( "knuthlfg", *rngdict_ );
   register_rng_< librandom::MT19937 >( "MT19937", *rngdict_ );
+  register_rng_< librandom::Philox >( "philox", *rngdict_ );
 
   // let GslRandomGen add all of the GSL rngs
   librandom::GslRandomGen::add_gsl_rngs( *rngdict_ );
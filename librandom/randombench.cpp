@@ -0,0 +1,178 @@
+/*
+ *  randombench.cpp
+ *
+ *  This file is part of NEST.
+ *
+ *  Copyright (C) 2004 The NEST Initiative
+ *
+ *  NEST is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  NEST is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with NEST.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+
+// C++ includes:
+#include <ctime>
+#include <iomanip>
+#include <iostream>
+#include <vector>
+
+// Generated includes:
+#include "config.h"
+
+// Includes from librandom:
+#include "gslrandomgen.h"
+#include "knuthlfg.h"
+#include "mt19937.h"
+#include "philox.h"
+#include "random_datums.h"
+#include "randomgen.h"
+#include "typed_randomgen.h"
+
+// Includes from sli:
+#include "dict.h"
+#include "dictdatum.h"
+#include "token.h"
+#include "tokenutils.h"
+
+/* Compare the throughput of the different ways of drawing uniform
+   numbers from all available random generators:
+   - virtual: one virtual call per number, as through RngPtr
+   - block:   drand( v, n ), one virtual call per block
+   - typed:   TypedRandomGen via with_typed_rng(), no virtual calls
+   All three must draw the same numbers, which is checked by
+   comparing the sums after re-seeding.                            */
+
+// how many numbers to draw per generator and mode
+const unsigned long Ngen = 20000000UL;
+const unsigned long Nblock = 64;
+const unsigned long seed = 1234567890UL;
+
+double
+draw_virtual( librandom::RngPtr rng, const unsigned long N )
+{
+  double sum = 0;
+  for ( unsigned long k = 0; k < N; ++k )
+  {
+    sum += rng->drand();
+  }
+  return sum;
+}
+
+double
+draw_block( librandom::RngPtr rng, const unsigned long N )
+{
+  std::vector< double > v( Nblock );
+  double sum = 0;
+  for ( unsigned long k = 0; k < N; k += Nblock )
+  {
+    rng->drand( &v[ 0 ], Nblock );
+    for ( unsigned long j = 0; j < Nblock; ++j )
+    {
+      sum += v[ j ];
+    }
+  }
+  return sum;
+}
+
+struct DrawTyped
+{
+  unsigned long N;
+  double sum;
+
+  template < typename TypedRng >
+  void
+  operator()( TypedRng& trng )
+  {
+    for ( unsigned long k = 0; k < N; ++k )
+    {
+      sum += trng.drand();
+    }
+  }
+};
+
+double
+draw_typed( librandom::RngPtr rng, const unsigned long N )
+{
+  DrawTyped draw = { N, 0.0 };
+  librandom::with_typed_rng( *rng, draw );
+  return draw.sum;
+}
+
+// time one drawing mode, return ns per number
+double
+run( double ( *draw )( librandom::RngPtr, const unsigned long ), librandom::RngPtr rng, double& sum )
+{
+  rng->seed( seed );
+  const std::clock_t t1 = std::clock();
+  sum = draw( rng, Ngen );
+  const std::clock_t t2 = std::clock();
+  return double( t2 - t1 ) / CLOCKS_PER_SEC * 1e9 / Ngen;
+}
+
+template < typename NumberGenerator >
+void
+register_rng( const std::string& name, DictionaryDatum& dict )
+{
+  Token rngfactory = new librandom::RngFactoryDatum( new librandom::BuiltinRNGFactory< NumberGenerator > );
+  dict->insert_move( Name( name ), rngfactory );
+}
+
+
+int
+main( void )
+{
+  // create random number generator type dictionary
+  Dictionary rngdict;
+  DictionaryDatum rngdictd( rngdict );
+
+  // add non-GSL rngs
+  register_rng< librandom::KnuthLFG >( "KnuthLFG", rngdictd );
+  register_rng< librandom::MT19937 >( "MT19937", rngdictd );
+  register_rng< librandom::Philox >( "philox", rngdictd );
+
+  // let GslRandomGen add all of the GSL rngs
+  librandom::GslRandomGen::add_gsl_rngs( rngdict );
+
+  std::cout << std::endl
+            << "===========================================================" << std::endl
+            << std::endl;
+  std::cout << "Drawing " << Ngen << " numbers per generator, ns per number" << std::endl;
+  std::cout << "-----------------------------------------------------------" << std::endl;
+  std::cout << std::left << std::setw( 25 ) << "generator"
+            << "  virtual    block    typed" << std::endl;
+
+  bool all_equal = true;
+  for ( Dictionary::const_iterator it = rngdict.begin(); it != rngdict.end(); ++it )
+  {
+    librandom::RngFactoryDatum fd = getValue< librandom::RngFactoryDatum >( it->second );
+    librandom::RngPtr rp = fd->create( librandom::RandomGen::DefaultSeed );
+
+    double sum_virtual, sum_block, sum_typed;
+    const double dt_virtual = run( draw_virtual, rp, sum_virtual );
+    const double dt_block = run( draw_block, rp, sum_block );
+    const double dt_typed = run( draw_typed, rp, sum_typed );
+
+    const bool equal = sum_virtual == sum_block and sum_virtual == sum_typed;
+    all_equal = all_equal and equal;
+
+    std::cout << std::left << std::setw( 25 ) << it->first << ": " << std::right << std::fixed
+              << std::setprecision( 2 ) << std::setw( 7 ) << dt_virtual << "  " << std::setw( 7 ) << dt_block
+              << "  " << std::setw( 7 ) << dt_typed << ( equal ? "" : "  (numbers differ)" ) << std::endl;
+  }
+
+  std::cout << std::endl
+            << "===========================================================" << std::endl;
+
+  return all_equal ? 0 : 1;
+}
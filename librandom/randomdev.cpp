@@ -31,6 +31,15 @@ long librandom::RandomDev::ldev( RngPtr ) const
   return 0;
 }
 
+void
+librandom::RandomDev::ldev( RngPtr r, long* v, const size_t n ) const
+{
+  for ( size_t i = 0; i < n; ++i )
+  {
+    v[ i ] = ldev( r );
+  }
+}
+
 void
 librandom::RandomDev::get_status( DictionaryDatum& dict ) const
 {
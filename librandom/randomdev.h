@@ -169,6 +169,18 @@ public:
   virtual long ldev( void );
   virtual long ldev( RngPtr ) const;
 
+  /**
+   * Draw n integers into v, single-threaded.
+   * The numbers are the same as those of n calls to ldev().
+   */
+  void ldev( long* v, const size_t n );
+
+  /**
+   * Draw n integers into v, multi-threaded.
+   * The default implementation calls ldev( RngPtr ) n times.
+   */
+  virtual void ldev( RngPtr, long* v, const size_t n ) const;
+
   /**
    * true if RDG implements ldev function
    */
@@ -224,6 +236,13 @@ RandomDev::ldev( void )
   return this->ldev( rng_ );
 }
 
+inline void
+RandomDev::ldev( long* v, const size_t n )
+{
+  assert( rng_.valid() );
+  this->ldev( rng_, v, n );
+}
+
 
 /**
  * Generic factory class for RandomDev.
@@ -24,6 +24,7 @@
 
 // Includes from librandom:
 #include "knuthlfg.h"
+#include "librandom_exceptions.h"
 
 const unsigned long librandom::RandomGen::DefaultSeed = 0xd37ca59fUL;
 
@@ -39,3 +40,15 @@ librandom::RandomGen::create_knuthlfg_rng( unsigned long seed )
 {
   return librandom::RngPtr( new librandom::KnuthLFG( seed ) );
 }
+
+void
+librandom::RandomGen::save_state( std::ostream& ) const
+{
+  throw UnsuitableRNG( "The random generator does not support saving its state." );
+}
+
+void
+librandom::RandomGen::load_state( std::istream& )
+{
+  throw UnsuitableRNG( "The random generator does not support restoring its state." );
+}
@@ -111,6 +111,7 @@
  * double drand()              [0, 1)
  *        ()                   [0, 1)
  * double drandpos()           (0, 1)
+ * void   drand(v, n)          n numbers from [0, 1) into v
  * unsigned long  ulrand(N)            [0, N-1]
  *
  * void   seed(N)              seed the RNG, N: unsigned long
@@ -128,12 +129,13 @@
  * @note
  * For a list of available RNGs, see rngdict info in SLI.
  *
- * NEST comes at present with two built-in random number generators:
+ * NEST comes at present with three built-in random number generators:
  * - knuthlfg, the lagged Fibonacci generator from D.E.Knuth,
  *   The Art of Computer Programming, 3rd ed, vol 2, sec 3.6.
  * - MT19937, the Mersenne Twister by Matsumoto and Nishimura.
- * Implementations of both are directly derived from free code published
- * by the original authors.
+ * - philox, the counter-based Philox4x32-10 generator by Salmon et al.
+ * Implementations of the first two are directly derived from free code
+ * published by the original authors.
  *
  * If the GNU Scientific Library (v 1.2 or later) is installed,
  * all uniform random number generators from the GSL are made available,
@@ -193,6 +195,8 @@
 
 // C++ includes:
 #include <cmath>
+#include <cstddef>
+#include <iosfwd>
 #include <vector>
 
 // Includes from libnestutil:
@@ -218,6 +222,10 @@ class RandomGen;
  */
 typedef lockPTR< RandomGen > RngPtr;
 
+//! Non-virtual access to generators of known type, see typed_randomgen.h
+template < typename Generator >
+class TypedRandomGen;
+
 /**
  * Abstract base class for all random generator objects
  *
@@ -234,6 +242,9 @@ typedef lockPTR< RandomGen > RngPtr;
 
 class RandomGen
 {
+  template < typename Generator >
+  friend class TypedRandomGen;
+
 public:
   /**
    * @note All classes derived from RandomGen should
@@ -257,6 +268,13 @@ public:
   double drandpos( void );                     //!< draw from (0, 1)
   unsigned long ulrand( const unsigned long ); //!< draw from [0, n-1]
 
+  /**
+   * Draw n numbers from [0, 1) into v.
+   * The numbers are the same as those of n calls to drand(), but
+   * they are drawn with a single virtual call.
+   */
+  void drand( double* v, const size_t n );
+
   void seed( const unsigned long ); //!< set random seed to a new value
 
   /**
@@ -273,6 +291,20 @@ public:
   //! clone a random number generator of same type initialized with given seed
   virtual RngPtr clone( const unsigned long ) = 0;
 
+  /**
+   * Write the state of the generator to a binary stream.
+   * A generator of the same type restored from the stream by load_state()
+   * continues with the same numbers as this generator.
+   * @throws UnsuitableRNG if the generator does not support this
+   */
+  virtual void save_state( std::ostream& ) const;
+
+  /**
+   * Restore the state written by save_state().
+   * @throws UnsuitableRNG if the generator does not support this
+   */
+  virtual void load_state( std::istream& );
+
 protected:
   /**
      The following functions provide the interface to the actual
@@ -282,6 +314,12 @@ protected:
   virtual void seed_( unsigned long ) = 0; //!< seeding interface
   virtual double drand_() = 0;             //!< drawing interface
 
+  /**
+   * Block drawing interface. Generators should override this with a
+   * loop over their own, non-virtual drawing function.
+   */
+  virtual void drand_array_( double*, const size_t );
+
 private:
   // prohibit copying of RNG
   RandomGen( const RandomGen& );
@@ -329,6 +367,21 @@ RandomGen::drand( void )
   return drand_();
 }
 
+inline void
+RandomGen::drand( double* v, const size_t n )
+{
+  drand_array_( v, n );
+}
+
+inline void
+RandomGen::drand_array_( double* v, const size_t n )
+{
+  for ( size_t i = 0; i < n; ++i )
+  {
+    v[ i ] = drand_();
+  }
+}
+
 inline double RandomGen::operator()( void )
 {
   return drand();
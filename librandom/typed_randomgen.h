@@ -0,0 +1,174 @@
+/*
+ *  typed_randomgen.h
+ *
+ *  This file is part of NEST.
+ *
+ *  Copyright (C) 2004 The NEST Initiative
+ *
+ *  NEST is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  NEST is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with NEST.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifndef TYPED_RANDOMGEN_H
+#define TYPED_RANDOMGEN_H
+
+// C++ includes:
+#include <cmath>
+#include <cstddef>
+
+// Generated includes:
+#include "config.h"
+
+// Includes from librandom:
+#include "gslrandomgen.h"
+#include "knuthlfg.h"
+#include "mt19937.h"
+#include "philox.h"
+#include "randomgen.h"
+
+namespace librandom
+{
+
+/**
+ * Access to a random generator of known type without virtual calls.
+ *
+ * TypedRandomGen< Generator > provides the drawing interface of
+ * RandomGen for a generator whose type is known at compile time.
+ * Calls are bound statically to Generator::drand_(), so that hot loops
+ * templated on the generator type can inline the draws. The numbers
+ * drawn are exactly those drawn by the corresponding RandomGen
+ * functions, and draws through TypedRandomGen and through RandomGen
+ * (e.g. via an RngPtr to the same generator) may be interleaved freely.
+ *
+ * TypedRandomGen< RandomGen > falls back to virtual calls, for
+ * generators not known to with_typed_rng().
+ *
+ * @see with_typed_rng()
+ */
+template < typename Generator >
+class TypedRandomGen
+{
+public:
+  explicit TypedRandomGen( Generator& rng )
+    : rng_( rng )
+  {
+  }
+
+  double drand();                        //!< draw from [0, 1)
+  double drandpos();                     //!< draw from (0, 1)
+  unsigned long ulrand( unsigned long ); //!< draw from [0, n-1]
+
+  //! draw n numbers from [0, 1) into v
+  void drand( double* v, const size_t n );
+
+private:
+  Generator& rng_;
+};
+
+template < typename Generator >
+inline double
+TypedRandomGen< Generator >::drand()
+{
+  return rng_.Generator::drand_();
+}
+
+template <>
+inline double
+TypedRandomGen< RandomGen >::drand()
+{
+  return rng_.drand_();
+}
+
+template < typename Generator >
+inline void
+TypedRandomGen< Generator >::drand( double* v, const size_t n )
+{
+  for ( size_t i = 0; i < n; ++i )
+  {
+    v[ i ] = drand();
+  }
+}
+
+template <>
+inline void
+TypedRandomGen< RandomGen >::drand( double* v, const size_t n )
+{
+  rng_.drand( v, n );
+}
+
+template < typename Generator >
+inline double
+TypedRandomGen< Generator >::drandpos()
+{
+  double r;
+
+  do
+  {
+    r = drand();
+  } while ( r == 0.0 );
+
+  return r;
+}
+
+template < typename Generator >
+inline unsigned long
+TypedRandomGen< Generator >::ulrand( const unsigned long n )
+{
+  return static_cast< unsigned long >( std::floor( n * drand() ) );
+}
+
+/**
+ * Call f( TypedRandomGen< G >& ) with G the dynamic type of rng.
+ *
+ * G is one of MT19937, KnuthLFG, Philox or GslRandomGen; f is called with a
+ * TypedRandomGen< RandomGen > for all other generators. F must provide
+ * a templated operator(). Since the type is determined by dynamic_cast,
+ * with_typed_rng() should wrap loops over many draws, not single draws.
+ */
+template < typename F >
+void
+with_typed_rng( RandomGen& rng, F& f )
+{
+  if ( MT19937* const mt = dynamic_cast< MT19937* >( &rng ) )
+  {
+    TypedRandomGen< MT19937 > trng( *mt );
+    f( trng );
+  }
+  else if ( KnuthLFG* const lfg = dynamic_cast< KnuthLFG* >( &rng ) )
+  {
+    TypedRandomGen< KnuthLFG > trng( *lfg );
+    f( trng );
+  }
+  else if ( Philox* const phi = dynamic_cast< Philox* >( &rng ) )
+  {
+    TypedRandomGen< Philox > trng( *phi );
+    f( trng );
+  }
+#ifdef HAVE_GSL
+  else if ( GslRandomGen* const gsl = dynamic_cast< GslRandomGen* >( &rng ) )
+  {
+    TypedRandomGen< GslRandomGen > trng( *gsl );
+    f( trng );
+  }
+#endif
+  else
+  {
+    TypedRandomGen< RandomGen > trng( rng );
+    f( trng );
+  }
+}
+
+} // namespace librandom
+
+#endif // TYPED_RANDOMGEN_H
@@ -33,6 +33,10 @@
 
 // Includes from libnestutil:
 #include "numerics.h"
+#include "simd.h"
+
+// Includes from models:
+#include "aeif_cond_batch.h"
 
 // Includes from nestkernel:
 #include "exceptions.h"
@@ -538,6 +542,73 @@ nest::aeif_cond_alpha::update( Time const& origin, const long from, const long t
   }
 }
 
+/* ----------------------------------------------------------------
+ * Batch update
+ * ---------------------------------------------------------------- */
+
+namespace nest
+{
+
+template <>
+void
+AeifCondBatch< aeif_cond_alpha >::load_synapses( const size_t i, const aeif_cond_alpha& node )
+{
+  g0_ex[ i ] = node.V_.g0_ex_;
+  g0_in[ i ] = node.V_.g0_in_;
+}
+
+template <>
+void
+AeifCondBatch< aeif_cond_alpha >::synaptic_dynamics( const double state[], double f[] ) const
+{
+  // same operations as in aeif_cond_alpha_dynamics()
+  for ( size_t i = 0; i < max_size; i += simd::width )
+  {
+    const simd::Double dg_ex = simd::load( &state[ State_::DG_EXC * max_size + i ] );
+    const simd::Double g_ex = simd::load( &state[ State_::G_EXC * max_size + i ] );
+    const simd::Double dg_in = simd::load( &state[ State_::DG_INH * max_size + i ] );
+    const simd::Double g_in = simd::load( &state[ State_::G_INH * max_size + i ] );
+    const simd::Double tau_ex = simd::load( &tau_syn_ex[ i ] );
+    const simd::Double tau_in = simd::load( &tau_syn_in[ i ] );
+
+    simd::store( &f[ State_::DG_EXC * max_size + i ], simd::div( simd::neg( dg_ex ), tau_ex ) );
+    simd::store( &f[ State_::G_EXC * max_size + i ], simd::sub( dg_ex, simd::div( g_ex, tau_ex ) ) );
+    simd::store( &f[ State_::DG_INH * max_size + i ], simd::div( simd::neg( dg_in ), tau_in ) );
+    simd::store( &f[ State_::G_INH * max_size + i ], simd::sub( dg_in, simd::div( g_in, tau_in ) ) );
+  }
+}
+
+template <>
+void
+AeifCondBatch< aeif_cond_alpha >::add_spikes( const size_t step )
+{
+  const double* const spikes_ex = &input[ SPIKES_EX ][ step * max_size ];
+  const double* const spikes_in = &input[ SPIKES_IN ][ step * max_size ];
+  double* const dg_ex = &y[ State_::DG_EXC * max_size ];
+  double* const dg_in = &y[ State_::DG_INH * max_size ];
+  for ( size_t i = 0; i < size; ++i )
+  {
+    dg_ex[ i ] += spikes_ex[ i ] * g0_ex[ i ];
+    dg_in[ i ] += spikes_in[ i ] * g0_in[ i ];
+  }
+}
+
+} // namespace nest
+
+void
+nest::aeif_cond_alpha::update_batch( std::vector< Node* >::const_iterator first,
+  std::vector< Node* >::const_iterator last,
+  Time const& origin,
+  const long from,
+  const long to )
+{
+  assert( to >= 0 && ( delay ) from < kernel().connection_manager.get_min_delay() );
+
+  // zero-initialized, including the integrator, see AeifCondBatch::dynamics()
+  AeifCondBatch< aeif_cond_alpha > batch = AeifCondBatch< aeif_cond_alpha >();
+  batch.update( first, last, origin, from, to );
+}
+
 void
 nest::aeif_cond_alpha::handle( SpikeEvent& e )
 {
@@ -0,0 +1,312 @@
+/*
+ *  aeif_cond_batch.h
+ *
+ *  This file is part of NEST.
+ *
+ *  Copyright (C) 2004 The NEST Initiative
+ *
+ *  NEST is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  NEST is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with NEST.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifndef AEIF_COND_BATCH_H
+#define AEIF_COND_BATCH_H
+
+// Generated includes:
+#include "config.h"
+
+#ifdef HAVE_GSL
+
+// C++ includes:
+#include <algorithm>
+#include <cmath>
+
+// Includes from libnestutil:
+#include "batch_rkf45.h"
+#include "simd.h"
+
+// Includes from nestkernel:
+#include "exceptions.h"
+
+// Includes from models:
+#include "batch_update.h"
+
+namespace nest
+{
+
+/**
+ * Batched update of aeif_cond_alpha and aeif_cond_exp, see BatchUpdate.
+ *
+ * All neurons of a batch are advanced by BatchRKF45, each with its own
+ * adaptive step size, in the same steps as taken by the GSL solver in
+ * NodeT::update(). The models differ only in their synaptic
+ * conductances, for which each model specializes load_synapses(),
+ * synaptic_dynamics() and add_spikes().
+ */
+template < class NodeT >
+class AeifCondBatch : public BatchUpdate< AeifCondBatch< NodeT >, NodeT, 3 >
+{
+  typedef BatchUpdate< AeifCondBatch< NodeT >, NodeT, 3 > Base;
+  typedef typename NodeT::State_ State_;
+
+public:
+  using Base::max_size;
+
+  //! Input channels
+  enum Input
+  {
+    SPIKES_EX = 0,
+    SPIKES_IN,
+    CURRENTS
+  };
+
+  void load_node( const size_t i, const NodeT& node );
+  void load_input( const size_t i, const long from, const long to );
+  void store( const size_t i, const size_t step ) const;
+  void integrate( const size_t step );
+
+  //! Number of spikes emitted by neuron i in the last step
+  unsigned int
+  spike_count( const size_t i ) const
+  {
+    return n_spikes[ i ];
+  }
+
+  /**
+   * Right-hand side of the ODEs of all max_size neurons, see
+   * aeif_cond_alpha_dynamics() and aeif_cond_exp_dynamics().
+   */
+  void dynamics( const double state[], double f[] ) const;
+
+  //! Check for a spike after an integration step of neuron i, as update()
+  void step_taken( const size_t i );
+
+private:
+  using Base::size;
+  using Base::nodes;
+  using Base::input;
+
+  //! Load the synaptic parameters of node into entry i
+  void load_synapses( const size_t i, const NodeT& node );
+
+  //! Right-hand side of the ODEs of the synaptic conductances
+  void synaptic_dynamics( const double state[], double f[] ) const;
+
+  //! Add the spikes arriving at the given step of the slice
+  void add_spikes( const size_t step );
+
+  typedef BatchRKF45< AeifCondBatch, State_::STATE_VEC_SIZE, max_size > Integrator;
+
+  //! State vectors, element d of neuron i at y[ d * max_size + i ]
+  double y[ State_::STATE_VEC_SIZE * max_size ];
+  double r[ max_size ]; //!< refractory counts, held as doubles to fit into vectors
+  double IntegrationStep[ max_size ];
+  double I_stim[ max_size ];
+
+  double V_peak_[ max_size ]; //!< P_.V_peak_, bound of V_m in the dynamics
+  double V_reset[ max_size ];
+  double g_L[ max_size ];
+  double C_m[ max_size ];
+  double E_ex[ max_size ];
+  double E_in[ max_size ];
+  double E_L[ max_size ];
+  double Delta_T[ max_size ];
+  double tau_w[ max_size ];
+  double a[ max_size ];
+  double b[ max_size ];
+  double V_th[ max_size ];
+  double tau_syn_ex[ max_size ];
+  double tau_syn_in[ max_size ];
+  double I_e[ max_size ];
+
+  double g0_ex[ max_size ]; //!< used by aeif_cond_alpha only
+  double g0_in[ max_size ]; //!< used by aeif_cond_alpha only
+  double V_peak[ max_size ]; //!< V_.V_peak, threshold for spike detection
+  double refractory_counts[ max_size ];
+
+  double resolution; //!< simulation step size in ms
+
+  unsigned int n_spikes[ max_size ]; //!< spikes emitted in the current step
+
+  Integrator integrator;
+};
+
+template < class NodeT >
+void
+AeifCondBatch< NodeT >::load_node( const size_t i, const NodeT& node )
+{
+  const State_& S = node.S_;
+  for ( size_t d = 0; d < State_::STATE_VEC_SIZE; ++d )
+  {
+    y[ d * max_size + i ] = S.y_[ d ];
+  }
+  r[ i ] = S.r_;
+
+  IntegrationStep[ i ] = node.B_.IntegrationStep_;
+  I_stim[ i ] = node.B_.I_stim_;
+  resolution = node.B_.step_;
+
+  V_peak_[ i ] = node.P_.V_peak_;
+  V_reset[ i ] = node.P_.V_reset_;
+  g_L[ i ] = node.P_.g_L;
+  C_m[ i ] = node.P_.C_m;
+  E_ex[ i ] = node.P_.E_ex;
+  E_in[ i ] = node.P_.E_in;
+  E_L[ i ] = node.P_.E_L;
+  Delta_T[ i ] = node.P_.Delta_T;
+  tau_w[ i ] = node.P_.tau_w;
+  a[ i ] = node.P_.a;
+  b[ i ] = node.P_.b;
+  V_th[ i ] = node.P_.V_th;
+  tau_syn_ex[ i ] = node.P_.tau_syn_ex;
+  tau_syn_in[ i ] = node.P_.tau_syn_in;
+  I_e[ i ] = node.P_.I_e;
+  integrator.set_tolerance( i, node.P_.gsl_error_tol, node.P_.gsl_error_tol );
+
+  V_peak[ i ] = node.V_.V_peak;
+  refractory_counts[ i ] = node.V_.refractory_counts_;
+
+  load_synapses( i, node );
+}
+
+template < class NodeT >
+void
+AeifCondBatch< NodeT >::load_input( const size_t i, const long from, const long to )
+{
+  nodes[ i ]->B_.spike_exc_.get_values( from, to, &input[ SPIKES_EX ][ i ], max_size );
+  nodes[ i ]->B_.spike_inh_.get_values( from, to, &input[ SPIKES_IN ][ i ], max_size );
+  nodes[ i ]->B_.currents_.get_values( from, to, &input[ CURRENTS ][ i ], max_size );
+}
+
+template < class NodeT >
+void
+AeifCondBatch< NodeT >::store( const size_t i, const size_t ) const
+{
+  State_& S = nodes[ i ]->S_;
+  for ( size_t d = 0; d < State_::STATE_VEC_SIZE; ++d )
+  {
+    S.y_[ d ] = y[ d * max_size + i ];
+  }
+  S.r_ = static_cast< unsigned int >( r[ i ] );
+
+  nodes[ i ]->B_.IntegrationStep_ = IntegrationStep[ i ];
+  nodes[ i ]->B_.I_stim_ = I_stim[ i ];
+}
+
+template < class NodeT >
+void
+AeifCondBatch< NodeT >::dynamics( const double state[], double f[] ) const
+{
+  const double* const V_m = &state[ State_::V_M * max_size ];
+  const double* const g_ex = &state[ State_::G_EXC * max_size ];
+  const double* const g_in = &state[ State_::G_INH * max_size ];
+  const double* const w = &state[ State_::W * max_size ];
+
+  // The exponential is computed by the scalar std::exp, as in update().
+  double V[ max_size ];
+  double I_spike[ max_size ];
+  for ( size_t i = 0; i < max_size; ++i )
+  {
+    V[ i ] = r[ i ] > 0 ? V_reset[ i ] : std::min( V_m[ i ], V_peak_[ i ] );
+    I_spike[ i ] =
+      Delta_T[ i ] == 0. ? 0. : ( g_L[ i ] * Delta_T[ i ] * std::exp( ( V[ i ] - V_th[ i ] ) / Delta_T[ i ] ) );
+  }
+
+  // Same operations in the same order as in the scalar dynamics, with
+  // the branch on the refractory state replaced by a selection.
+  const simd::Double zero = simd::set1( 0. );
+  for ( size_t i = 0; i < max_size; i += simd::width )
+  {
+    const simd::Double v = simd::load( &V[ i ] );
+    const simd::Double w_i = simd::load( &w[ i ] );
+    const simd::Double v_E_L = simd::sub( v, simd::load( &E_L[ i ] ) );
+
+    const simd::Double I_syn_exc = simd::mul( simd::load( &g_ex[ i ] ), simd::sub( v, simd::load( &E_ex[ i ] ) ) );
+    const simd::Double I_syn_inh = simd::mul( simd::load( &g_in[ i ] ), simd::sub( v, simd::load( &E_in[ i ] ) ) );
+
+    // -g_L * ( V - E_L ) + I_spike is computed as I_spike - g_L * ( V - E_L )
+    simd::Double dV = simd::sub( simd::load( &I_spike[ i ] ), simd::mul( simd::load( &g_L[ i ] ), v_E_L ) );
+    dV = simd::sub( dV, I_syn_exc );
+    dV = simd::sub( dV, I_syn_inh );
+    dV = simd::sub( dV, w_i );
+    dV = simd::add( dV, simd::load( &I_e[ i ] ) );
+    dV = simd::add( dV, simd::load( &I_stim[ i ] ) );
+    dV = simd::div( dV, simd::load( &C_m[ i ] ) );
+    simd::store( &f[ State_::V_M * max_size + i ], simd::select( simd::eq( simd::load( &r[ i ] ), zero ), dV, zero ) );
+
+    const simd::Double dw = simd::sub( simd::mul( simd::load( &a[ i ] ), v_E_L ), w_i );
+    simd::store( &f[ State_::W * max_size + i ], simd::div( dw, simd::load( &tau_w[ i ] ) ) );
+  }
+
+  synaptic_dynamics( state, f );
+}
+
+template < class NodeT >
+void
+AeifCondBatch< NodeT >::step_taken( const size_t i )
+{
+  double& V_m = y[ State_::V_M * max_size + i ];
+  double& w = y[ State_::W * max_size + i ];
+
+  // check for unreasonable values; we allow V_M to explode
+  if ( V_m < -1e3 || w < -1e6 || w > 1e6 )
+  {
+    throw NumericalInstability( nodes[ i ]->get_name() );
+  }
+
+  if ( r[ i ] > 0 )
+  {
+    V_m = V_reset[ i ];
+  }
+  else if ( V_m >= V_peak[ i ] )
+  {
+    V_m = V_reset[ i ];
+    w += b[ i ]; // spike-driven adaptation
+    r[ i ] = refractory_counts[ i ] > 0 ? refractory_counts[ i ] + 1 : 0;
+    ++n_spikes[ i ];
+  }
+}
+
+template < class NodeT >
+void
+AeifCondBatch< NodeT >::integrate( const size_t step )
+{
+  for ( size_t i = 0; i < size; ++i )
+  {
+    n_spikes[ i ] = 0;
+  }
+
+  integrator.evolve( *this, size, resolution, IntegrationStep, y );
+
+  const double* const current = &input[ CURRENTS ][ step * max_size ];
+  for ( size_t i = 0; i < size; ++i )
+  {
+    // decrement refractory count
+    if ( r[ i ] > 0 )
+    {
+      --r[ i ];
+    }
+
+    // set new input current
+    I_stim[ i ] = current[ i ];
+  }
+
+  add_spikes( step );
+}
+
+} // namespace nest
+
+#endif // HAVE_GSL
+
+#endif // AEIF_COND_BATCH_H
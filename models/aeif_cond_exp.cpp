@@ -33,6 +33,10 @@
 
 // Includes from libnestutil:
 #include "numerics.h"
+#include "simd.h"
+
+// Includes from models:
+#include "aeif_cond_batch.h"
 
 // Includes from nestkernel:
 #include "exceptions.h"
@@ -529,6 +533,65 @@ nest::aeif_cond_exp::update( const Time& origin, const long from, const long to
   }
 }
 
+/* ----------------------------------------------------------------
+ * Batch update
+ * ---------------------------------------------------------------- */
+
+namespace nest
+{
+
+template <>
+void
+AeifCondBatch< aeif_cond_exp >::load_synapses( const size_t, const aeif_cond_exp& )
+{
+}
+
+template <>
+void
+AeifCondBatch< aeif_cond_exp >::synaptic_dynamics( const double state[], double f[] ) const
+{
+  // same operations as in aeif_cond_exp_dynamics()
+  for ( size_t i = 0; i < max_size; i += simd::width )
+  {
+    const simd::Double g_ex = simd::load( &state[ State_::G_EXC * max_size + i ] );
+    const simd::Double g_in = simd::load( &state[ State_::G_INH * max_size + i ] );
+
+    simd::store( &f[ State_::G_EXC * max_size + i ], simd::div( simd::neg( g_ex ), simd::load( &tau_syn_ex[ i ] ) ) );
+    simd::store( &f[ State_::G_INH * max_size + i ], simd::div( simd::neg( g_in ), simd::load( &tau_syn_in[ i ] ) ) );
+  }
+}
+
+template <>
+void
+AeifCondBatch< aeif_cond_exp >::add_spikes( const size_t step )
+{
+  const double* const spikes_ex = &input[ SPIKES_EX ][ step * max_size ];
+  const double* const spikes_in = &input[ SPIKES_IN ][ step * max_size ];
+  double* const g_ex = &y[ State_::G_EXC * max_size ];
+  double* const g_in = &y[ State_::G_INH * max_size ];
+  for ( size_t i = 0; i < size; ++i )
+  {
+    g_ex[ i ] += spikes_ex[ i ];
+    g_in[ i ] += spikes_in[ i ];
+  }
+}
+
+} // namespace nest
+
+void
+nest::aeif_cond_exp::update_batch( std::vector< Node* >::const_iterator first,
+  std::vector< Node* >::const_iterator last,
+  const Time& origin,
+  const long from,
+  const long to )
+{
+  assert( to >= 0 && ( delay ) from < kernel().connection_manager.get_min_delay() );
+
+  // zero-initialized, including the integrator, see AeifCondBatch::dynamics()
+  AeifCondBatch< aeif_cond_exp > batch = AeifCondBatch< aeif_cond_exp >();
+  batch.update( first, last, origin, from, to );
+}
+
 void
 nest::aeif_cond_exp::handle( SpikeEvent& e )
 {
@@ -44,6 +44,12 @@
 
 namespace nest
 {
+
+template < class ModelBatch, class NodeT, size_t num_inputs >
+class BatchUpdate;
+template < class NodeT >
+class AeifCondBatch;
+
 /**
  * Function computing right-hand side of ODE for GSL solver if Delta_T != 0.
  * @note Must be declared here so we can befriend it in class.
@@ -204,6 +210,11 @@ private:
   void init_buffers_();
   void calibrate();
   void update( const Time&, const long, const long );
+  void update_batch( std::vector< Node* >::const_iterator,
+    std::vector< Node* >::const_iterator,
+    const Time&,
+    const long,
+    const long );
 
   // END Boilerplate function declarations ----------------------------
 
@@ -216,6 +227,12 @@ private:
   friend class RecordablesMap< aeif_cond_exp >;
   friend class UniversalDataLogger< aeif_cond_exp >;
 
+  // The batched update in update_batch() needs access to the state,
+  // parameters and buffers
+  template < class ModelBatch, class NodeT, size_t num_inputs >
+  friend class BatchUpdate;
+  friend class AeifCondBatch< aeif_cond_exp >;
+
 private:
   // ----------------------------------------------------------------
 
@@ -0,0 +1,218 @@
+/*
+ *  batch_update.h
+ *
+ *  This file is part of NEST.
+ *
+ *  Copyright (C) 2004 The NEST Initiative
+ *
+ *  NEST is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  NEST is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with NEST.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifndef BATCH_UPDATE_H
+#define BATCH_UPDATE_H
+
+// C++ includes:
+#include <cassert>
+#include <vector>
+
+// Includes from nestkernel:
+#include "event.h"
+#include "event_delivery_manager_impl.h"
+#include "kernel_manager.h"
+#include "nest_time.h"
+#include "nest_types.h"
+#include "node.h"
+
+namespace nest
+{
+
+/**
+ * Skeleton of the batched update of neuron models, see Node::update_batch().
+ *
+ * A batch holds up to max_size neurons of model NodeT in
+ * structure-of-arrays layout, together with num_inputs input channels of
+ * the current time slice, and integrates all neurons step by step. The
+ * model-specific batch ModelBatch derives from BatchUpdate, holds the
+ * state variables, parameters and propagators of the neurons, and
+ * provides
+ *
+ * - void load_node( size_t i, const NodeT& node ): copy the state of
+ *   node into entry i,
+ * - void load_input( size_t i, long from, long to ): read the input of
+ *   steps from to to-1 of entry i into input[ k ][ step * max_size + i ],
+ * - void integrate( size_t step ): integrate all entries by the given step
+ *   of the slice and set spiked,
+ * - void store( size_t i, size_t step ) const: write entry i after the
+ *   given step back to its node,
+ * - bool update_individually() const: if true, the neurons loaded last
+ *   are updated by NodeT::update() instead,
+ * - unsigned int spike_count( size_t i ) const: number of spikes emitted
+ *   by entry i in the last step, for models that can spike more than
+ *   once per step; by default 1 if spiked[ i ] is set, else 0.
+ *
+ * Models that integrate vectors extending past size into unused entries
+ * must value-initialize ModelBatch, so that these operate on initialized
+ * values. NodeT must declare BatchUpdate a friend.
+ */
+template < class ModelBatch, class NodeT, size_t num_inputs >
+class BatchUpdate
+{
+public:
+  //! Neurons per batch, small enough to keep the input of a slice in L1 cache;
+  //! a multiple of simd::width
+  static const size_t max_size = 8;
+
+  /**
+   * Update the nodes in [first, last) from step from to step to-1 of the
+   * slice starting at origin.
+   */
+  void update( std::vector< Node* >::const_iterator first,
+    const std::vector< Node* >::const_iterator& last,
+    const Time& origin,
+    const long from,
+    const long to );
+
+  bool
+  update_individually() const
+  {
+    return false;
+  }
+
+  unsigned int
+  spike_count( const size_t i ) const
+  {
+    return spiked[ i ];
+  }
+
+protected:
+  size_t size;
+  NodeT* nodes[ max_size ];
+  bool recorded[ max_size ]; //!< true if a multimeter records from the neuron
+  bool spiked[ max_size ];
+
+  //! Input of all steps of the slice, max_size entries per step
+  double* input[ num_inputs ];
+
+private:
+  /**
+   * Copy up to max_size neurons from [first, last), skipping frozen ones,
+   * and advance first past the neurons taken.
+   */
+  void load_( std::vector< Node* >::const_iterator& first, const std::vector< Node* >::const_iterator& last );
+};
+
+template < class ModelBatch, class NodeT, size_t num_inputs >
+void
+BatchUpdate< ModelBatch, NodeT, num_inputs >::load_( std::vector< Node* >::const_iterator& first,
+  const std::vector< Node* >::const_iterator& last )
+{
+  ModelBatch& batch = static_cast< ModelBatch& >( *this );
+
+  size = 0;
+  for ( ; first != last and size < max_size; ++first )
+  {
+    if ( ( *first )->is_frozen() )
+    {
+      continue;
+    }
+
+    NodeT* const node = static_cast< NodeT* >( *first );
+    const size_t i = size++;
+    nodes[ i ] = node;
+    recorded[ i ] = node->B_.logger_.has_data_loggers();
+    batch.load_node( i, *node );
+  }
+}
+
+template < class ModelBatch, class NodeT, size_t num_inputs >
+void
+BatchUpdate< ModelBatch, NodeT, num_inputs >::update( std::vector< Node* >::const_iterator first,
+  const std::vector< Node* >::const_iterator& last,
+  const Time& origin,
+  const long from,
+  const long to )
+{
+  assert( first != last );
+  assert( from < to );
+
+  ModelBatch& batch = static_cast< ModelBatch& >( *this );
+
+  // The input is kept in a buffer of the thread, which is reused for all
+  // batches and time slices. All input to the steps of the slice has
+  // arrived, since delays are at least one time slice.
+  const size_t n_steps = to - from;
+  std::vector< double >& buffer = kernel().node_manager.get_batch_buffer( ( *first )->get_thread() );
+  if ( buffer.size() < num_inputs * n_steps * max_size )
+  {
+    buffer.resize( num_inputs * n_steps * max_size );
+  }
+  for ( size_t k = 0; k < num_inputs; ++k )
+  {
+    input[ k ] = &buffer[ k * n_steps * max_size ];
+  }
+
+  while ( first != last )
+  {
+    load_( first, last );
+
+    if ( batch.update_individually() )
+    {
+      for ( size_t i = 0; i < size; ++i )
+      {
+        nodes[ i ]->update( origin, from, to );
+      }
+      continue;
+    }
+
+    for ( size_t i = 0; i < size; ++i )
+    {
+      batch.load_input( i, from, to );
+    }
+
+    // Neurons are integrated step by step, so that spikes are emitted in
+    // the same order per step as with update() called for each neuron.
+    for ( long lag = from; lag < to; ++lag )
+    {
+      const size_t step = lag - from;
+      batch.integrate( step );
+
+      for ( size_t i = 0; i < size; ++i )
+      {
+        for ( unsigned int k = batch.spike_count( i ); k > 0; --k )
+        {
+          NodeT& node = *nodes[ i ];
+          node.set_spiketime( Time::step( origin.get_steps() + lag + 1 ) );
+          SpikeEvent se;
+          kernel().event_delivery_manager.send( node, se, lag );
+        }
+
+        if ( recorded[ i ] )
+        {
+          batch.store( i, step );
+          nodes[ i ]->B_.logger_.record_data( origin.get_steps() + lag );
+        }
+      }
+    }
+
+    for ( size_t i = 0; i < size; ++i )
+    {
+      batch.store( i, n_steps - 1 );
+    }
+  }
+}
+
+} // namespace nest
+
+#endif // BATCH_UPDATE_H
@@ -164,6 +164,12 @@ public:
     t.register_stdp_connection( t_lastspike_ - get_delay(), get_delay() );
   }
 
+  void
+  delay_changed( const thread t, const double old_delay )
+  {
+    get_target( t )->reregister_stdp_connection( t_lastspike_ - old_delay, t_lastspike_ - get_delay(), get_delay() );
+  }
+
   void
   set_weight( double w )
   {
@@ -26,8 +26,13 @@
 #include <limits>
 
 // Includes from libnestutil:
+#include "binary_io.h"
 #include "numerics.h"
 #include "propagator_stability.h"
+#include "simd.h"
+
+// Includes from models:
+#include "batch_update.h"
 
 // Includes from nestkernel:
 #include "exceptions.h"
@@ -253,6 +258,60 @@ iaf_psc_alpha::init_buffers_()
   Archiving_Node::clear_history();
 }
 
+void
+iaf_psc_alpha::get_values( const Name& name,
+  std::vector< Node* >::const_iterator first,
+  std::vector< Node* >::const_iterator last,
+  double* values ) const
+{
+  if ( not recordablesMap_.get_values( name, first, last, values ) )
+  {
+    Archiving_Node::get_values( name, first, last, values );
+  }
+}
+
+void
+iaf_psc_alpha::set_values( const Name& name,
+  std::vector< Node* >::const_iterator first,
+  std::vector< Node* >::const_iterator last,
+  const double* values )
+{
+  // V_m is not subject to constraints, so that it can be set directly
+  if ( name != names::V_m )
+  {
+    Archiving_Node::set_values( name, first, last, values );
+    return;
+  }
+
+  for ( ; first != last; ++first, ++values )
+  {
+    iaf_psc_alpha* const node = static_cast< iaf_psc_alpha* >( *first );
+    node->S_.y3_ = *values - node->P_.E_L_;
+  }
+}
+
+void
+iaf_psc_alpha::save_state( std::ostream& os ) const
+{
+  write_binary( os, P_ );
+  write_binary( os, S_ );
+  B_.ex_spikes_.save_state( os );
+  B_.in_spikes_.save_state( os );
+  B_.currents_.save_state( os );
+  save_archiving_state_( os );
+}
+
+void
+iaf_psc_alpha::load_state( std::istream& is )
+{
+  read_binary( is, P_ );
+  read_binary( is, S_ );
+  B_.ex_spikes_.load_state( is );
+  B_.in_spikes_.load_state( is );
+  B_.currents_.load_state( is );
+  load_archiving_state_( is );
+}
+
 void
 iaf_psc_alpha::calibrate()
 {
@@ -376,6 +435,195 @@ iaf_psc_alpha::update( Time const& origin, const long from, const long to )
   }
 }
 
+/* ----------------------------------------------------------------
+ * Batch update
+ * ---------------------------------------------------------------- */
+
+struct iaf_psc_alpha::Batch_ : public BatchUpdate< iaf_psc_alpha::Batch_, iaf_psc_alpha, 3 >
+{
+  //! Input channels
+  enum Input
+  {
+    SPIKES_EX = 0,
+    SPIKES_IN,
+    CURRENTS
+  };
+
+  double y0[ max_size ];
+  double dI_ex[ max_size ];
+  double I_ex[ max_size ];
+  double dI_in[ max_size ];
+  double I_in[ max_size ];
+  double y3[ max_size ];
+  double r[ max_size ]; //!< refractory counts, held as doubles to fit into vectors
+
+  double I_e[ max_size ];
+  double Theta[ max_size ];
+  double V_reset[ max_size ];
+  double LowerBound[ max_size ];
+  double EPSCInitialValue[ max_size ];
+  double IPSCInitialValue[ max_size ];
+  double RefractoryCounts[ max_size ];
+  double P11_ex[ max_size ];
+  double P21_ex[ max_size ];
+  double P22_ex[ max_size ];
+  double P31_ex[ max_size ];
+  double P32_ex[ max_size ];
+  double P11_in[ max_size ];
+  double P21_in[ max_size ];
+  double P22_in[ max_size ];
+  double P31_in[ max_size ];
+  double P32_in[ max_size ];
+  double P30[ max_size ];
+  double expm1_tau_m[ max_size ];
+
+  void load_node( const size_t i, const iaf_psc_alpha& node );
+  void load_input( const size_t i, const long from, const long to );
+  void store( const size_t i, const size_t step ) const;
+  void integrate( const size_t step );
+};
+
+void
+iaf_psc_alpha::Batch_::load_node( const size_t i, const iaf_psc_alpha& node )
+{
+  const State_& S = node.S_;
+  y0[ i ] = S.y0_;
+  dI_ex[ i ] = S.dI_ex_;
+  I_ex[ i ] = S.I_ex_;
+  dI_in[ i ] = S.dI_in_;
+  I_in[ i ] = S.I_in_;
+  y3[ i ] = S.y3_;
+  r[ i ] = S.r_;
+
+  const Parameters_& P = node.P_;
+  I_e[ i ] = P.I_e_;
+  Theta[ i ] = P.Theta_;
+  V_reset[ i ] = P.V_reset_;
+  LowerBound[ i ] = P.LowerBound_;
+
+  const Variables_& V = node.V_;
+  EPSCInitialValue[ i ] = V.EPSCInitialValue_;
+  IPSCInitialValue[ i ] = V.IPSCInitialValue_;
+  RefractoryCounts[ i ] = V.RefractoryCounts_;
+  P11_ex[ i ] = V.P11_ex_;
+  P21_ex[ i ] = V.P21_ex_;
+  P22_ex[ i ] = V.P22_ex_;
+  P31_ex[ i ] = V.P31_ex_;
+  P32_ex[ i ] = V.P32_ex_;
+  P11_in[ i ] = V.P11_in_;
+  P21_in[ i ] = V.P21_in_;
+  P22_in[ i ] = V.P22_in_;
+  P31_in[ i ] = V.P31_in_;
+  P32_in[ i ] = V.P32_in_;
+  P30[ i ] = V.P30_;
+  expm1_tau_m[ i ] = V.expm1_tau_m_;
+}
+
+void
+iaf_psc_alpha::Batch_::load_input( const size_t i, const long from, const long to )
+{
+  Buffers_& B = nodes[ i ]->B_;
+  B.ex_spikes_.get_values( from, to, &input[ SPIKES_EX ][ i ], max_size );
+  B.in_spikes_.get_values( from, to, &input[ SPIKES_IN ][ i ], max_size );
+  B.currents_.get_values( from, to, &input[ CURRENTS ][ i ], max_size );
+}
+
+void
+iaf_psc_alpha::Batch_::store( const size_t i, const size_t step ) const
+{
+  State_& S = nodes[ i ]->S_;
+  S.y0_ = y0[ i ];
+  S.dI_ex_ = dI_ex[ i ];
+  S.I_ex_ = I_ex[ i ];
+  S.dI_in_ = dI_in[ i ];
+  S.I_in_ = I_in[ i ];
+  S.y3_ = y3[ i ];
+  S.r_ = static_cast< int >( r[ i ] );
+
+  nodes[ i ]->V_.weighted_spikes_ex_ = input[ SPIKES_EX ][ step * max_size + i ];
+  nodes[ i ]->V_.weighted_spikes_in_ = input[ SPIKES_IN ][ step * max_size + i ];
+}
+
+void
+iaf_psc_alpha::Batch_::integrate( const size_t step )
+{
+  const double* const spikes_ex = &input[ SPIKES_EX ][ step * max_size ];
+  const double* const spikes_in = &input[ SPIKES_IN ][ step * max_size ];
+  const double* const current = &input[ CURRENTS ][ step * max_size ];
+
+  // Same operations in the same order as in update(), with the branches
+  // replaced by selections. Vectors may extend past size into unused,
+  // initialized entries.
+  const simd::Double zero = simd::set1( 0. );
+  const simd::Double one = simd::set1( 1. );
+  for ( size_t i = 0; i < size; i += simd::width )
+  {
+    simd::Double v = simd::load( &y3[ i ] );
+    simd::Double ref = simd::load( &r[ i ] );
+    simd::Double di_ex = simd::load( &dI_ex[ i ] );
+    simd::Double i_ex = simd::load( &I_ex[ i ] );
+    simd::Double di_in = simd::load( &dI_in[ i ] );
+    simd::Double i_in = simd::load( &I_in[ i ] );
+
+    const simd::Mask not_refractory = simd::eq( ref, zero );
+    const simd::Double y0_I_e = simd::add( simd::load( &y0[ i ] ), simd::load( &I_e[ i ] ) );
+    simd::Double v_new = simd::mul( simd::load( &P30[ i ] ), y0_I_e );
+    v_new = simd::add( v_new, simd::mul( simd::load( &P31_ex[ i ] ), di_ex ) );
+    v_new = simd::add( v_new, simd::mul( simd::load( &P32_ex[ i ] ), i_ex ) );
+    v_new = simd::add( v_new, simd::mul( simd::load( &P31_in[ i ] ), di_in ) );
+    v_new = simd::add( v_new, simd::mul( simd::load( &P32_in[ i ] ), i_in ) );
+    v_new = simd::add( v_new, simd::mul( simd::load( &expm1_tau_m[ i ] ), v ) );
+    v_new = simd::add( v_new, v );
+    const simd::Double lower_bound = simd::load( &LowerBound[ i ] );
+    v_new = simd::select( simd::lt( v_new, lower_bound ), lower_bound, v_new );
+    v = simd::select( not_refractory, v_new, v );
+    ref = simd::select( not_refractory, ref, simd::sub( ref, one ) );
+
+    i_ex =
+      simd::add( simd::mul( simd::load( &P21_ex[ i ] ), di_ex ), simd::mul( simd::load( &P22_ex[ i ] ), i_ex ) );
+    di_ex = simd::mul( di_ex, simd::load( &P11_ex[ i ] ) );
+    di_ex = simd::add( di_ex, simd::mul( simd::load( &EPSCInitialValue[ i ] ), simd::load( &spikes_ex[ i ] ) ) );
+
+    i_in =
+      simd::add( simd::mul( simd::load( &P21_in[ i ] ), di_in ), simd::mul( simd::load( &P22_in[ i ] ), i_in ) );
+    di_in = simd::mul( di_in, simd::load( &P11_in[ i ] ) );
+    di_in = simd::add( di_in, simd::mul( simd::load( &IPSCInitialValue[ i ] ), simd::load( &spikes_in[ i ] ) ) );
+
+    const simd::Mask spike = simd::ge( v, simd::load( &Theta[ i ] ) );
+    ref = simd::select( spike, simd::load( &RefractoryCounts[ i ] ), ref );
+    v = simd::select( spike, simd::load( &V_reset[ i ] ), v );
+
+    simd::store( &y3[ i ], v );
+    simd::store( &r[ i ], ref );
+    simd::store( &dI_ex[ i ], di_ex );
+    simd::store( &I_ex[ i ], i_ex );
+    simd::store( &dI_in[ i ], di_in );
+    simd::store( &I_in[ i ], i_in );
+
+    const unsigned int spike_bits = simd::bits( spike );
+    for ( size_t k = 0; k < simd::width; ++k )
+    {
+      spiked[ i + k ] = spike_bits >> k & 1;
+    }
+
+    // set new input current
+    simd::store( &y0[ i ], simd::load( &current[ i ] ) );
+  }
+}
+
+void
+iaf_psc_alpha::update_batch( std::vector< Node* >::const_iterator first,
+  std::vector< Node* >::const_iterator last,
+  Time const& origin,
+  const long from,
+  const long to )
+{
+  assert( to >= 0 && ( delay ) from < kernel().connection_manager.get_min_delay() );
+
+  Batch_ batch = Batch_(); // zero-initialized, see integrate()
+  batch.update( first, last, origin, from, to );
+}
+
 void
 iaf_psc_alpha::handle( SpikeEvent& e )
 {
@@ -35,6 +35,9 @@
 namespace nest
 {
 
+template < class ModelBatch, class NodeT, size_t num_inputs >
+class BatchUpdate;
+
 /** @BeginDocumentation
 @ingroup Neurons
 @ingroup iaf
@@ -169,6 +172,17 @@ public:
 
   void get_status( DictionaryDatum& ) const;
   void set_status( const DictionaryDatum& );
+  void get_values( const Name&,
+    std::vector< Node* >::const_iterator,
+    std::vector< Node* >::const_iterator,
+    double* ) const;
+  void set_values( const Name&,
+    std::vector< Node* >::const_iterator,
+    std::vector< Node* >::const_iterator,
+    const double* );
+
+  void save_state( std::ostream& ) const;
+  void load_state( std::istream& );
 
 private:
   void init_state_( const Node& proto );
@@ -176,11 +190,20 @@ private:
   void calibrate();
 
   void update( Time const&, const long, const long );
+  void update_batch( std::vector< Node* >::const_iterator,
+    std::vector< Node* >::const_iterator,
+    Time const&,
+    const long,
+    const long );
 
   // The next two classes need to be friends to access the State_ class/member
   friend class RecordablesMap< iaf_psc_alpha >;
   friend class UniversalDataLogger< iaf_psc_alpha >;
 
+  // The skeleton of update_batch() needs access to the buffers
+  template < class ModelBatch, class NodeT, size_t num_inputs >
+  friend class BatchUpdate;
+
   // ----------------------------------------------------------------
 
   struct Parameters_
@@ -274,6 +297,14 @@ private:
 
   // ----------------------------------------------------------------
 
+  /**
+   * State variables, parameters and propagators of a batch of neurons
+   * in structure-of-arrays layout, used by update_batch().
+   */
+  struct Batch_;
+
+  // ----------------------------------------------------------------
+
   struct Variables_
   {
 
@@ -28,8 +28,12 @@
 #include <limits>
 
 // Includes from libnestutil:
+#include "binary_io.h"
 #include "numerics.h"
 
+// Includes from models:
+#include "batch_update.h"
+
 // Includes from nestkernel:
 #include "exceptions.h"
 #include "kernel_manager.h"
@@ -235,6 +239,58 @@ nest::iaf_psc_delta::init_buffers_()
   Archiving_Node::clear_history();
 }
 
+void
+nest::iaf_psc_delta::get_values( const Name& name,
+  std::vector< Node* >::const_iterator first,
+  std::vector< Node* >::const_iterator last,
+  double* values ) const
+{
+  if ( not recordablesMap_.get_values( name, first, last, values ) )
+  {
+    Archiving_Node::get_values( name, first, last, values );
+  }
+}
+
+void
+nest::iaf_psc_delta::set_values( const Name& name,
+  std::vector< Node* >::const_iterator first,
+  std::vector< Node* >::const_iterator last,
+  const double* values )
+{
+  // V_m is not subject to constraints, so that it can be set directly
+  if ( name != names::V_m )
+  {
+    Archiving_Node::set_values( name, first, last, values );
+    return;
+  }
+
+  for ( ; first != last; ++first, ++values )
+  {
+    iaf_psc_delta* const node = static_cast< iaf_psc_delta* >( *first );
+    node->S_.y3_ = *values - node->P_.E_L_;
+  }
+}
+
+void
+nest::iaf_psc_delta::save_state( std::ostream& os ) const
+{
+  write_binary( os, P_ );
+  write_binary( os, S_ );
+  B_.spikes_.save_state( os );
+  B_.currents_.save_state( os );
+  save_archiving_state_( os );
+}
+
+void
+nest::iaf_psc_delta::load_state( std::istream& is )
+{
+  read_binary( is, P_ );
+  read_binary( is, S_ );
+  B_.spikes_.load_state( is );
+  B_.currents_.load_state( is );
+  load_archiving_state_( is );
+}
+
 void
 nest::iaf_psc_delta::calibrate()
 {
@@ -335,6 +391,135 @@ nest::iaf_psc_delta::update( Time const& origin, const long from, const long to
   }
 }
 
+/* ----------------------------------------------------------------
+ * Batch update
+ * ---------------------------------------------------------------- */
+
+struct nest::iaf_psc_delta::Batch_ : public BatchUpdate< iaf_psc_delta::Batch_, iaf_psc_delta, 2 >
+{
+  //! Input channels
+  enum Input
+  {
+    SPIKES = 0,
+    CURRENTS
+  };
+
+  double y0[ max_size ];
+  double y3[ max_size ];
+  int r[ max_size ];
+  double refr_spikes_buffer[ max_size ];
+
+  double I_e[ max_size ];
+  double V_th[ max_size ];
+  double V_min[ max_size ];
+  double V_reset[ max_size ];
+  double tau_m[ max_size ];
+  bool with_refr_input[ max_size ];
+  int RefractoryCounts[ max_size ];
+  double P30[ max_size ];
+  double P33[ max_size ];
+
+  void load_node( const size_t i, const iaf_psc_delta& node );
+  void load_input( const size_t i, const long from, const long to );
+  void store( const size_t i, const size_t ) const;
+  void integrate( const size_t step );
+};
+
+void
+nest::iaf_psc_delta::Batch_::load_node( const size_t i, const iaf_psc_delta& node )
+{
+  const State_& S = node.S_;
+  y0[ i ] = S.y0_;
+  y3[ i ] = S.y3_;
+  r[ i ] = S.r_;
+  refr_spikes_buffer[ i ] = S.refr_spikes_buffer_;
+
+  const Parameters_& P = node.P_;
+  I_e[ i ] = P.I_e_;
+  V_th[ i ] = P.V_th_;
+  V_min[ i ] = P.V_min_;
+  V_reset[ i ] = P.V_reset_;
+  tau_m[ i ] = P.tau_m_;
+  with_refr_input[ i ] = P.with_refr_input_;
+
+  const Variables_& V = node.V_;
+  RefractoryCounts[ i ] = V.RefractoryCounts_;
+  P30[ i ] = V.P30_;
+  P33[ i ] = V.P33_;
+}
+
+void
+nest::iaf_psc_delta::Batch_::load_input( const size_t i, const long from, const long to )
+{
+  Buffers_& B = nodes[ i ]->B_;
+  B.spikes_.get_values( from, to, &input[ SPIKES ][ i ], max_size );
+  B.currents_.get_values( from, to, &input[ CURRENTS ][ i ], max_size );
+}
+
+void
+nest::iaf_psc_delta::Batch_::store( const size_t i, const size_t ) const
+{
+  State_& S = nodes[ i ]->S_;
+  S.y0_ = y0[ i ];
+  S.y3_ = y3[ i ];
+  S.r_ = r[ i ];
+  S.refr_spikes_buffer_ = refr_spikes_buffer[ i ];
+}
+
+void
+nest::iaf_psc_delta::Batch_::integrate( const size_t step )
+{
+  const double h = Time::get_resolution().get_ms();
+  const double* const spikes_in = &input[ SPIKES ][ step * max_size ];
+  const double* const current = &input[ CURRENTS ][ step * max_size ];
+
+  // Spikes arriving during the refractory period are accumulated in a
+  // separate pass, since this requires an exponential per neuron.
+  for ( size_t i = 0; i < size; ++i )
+  {
+    if ( r[ i ] != 0 and with_refr_input[ i ] )
+    {
+      refr_spikes_buffer[ i ] += spikes_in[ i ] * std::exp( -r[ i ] * h / tau_m[ i ] );
+    }
+  }
+
+  // Same operations in the same order as in update(), with the branches
+  // replaced by selections, so that the loop can be vectorized.
+#pragma omp simd
+  for ( size_t i = 0; i < size; ++i )
+  {
+    const bool not_refractory = r[ i ] == 0;
+
+    double v = P30[ i ] * ( y0[ i ] + I_e[ i ] ) + P33[ i ] * y3[ i ] + spikes_in[ i ];
+    const bool add_refr_spikes = not_refractory and with_refr_input[ i ] and refr_spikes_buffer[ i ] != 0.0;
+    v = add_refr_spikes ? v + refr_spikes_buffer[ i ] : v;
+    refr_spikes_buffer[ i ] = add_refr_spikes ? 0.0 : refr_spikes_buffer[ i ];
+    v = ( v < V_min[ i ] ? V_min[ i ] : v );
+    y3[ i ] = not_refractory ? v : y3[ i ];
+    r[ i ] = not_refractory ? r[ i ] : r[ i ] - 1;
+
+    spiked[ i ] = y3[ i ] >= V_th[ i ];
+    r[ i ] = spiked[ i ] ? RefractoryCounts[ i ] : r[ i ];
+    y3[ i ] = spiked[ i ] ? V_reset[ i ] : y3[ i ];
+
+    // set new input current
+    y0[ i ] = current[ i ];
+  }
+}
+
+void
+nest::iaf_psc_delta::update_batch( std::vector< Node* >::const_iterator first,
+  std::vector< Node* >::const_iterator last,
+  Time const& origin,
+  const long from,
+  const long to )
+{
+  assert( to >= 0 && ( delay ) from < kernel().connection_manager.get_min_delay() );
+
+  Batch_ batch;
+  batch.update( first, last, origin, from, to );
+}
+
 void
 nest::iaf_psc_delta::handle( SpikeEvent& e )
 {
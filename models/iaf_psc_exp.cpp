@@ -26,8 +26,13 @@
 #include <limits>
 
 // Includes from libnestutil:
+#include "binary_io.h"
 #include "numerics.h"
 #include "propagator_stability.h"
+#include "simd.h"
+
+// Includes from models:
+#include "batch_update.h"
 
 // Includes from nestkernel:
 #include "event_delivery_manager_impl.h"
@@ -249,6 +254,70 @@ nest::iaf_psc_exp::init_buffers_()
   Archiving_Node::clear_history();
 }
 
+void
+nest::iaf_psc_exp::get_values( const Name& name,
+  std::vector< Node* >::const_iterator first,
+  std::vector< Node* >::const_iterator last,
+  double* values ) const
+{
+  if ( not recordablesMap_.get_values( name, first, last, values ) )
+  {
+    Archiving_Node::get_values( name, first, last, values );
+  }
+}
+
+void
+nest::iaf_psc_exp::set_values( const Name& name,
+  std::vector< Node* >::const_iterator first,
+  std::vector< Node* >::const_iterator last,
+  const double* values )
+{
+  // V_m is not subject to constraints, so that it can be set directly
+  if ( name != names::V_m )
+  {
+    Archiving_Node::set_values( name, first, last, values );
+    return;
+  }
+
+  for ( ; first != last; ++first, ++values )
+  {
+    iaf_psc_exp* const node = static_cast< iaf_psc_exp* >( *first );
+    node->S_.V_m_ = *values - node->P_.E_L_;
+  }
+}
+
+void
+nest::iaf_psc_exp::save_state( std::ostream& os ) const
+{
+  write_binary( os, P_ );
+  write_binary( os, S_ );
+  B_.spikes_ex_.save_state( os );
+  B_.spikes_in_.save_state( os );
+  write_binary( os, B_.currents_.size() );
+  for ( size_t i = 0; i < B_.currents_.size(); ++i )
+  {
+    B_.currents_[ i ].save_state( os );
+  }
+  save_archiving_state_( os );
+}
+
+void
+nest::iaf_psc_exp::load_state( std::istream& is )
+{
+  read_binary( is, P_ );
+  read_binary( is, S_ );
+  B_.spikes_ex_.load_state( is );
+  B_.spikes_in_.load_state( is );
+  size_t n_currents = 0;
+  read_binary( is, n_currents );
+  B_.currents_.resize( n_currents );
+  for ( size_t i = 0; i < B_.currents_.size(); ++i )
+  {
+    B_.currents_[ i ].load_state( is );
+  }
+  load_archiving_state_( is );
+}
+
 void
 nest::iaf_psc_exp::calibrate()
 {
@@ -365,6 +434,186 @@ nest::iaf_psc_exp::update( const Time& origin, const long from, const long to )
   }
 }
 
+/* ----------------------------------------------------------------
+ * Batch update
+ * ---------------------------------------------------------------- */
+
+struct nest::iaf_psc_exp::Batch_ : public BatchUpdate< iaf_psc_exp::Batch_, iaf_psc_exp, 4 >
+{
+  //! Input channels
+  enum Input
+  {
+    SPIKES_EX = 0,
+    SPIKES_IN,
+    CURRENTS_0,
+    CURRENTS_1
+  };
+
+  double i_0[ max_size ];
+  double i_1[ max_size ];
+  double i_syn_ex[ max_size ];
+  double i_syn_in[ max_size ];
+  double V_m[ max_size ];
+  double r_ref[ max_size ]; //!< refractory counts, held as doubles to fit into vectors
+
+  double I_e[ max_size ];
+  double Theta[ max_size ];
+  double V_reset[ max_size ];
+  double RefractoryCounts[ max_size ];
+  double P20[ max_size ];
+  double P11ex[ max_size ];
+  double P11in[ max_size ];
+  double P21ex[ max_size ];
+  double P21in[ max_size ];
+  double P22[ max_size ];
+
+  void load_node( const size_t i, const iaf_psc_exp& node );
+  void load_input( const size_t i, const long from, const long to );
+  void store( const size_t i, const size_t step ) const;
+  void integrate( const size_t step );
+
+  /**
+   * Neurons with stochastic thresholds are updated one by one, so that
+   * random numbers are drawn in the same order as with update() called
+   * for each neuron.
+   */
+  bool update_individually() const;
+};
+
+void
+nest::iaf_psc_exp::Batch_::load_node( const size_t i, const iaf_psc_exp& node )
+{
+  const State_& S = node.S_;
+  i_0[ i ] = S.i_0_;
+  i_1[ i ] = S.i_1_;
+  i_syn_ex[ i ] = S.i_syn_ex_;
+  i_syn_in[ i ] = S.i_syn_in_;
+  V_m[ i ] = S.V_m_;
+  r_ref[ i ] = S.r_ref_;
+
+  const Parameters_& P = node.P_;
+  I_e[ i ] = P.I_e_;
+  Theta[ i ] = P.Theta_;
+  V_reset[ i ] = P.V_reset_;
+
+  const Variables_& V = node.V_;
+  RefractoryCounts[ i ] = V.RefractoryCounts_;
+  P20[ i ] = V.P20_;
+  P11ex[ i ] = V.P11ex_;
+  P11in[ i ] = V.P11in_;
+  P21ex[ i ] = V.P21ex_;
+  P21in[ i ] = V.P21in_;
+  P22[ i ] = V.P22_;
+}
+
+void
+nest::iaf_psc_exp::Batch_::load_input( const size_t i, const long from, const long to )
+{
+  Buffers_& B = nodes[ i ]->B_;
+  B.spikes_ex_.get_values( from, to, &input[ SPIKES_EX ][ i ], max_size );
+  B.spikes_in_.get_values( from, to, &input[ SPIKES_IN ][ i ], max_size );
+  B.currents_[ 0 ].get_values( from, to, &input[ CURRENTS_0 ][ i ], max_size );
+  B.currents_[ 1 ].get_values( from, to, &input[ CURRENTS_1 ][ i ], max_size );
+}
+
+void
+nest::iaf_psc_exp::Batch_::store( const size_t i, const size_t step ) const
+{
+  State_& S = nodes[ i ]->S_;
+  S.i_0_ = i_0[ i ];
+  S.i_1_ = i_1[ i ];
+  S.i_syn_ex_ = i_syn_ex[ i ];
+  S.i_syn_in_ = i_syn_in[ i ];
+  S.V_m_ = V_m[ i ];
+  S.r_ref_ = static_cast< int >( r_ref[ i ] );
+
+  nodes[ i ]->V_.weighted_spikes_ex_ = input[ SPIKES_EX ][ step * max_size + i ];
+  nodes[ i ]->V_.weighted_spikes_in_ = input[ SPIKES_IN ][ step * max_size + i ];
+}
+
+bool
+nest::iaf_psc_exp::Batch_::update_individually() const
+{
+  for ( size_t i = 0; i < size; ++i )
+  {
+    if ( not( nodes[ i ]->P_.delta_ < 1e-10 ) )
+    {
+      return true;
+    }
+  }
+  return false;
+}
+
+void
+nest::iaf_psc_exp::Batch_::integrate( const size_t step )
+{
+  const double* const spikes_ex = &input[ SPIKES_EX ][ step * max_size ];
+  const double* const spikes_in = &input[ SPIKES_IN ][ step * max_size ];
+  const double* const current_0 = &input[ CURRENTS_0 ][ step * max_size ];
+  const double* const current_1 = &input[ CURRENTS_1 ][ step * max_size ];
+
+  // Same operations in the same order as in update(), with the branches
+  // replaced by selections. Only deterministic thresholds are handled
+  // here. Vectors may extend past size into unused, initialized entries.
+  const simd::Double zero = simd::set1( 0. );
+  const simd::Double one = simd::set1( 1. );
+  for ( size_t i = 0; i < size; i += simd::width )
+  {
+    simd::Double v = simd::load( &V_m[ i ] );
+    simd::Double r = simd::load( &r_ref[ i ] );
+    simd::Double syn_ex = simd::load( &i_syn_ex[ i ] );
+    simd::Double syn_in = simd::load( &i_syn_in[ i ] );
+    const simd::Double p11ex = simd::load( &P11ex[ i ] );
+
+    const simd::Mask not_refractory = simd::eq( r, zero );
+    simd::Double v_new = simd::mul( v, simd::load( &P22[ i ] ) );
+    v_new = simd::add( v_new, simd::mul( syn_ex, simd::load( &P21ex[ i ] ) ) );
+    v_new = simd::add( v_new, simd::mul( syn_in, simd::load( &P21in[ i ] ) ) );
+    v_new = simd::add(
+      v_new, simd::mul( simd::add( simd::load( &I_e[ i ] ), simd::load( &i_0[ i ] ) ), simd::load( &P20[ i ] ) ) );
+    v = simd::select( not_refractory, v_new, v );
+    r = simd::select( not_refractory, r, simd::sub( r, one ) );
+
+    syn_ex = simd::mul( syn_ex, p11ex );
+    syn_in = simd::mul( syn_in, simd::load( &P11in[ i ] ) );
+    syn_ex = simd::add( syn_ex, simd::mul( simd::sub( one, p11ex ), simd::load( &i_1[ i ] ) ) );
+    syn_ex = simd::add( syn_ex, simd::load( &spikes_ex[ i ] ) );
+    syn_in = simd::add( syn_in, simd::load( &spikes_in[ i ] ) );
+
+    const simd::Mask spike = simd::ge( v, simd::load( &Theta[ i ] ) );
+    r = simd::select( spike, simd::load( &RefractoryCounts[ i ] ), r );
+    v = simd::select( spike, simd::load( &V_reset[ i ] ), v );
+
+    simd::store( &V_m[ i ], v );
+    simd::store( &r_ref[ i ], r );
+    simd::store( &i_syn_ex[ i ], syn_ex );
+    simd::store( &i_syn_in[ i ], syn_in );
+
+    const unsigned int spike_bits = simd::bits( spike );
+    for ( size_t k = 0; k < simd::width; ++k )
+    {
+      spiked[ i + k ] = spike_bits >> k & 1;
+    }
+
+    // set new input current
+    simd::store( &i_0[ i ], simd::load( &current_0[ i ] ) );
+    simd::store( &i_1[ i ], simd::load( &current_1[ i ] ) );
+  }
+}
+
+void
+nest::iaf_psc_exp::update_batch( std::vector< Node* >::const_iterator first,
+  std::vector< Node* >::const_iterator last,
+  const Time& origin,
+  const long from,
+  const long to )
+{
+  assert( to >= 0 && ( delay ) from < kernel().connection_manager.get_min_delay() );
+
+  Batch_ batch = Batch_(); // zero-initialized, see integrate()
+  batch.update( first, last, origin, from, to );
+}
+
 void
 nest::iaf_psc_exp::handle( SpikeEvent& e )
 {
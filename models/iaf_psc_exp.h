@@ -35,6 +35,9 @@
 namespace nest
 {
 
+template < class ModelBatch, class NodeT, size_t num_inputs >
+class BatchUpdate;
+
 /** @BeginDocumentation
 
 @ingroup Neurons
@@ -180,6 +183,17 @@ public:
 
   void get_status( DictionaryDatum& ) const;
   void set_status( const DictionaryDatum& );
+  void get_values( const Name&,
+    std::vector< Node* >::const_iterator,
+    std::vector< Node* >::const_iterator,
+    double* ) const;
+  void set_values( const Name&,
+    std::vector< Node* >::const_iterator,
+    std::vector< Node* >::const_iterator,
+    const double* );
+
+  void save_state( std::ostream& ) const;
+  void load_state( std::istream& );
 
 private:
   void init_state_( const Node& proto );
@@ -187,6 +201,11 @@ private:
   void calibrate();
 
   void update( const Time&, const long, const long );
+  void update_batch( std::vector< Node* >::const_iterator,
+    std::vector< Node* >::const_iterator,
+    const Time&,
+    const long,
+    const long );
 
   // intensity function
   double phi_() const;
@@ -195,6 +214,10 @@ private:
   friend class RecordablesMap< iaf_psc_exp >;
   friend class UniversalDataLogger< iaf_psc_exp >;
 
+  // The skeleton of update_batch() needs access to the buffers
+  template < class ModelBatch, class NodeT, size_t num_inputs >
+  friend class BatchUpdate;
+
   // ----------------------------------------------------------------
 
   /**
@@ -298,6 +321,14 @@ private:
 
   // ----------------------------------------------------------------
 
+  /**
+   * State variables, parameters and propagators of a batch of neurons
+   * in structure-of-arrays layout, used by update_batch().
+   */
+  struct Batch_;
+
+  // ----------------------------------------------------------------
+
   /**
    * Internal variables of the model.
    */
@@ -176,6 +176,7 @@ multimeter::init_buffers_()
 void
 multimeter::calibrate()
 {
+  device_.set_value_names( P_.record_from_ );
   device_.calibrate();
   V_.new_request_ = false;
   V_.current_request_data_start_ = 0;
@@ -335,7 +336,7 @@ multimeter::add_data_( DictionaryDatum& d ) const
     }
     else
     {
-      append_property( d, P_.record_from_[ v ], dv );
+      move_property( d, P_.record_from_[ v ], dv );
     }
   }
 }
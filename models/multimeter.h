@@ -178,6 +178,8 @@ public:
   void get_status( DictionaryDatum& ) const;
   void set_status( const DictionaryDatum& );
 
+  void take_events( DictionaryDatum& );
+
 protected:
   void init_state_( Node const& );
   void init_buffers_();
@@ -323,6 +325,27 @@ nest::multimeter::get_status( DictionaryDatum& d ) const
   P_.get( d );
 }
 
+inline void
+nest::multimeter::take_events( DictionaryDatum& events )
+{
+  device_.take_events( events );
+
+  // the analog data is copied into one vector per recorded variable,
+  // hence release its memory here
+  add_data_( events );
+  std::vector< std::vector< double > >().swap( S_.data_ );
+
+  if ( get_thread() == 0 )
+  {
+    const SiblingContainer* siblings = kernel().node_manager.get_thread_siblings( get_gid() );
+    std::vector< Node* >::const_iterator sibling;
+    for ( sibling = siblings->begin() + 1; sibling != siblings->end(); ++sibling )
+    {
+      ( *sibling )->take_events( events );
+    }
+  }
+}
+
 inline void
 nest::multimeter::set_status( const DictionaryDatum& d )
 {
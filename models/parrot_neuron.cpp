@@ -27,6 +27,7 @@
 #include <limits>
 
 // Includes from libnestutil:
+#include "binary_io.h"
 #include "numerics.h"
 
 // Includes from nestkernel:
@@ -55,6 +56,20 @@ parrot_neuron::init_buffers_()
   Archiving_Node::clear_history();
 }
 
+void
+parrot_neuron::save_state( std::ostream& os ) const
+{
+  B_.n_spikes_.save_state( os );
+  save_archiving_state_( os );
+}
+
+void
+parrot_neuron::load_state( std::istream& is )
+{
+  B_.n_spikes_.load_state( is );
+  load_archiving_state_( is );
+}
+
 void
 parrot_neuron::update( Time const& origin, const long from, const long to )
 {
@@ -104,6 +104,9 @@ public:
   void get_status( DictionaryDatum& ) const;
   void set_status( const DictionaryDatum& );
 
+  void save_state( std::ostream& ) const;
+  void load_state( std::istream& );
+
 private:
   void
   init_state_( const Node& )
@@ -22,6 +22,12 @@
 
 #include "poisson_generator.h"
 
+// C++ includes:
+#include <algorithm>
+
+// Includes from libnestutil:
+#include "binary_io.h"
+
 // Includes from nestkernel:
 #include "event_delivery_manager_impl.h"
 #include "exceptions.h"
@@ -100,6 +106,20 @@ nest::poisson_generator::init_buffers_()
   device_.init_buffers();
 }
 
+void
+nest::poisson_generator::save_state( std::ostream& os ) const
+{
+  // spikes are drawn from the random generators of the threads,
+  // which are saved by the RNGManager
+  write_binary( os, P_ );
+}
+
+void
+nest::poisson_generator::load_state( std::istream& is )
+{
+  read_binary( is, P_ );
+}
+
 void
 nest::poisson_generator::calibrate()
 {
@@ -107,6 +127,7 @@ nest::poisson_generator::calibrate()
 
   // rate_ is in Hz, dt in ms, so we have to convert from s to ms
   V_.poisson_dev_.set_lambda( Time::get_resolution().get_ms() * P_.rate_ * 1e-3 );
+  V_.draw_blocks_ = V_.poisson_dev_.has_fast_block_ldev();
 }
 
 
@@ -125,6 +146,11 @@ nest::poisson_generator::update( Time const& T, const long from, const long to )
     return;
   }
 
+  if ( V_.draw_blocks_ )
+  {
+    V_.n_targets_ = kernel().connection_manager.get_num_targets_from_device( get_thread(), get_local_device_id() );
+  }
+
   for ( long lag = from; lag < to; ++lag )
   {
     if ( not device_.is_active( T + Time::step( lag ) ) )
@@ -132,6 +158,13 @@ nest::poisson_generator::update( Time const& T, const long from, const long to )
       continue; // no spike at this lag
     }
 
+    if ( V_.draw_blocks_ )
+    {
+      // force a new block at the first target
+      V_.next_ = Variables_::block_size_;
+      V_.n_left_ = V_.n_targets_;
+    }
+
     DSSpikeEvent se;
     kernel().event_delivery_manager.send( *this, se, lag );
   }
@@ -140,8 +173,25 @@ nest::poisson_generator::update( Time const& T, const long from, const long to )
 void
 nest::poisson_generator::event_hook( DSSpikeEvent& e )
 {
-  librandom::RngPtr rng = kernel().rng_manager.get_rng( get_thread() );
-  long n_spikes = V_.poisson_dev_.ldev( rng );
+  long n_spikes;
+  if ( V_.draw_blocks_ )
+  {
+    if ( V_.next_ == Variables_::block_size_ )
+    {
+      assert( V_.n_left_ > 0 );
+      const size_t n = std::min( V_.n_left_, Variables_::block_size_ );
+      librandom::RngPtr rng = kernel().rng_manager.get_rng( get_thread() );
+      V_.poisson_dev_.ldev( rng, V_.n_spikes_, n );
+      V_.n_left_ -= n;
+      V_.next_ = 0;
+    }
+    n_spikes = V_.n_spikes_[ V_.next_++ ];
+  }
+  else
+  {
+    librandom::RngPtr rng = kernel().rng_manager.get_rng( get_thread() );
+    n_spikes = V_.poisson_dev_.ldev( rng );
+  }
 
   if ( n_spikes > 0 ) // we must not send events with multiplicity 0
   {
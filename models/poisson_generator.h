@@ -28,6 +28,9 @@
 /*                  Implementation: hep */
 /****************************************/
 
+// C++ includes:
+#include <cstddef>
+
 // Includes from librandom:
 #include "poisson_randomdev.h"
 
@@ -101,6 +104,11 @@ refer to:
 
 http://ken.brainworks.uni-freiburg.de/cgi-bin/mailman/private/nest_developer/2011-January/002977.html
 
+For small rates, where each count is obtained from a single uniform
+random number, the hook draws the counts for blocks of 64 targets at
+once, which avoids a virtual call into the RNG per target. The counts
+are the same as those drawn one by one.
+
 SeeAlso: poisson_generator_ps, Device, parrot_neuron
 */
 class poisson_generator : public DeviceNode
@@ -132,6 +140,9 @@ public:
   void get_status( DictionaryDatum& ) const;
   void set_status( const DictionaryDatum& );
 
+  void save_state( std::ostream& ) const;
+  void load_state( std::istream& );
+
 private:
   void init_state_( const Node& );
   void init_buffers_();
@@ -160,6 +171,14 @@ private:
   struct Variables_
   {
     librandom::PoissonRandomDev poisson_dev_; //!< Random deviate generator
+
+    static const size_t block_size_ = 64; //!< Number of counts drawn at once
+
+    bool draw_blocks_;             //!< Draw counts in blocks
+    size_t n_targets_;             //!< Number of targets on this thread
+    size_t n_left_;                //!< Targets without counts in this step
+    size_t next_;                  //!< Index of next count in block
+    long n_spikes_[ block_size_ ]; //!< Counts for the current block
   };
 
   // ------------------------------------------------------------
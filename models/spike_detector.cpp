@@ -26,6 +26,7 @@
 #include <numeric>
 
 // Includes from libnestutil:
+#include "binary_io.h"
 #include "compose.hpp"
 #include "logging.h"
 
@@ -71,6 +72,68 @@ nest::spike_detector::init_buffers_()
   B_.spikes_.swap( tmp );
 }
 
+void
+nest::spike_detector::save_state( std::ostream& os ) const
+{
+  // Events recorded so far are not saved, only the events that will be
+  // recorded in the next time slice.
+  write_binary( os, B_.spikes_.size() );
+  for ( size_t toggle = 0; toggle < B_.spikes_.size(); ++toggle )
+  {
+    write_binary( os, B_.spikes_[ toggle ].size() );
+    for ( std::vector< Event* >::const_iterator e = B_.spikes_[ toggle ].begin(); e != B_.spikes_[ toggle ].end();
+          ++e )
+    {
+      write_binary( os, ( *e )->get_sender_gid() );
+      write_binary( os, ( *e )->get_stamp().get_steps() );
+      write_binary( os, ( *e )->get_offset() );
+      write_binary( os, ( *e )->get_weight() );
+      write_binary( os, ( *e )->get_port() );
+      write_binary( os, ( *e )->get_rport() );
+    }
+  }
+}
+
+void
+nest::spike_detector::load_state( std::istream& is )
+{
+  init_buffers_();
+
+  size_t n_toggles = 0;
+  read_binary( is, n_toggles );
+  B_.spikes_.resize( n_toggles );
+  for ( size_t toggle = 0; toggle < B_.spikes_.size(); ++toggle )
+  {
+    size_t n_events = 0;
+    read_binary( is, n_events );
+    for ( size_t i = 0; i < n_events; ++i )
+    {
+      index sender_gid = 0;
+      long stamp = 0;
+      double offset = 0.0;
+      double weight = 0.0;
+      port p = 0;
+      rport r = 0;
+      read_binary( is, sender_gid );
+      read_binary( is, stamp );
+      read_binary( is, offset );
+      read_binary( is, weight );
+      read_binary( is, p );
+      read_binary( is, r );
+
+      SpikeEvent* e = new SpikeEvent();
+      e->set_sender_gid( sender_gid );
+      e->set_receiver( *this );
+      e->set_stamp( Time::step( stamp ) );
+      e->set_offset( offset );
+      e->set_weight( weight );
+      e->set_port( p );
+      e->set_rport( r );
+      B_.spikes_[ toggle ].push_back( e );
+    }
+  }
+}
+
 void
 nest::spike_detector::calibrate()
 {
@@ -140,6 +203,22 @@ nest::spike_detector::get_status( DictionaryDatum& d ) const
   }
 }
 
+void
+nest::spike_detector::take_events( DictionaryDatum& events )
+{
+  device_.take_events( events );
+
+  if ( get_thread() == 0 )
+  {
+    const SiblingContainer* siblings = kernel().node_manager.get_thread_siblings( get_gid() );
+    std::vector< Node* >::const_iterator sibling;
+    for ( sibling = siblings->begin() + 1; sibling != siblings->end(); ++sibling )
+    {
+      ( *sibling )->take_events( events );
+    }
+  }
+}
+
 void
 nest::spike_detector::set_status( const DictionaryDatum& d )
 {
@@ -128,6 +128,11 @@ public:
   void get_status( DictionaryDatum& ) const;
   void set_status( const DictionaryDatum& );
 
+  void take_events( DictionaryDatum& );
+
+  void save_state( std::ostream& ) const;
+  void load_state( std::istream& );
+
 private:
   void init_state_( Node const& );
   void init_buffers_();
@@ -22,6 +22,9 @@
 
 #include "spike_generator.h"
 
+// Includes from libnestutil:
+#include "binary_io.h"
+
 // Includes from nestkernel:
 #include "event_delivery_manager_impl.h"
 #include "exceptions.h"
@@ -344,6 +347,19 @@ nest::spike_generator::init_buffers_()
   device_.init_buffers();
 }
 
+void
+nest::spike_generator::save_state( std::ostream& os ) const
+{
+  // the spike times are parameters set when building the network
+  write_binary( os, S_ );
+}
+
+void
+nest::spike_generator::load_state( std::istream& is )
+{
+  read_binary( is, S_ );
+}
+
 void
 nest::spike_generator::calibrate()
 {
@@ -148,6 +148,22 @@ nest::spin_detector::get_status( DictionaryDatum& d ) const
   }
 }
 
+void
+nest::spin_detector::take_events( DictionaryDatum& events )
+{
+  device_.take_events( events );
+
+  if ( get_thread() == 0 )
+  {
+    const SiblingContainer* siblings = kernel().node_manager.get_thread_siblings( get_gid() );
+    std::vector< Node* >::const_iterator sibling;
+    for ( sibling = siblings->begin() + 1; sibling != siblings->end(); ++sibling )
+    {
+      ( *sibling )->take_events( events );
+    }
+  }
+}
+
 void
 nest::spin_detector::set_status( const DictionaryDatum& d )
 {
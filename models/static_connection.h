@@ -23,6 +23,9 @@
 #ifndef STATICCONNECTION_H
 #define STATICCONNECTION_H
 
+// Includes from libnestutil:
+#include "binary_io.h"
+
 // Includes from nestkernel:
 #include "connection.h"
 
@@ -160,6 +163,9 @@ public:
 
   void set_status( const DictionaryDatum& d, ConnectorModel& cm );
 
+  void save_state( std::ostream& os ) const;
+  void load_state( std::istream& is );
+
   void
   set_weight( double w )
   {
@@ -177,6 +183,20 @@ StaticConnection< targetidentifierT >::get_status( DictionaryDatum& d ) const
   def< long >( d, names::size_of, sizeof( *this ) );
 }
 
+template < typename targetidentifierT >
+void
+StaticConnection< targetidentifierT >::save_state( std::ostream& os ) const
+{
+  write_binary( os, weight_ );
+}
+
+template < typename targetidentifierT >
+void
+StaticConnection< targetidentifierT >::load_state( std::istream& is )
+{
+  read_binary( is, weight_ );
+}
+
 template < typename targetidentifierT >
 void
 StaticConnection< targetidentifierT >::set_status( const DictionaryDatum& d, ConnectorModel& cm )
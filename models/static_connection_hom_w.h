@@ -172,6 +172,17 @@ public:
       "be changed via "
       "CopyModel()." );
   }
+
+  //! the connection has no state that changes during simulation
+  void
+  save_state( std::ostream& ) const
+  {
+  }
+
+  void
+  load_state( std::istream& )
+  {
+  }
 };
 
 
@@ -26,6 +26,10 @@
 // C++ includes:
 #include <cmath>
 
+// Includes from libnestutil:
+#include "binary_io.h"
+#include "numerics.h"
+
 // Includes from nestkernel:
 #include "common_synapse_properties.h"
 #include "connection.h"
@@ -144,6 +148,12 @@ public:
    */
   void set_status( const DictionaryDatum& d, ConnectorModel& cm );
 
+  /**
+   * Write and read the weight and presynaptic trace of this connection.
+   */
+  void save_state( std::ostream& os ) const;
+  void load_state( std::istream& is );
+
   /**
    * Send an event to the receiver of this connection.
    * \param e The event to send
@@ -175,6 +185,12 @@ public:
     t.register_stdp_connection( t_lastspike_ - get_delay(), get_delay() );
   }
 
+  void
+  delay_changed( const thread t, const double old_delay )
+  {
+    get_target( t )->reregister_stdp_connection( t_lastspike_ - old_delay, t_lastspike_ - get_delay(), get_delay() );
+  }
+
   void
   set_weight( double w )
   {
@@ -185,14 +201,14 @@ private:
   double
   facilitate_( double w, double kplus )
   {
-    double norm_w = ( w / Wmax_ ) + ( lambda_ * std::pow( 1.0 - ( w / Wmax_ ), mu_plus_ ) * kplus );
+    double norm_w = ( w / Wmax_ ) + ( lambda_ * numerics::pow( 1.0 - ( w / Wmax_ ), mu_plus_ ) * kplus );
     return norm_w < 1.0 ? norm_w * Wmax_ : Wmax_;
   }
 
   double
   depress_( double w, double kminus )
   {
-    double norm_w = ( w / Wmax_ ) - ( alpha_ * lambda_ * std::pow( w / Wmax_, mu_minus_ ) * kminus );
+    double norm_w = ( w / Wmax_ ) - ( alpha_ * lambda_ * numerics::pow( w / Wmax_, mu_minus_ ) * kminus );
     return norm_w > 0.0 ? norm_w * Wmax_ : 0.0;
   }
 
@@ -235,11 +251,11 @@ STDPConnection< targetidentifierT >::send( Event& e, thread t, const CommonSynap
   // For a new synapse, t_lastspike_ contains the point in time of the last
   // spike. So we initially read the
   // history(t_last_spike - dendritic_delay, ..., T_spike-dendritic_delay]
-  // which increases the access counter for these entries.
-  // At registration, all entries' access counters of
+  // which marks these entries as read by this connection.
+  // At registration, the entries
   // history[0, ..., t_last_spike - dendritic_delay] have been
-  // incremented by Archiving_Node::register_stdp_connection(). See bug #218 for
-  // details.
+  // marked as read by Archiving_Node::register_stdp_connection(). See bug #218
+  // for details.
   target->get_history( t_lastspike_ - dendritic_delay, t_spike - dendritic_delay, &start, &finish );
   // facilitation due to post-synaptic spikes since last pre-synaptic spike
   double minus_dt;
@@ -315,6 +331,24 @@ STDPConnection< targetidentifierT >::get_status( DictionaryDatum& d ) const
   def< long >( d, names::size_of, sizeof( *this ) );
 }
 
+template < typename targetidentifierT >
+void
+STDPConnection< targetidentifierT >::save_state( std::ostream& os ) const
+{
+  write_binary( os, weight_ );
+  write_binary( os, Kplus_ );
+  write_binary( os, t_lastspike_ );
+}
+
+template < typename targetidentifierT >
+void
+STDPConnection< targetidentifierT >::load_state( std::istream& is )
+{
+  read_binary( is, weight_ );
+  read_binary( is, Kplus_ );
+  read_binary( is, t_lastspike_ );
+}
+
 template < typename targetidentifierT >
 void
 STDPConnection< targetidentifierT >::set_status( const DictionaryDatum& d, ConnectorModel& cm )
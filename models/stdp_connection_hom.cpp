@@ -44,6 +44,8 @@ STDPHomCommonProperties::STDPHomCommonProperties()
   , mu_plus_( 1.0 )
   , mu_minus_( 1.0 )
   , Wmax_( 100.0 )
+  , tabulate_decay_( false )
+  , decay_plus_()
 {
 }
 
@@ -58,6 +60,7 @@ STDPHomCommonProperties::get_status( DictionaryDatum& d ) const
   def< double >( d, names::mu_plus, mu_plus_ );
   def< double >( d, names::mu_minus, mu_minus_ );
   def< double >( d, names::Wmax, Wmax_ );
+  def< bool >( d, names::tabulate_decay, tabulate_decay_ );
 }
 
 void
@@ -71,6 +74,28 @@ STDPHomCommonProperties::set_status( const DictionaryDatum& d, ConnectorModel& c
   updateValue< double >( d, names::mu_plus, mu_plus_ );
   updateValue< double >( d, names::mu_minus, mu_minus_ );
   updateValue< double >( d, names::Wmax, Wmax_ );
+  updateValue< bool >( d, names::tabulate_decay, tabulate_decay_ );
+  tabulate_();
+}
+
+void
+STDPHomCommonProperties::calibrate( const TimeConverter& tc )
+{
+  CommonSynapseProperties::calibrate( tc );
+  tabulate_();
+}
+
+void
+STDPHomCommonProperties::tabulate_()
+{
+  if ( tabulate_decay_ )
+  {
+    decay_plus_.tabulate( tau_plus_, Time::get_resolution().get_ms() );
+  }
+  else
+  {
+    decay_plus_.clear();
+  }
 }
 
 } // of namespace nest
@@ -26,6 +26,11 @@
 // C++ includes:
 #include <cmath>
 
+// Includes from libnestutil:
+#include "binary_io.h"
+#include "decay_table.h"
+#include "numerics.h"
+
 // Includes from nestkernel:
 #include "connection.h"
 
@@ -67,6 +72,9 @@ Parameters:
  mu_plus  real     Weight dependence exponent, potentiation
  mu_minus real     Weight dependence exponent, depression
  Wmax     real     Maximum allowed weight
+ tabulate_decay
+          boolean  If true, look up the decay factors of the presynaptic
+                   trace in a table (default: false)
 ========= =======  ======================================================
 \endverbatim
 
@@ -75,6 +83,13 @@ Remarks:
 The parameters are common to all synapses of the model and must be set using
 SetDefaults on the synapse model.
 
+With tabulate_decay set, the decay factors exp(-dt/tau_plus) for spike
+time differences dt on the simulation grid are taken from a table of
+exp(-n h/tau_plus) covering 20 tau_plus, instead of being computed. The
+relative error of a tabulated factor is at most 1e-6 h/tau_plus, plus
+rounding; factors for precise spike times or longer intervals are
+computed as before.
+
 Transmits: SpikeEvent
 
 References:
@@ -126,6 +141,11 @@ public:
    */
   void set_status( const DictionaryDatum& d, ConnectorModel& cm );
 
+  /**
+   * Tabulate the decay factors anew for a changed resolution.
+   */
+  void calibrate( const TimeConverter& );
+
   // data members common to all connections
   double tau_plus_;
   double lambda_;
@@ -133,6 +153,11 @@ public:
   double mu_plus_;
   double mu_minus_;
   double Wmax_;
+  bool tabulate_decay_;
+  DecayTable decay_plus_; //!< exp( dt / tau_plus ), if tabulate_decay_
+
+private:
+  void tabulate_();
 };
 
 
@@ -180,6 +205,12 @@ public:
    */
   void set_status( const DictionaryDatum& d, ConnectorModel& cm );
 
+  /**
+   * Write and read the weight and presynaptic trace of this connection.
+   */
+  void save_state( std::ostream& os ) const;
+  void load_state( std::istream& is );
+
   /**
    * Send an event to the receiver of this connection.
    * \param e The event to send
@@ -228,18 +259,24 @@ public:
     t.register_stdp_connection( t_lastspike_ - get_delay(), get_delay() );
   }
 
+  void
+  delay_changed( const thread t, const double old_delay )
+  {
+    get_target( t )->reregister_stdp_connection( t_lastspike_ - old_delay, t_lastspike_ - get_delay(), get_delay() );
+  }
+
 private:
   double
   facilitate_( double w, double kplus, const STDPHomCommonProperties& cp )
   {
-    double norm_w = ( w / cp.Wmax_ ) + ( cp.lambda_ * std::pow( 1.0 - ( w / cp.Wmax_ ), cp.mu_plus_ ) * kplus );
+    double norm_w = ( w / cp.Wmax_ ) + ( cp.lambda_ * numerics::pow( 1.0 - ( w / cp.Wmax_ ), cp.mu_plus_ ) * kplus );
     return norm_w < 1.0 ? norm_w * cp.Wmax_ : cp.Wmax_;
   }
 
   double
   depress_( double w, double kminus, const STDPHomCommonProperties& cp )
   {
-    double norm_w = ( w / cp.Wmax_ ) - ( cp.alpha_ * cp.lambda_ * std::pow( w / cp.Wmax_, cp.mu_minus_ ) * kminus );
+    double norm_w = ( w / cp.Wmax_ ) - ( cp.alpha_ * cp.lambda_ * numerics::pow( w / cp.Wmax_, cp.mu_minus_ ) * kminus );
     return norm_w > 0.0 ? norm_w * cp.Wmax_ : 0.0;
   }
 
@@ -303,7 +340,8 @@ STDPConnectionHom< targetidentifierT >::send( Event& e, thread t, const STDPHomC
     // get_history() should make sure that
     // start->t_ > t_lastspike - dendritic_delay, i.e. minus_dt < 0
     assert( minus_dt < -1.0 * kernel().connection_manager.get_stdp_eps() );
-    weight_ = facilitate_( weight_, Kplus_ * std::exp( minus_dt / cp.tau_plus_ ), cp );
+    const double decay = cp.tabulate_decay_ ? cp.decay_plus_( minus_dt ) : std::exp( minus_dt / cp.tau_plus_ );
+    weight_ = facilitate_( weight_, Kplus_ * decay, cp );
   }
 
   // depression due to new pre-synaptic spike
@@ -315,7 +353,9 @@ STDPConnectionHom< targetidentifierT >::send( Event& e, thread t, const STDPHomC
   e.set_rport( get_rport() );
   e();
 
-  Kplus_ = Kplus_ * std::exp( ( t_lastspike_ - t_spike ) / cp.tau_plus_ ) + 1.0;
+  const double decay = cp.tabulate_decay_ ? cp.decay_plus_( t_lastspike_ - t_spike )
+                                         : std::exp( ( t_lastspike_ - t_spike ) / cp.tau_plus_ );
+  Kplus_ = Kplus_ * decay + 1.0;
 
   t_lastspike_ = t_spike;
 }
@@ -334,6 +374,24 @@ STDPConnectionHom< targetidentifierT >::get_status( DictionaryDatum& d ) const
   def< long >( d, names::size_of, sizeof( *this ) );
 }
 
+template < typename targetidentifierT >
+void
+STDPConnectionHom< targetidentifierT >::save_state( std::ostream& os ) const
+{
+  write_binary( os, weight_ );
+  write_binary( os, Kplus_ );
+  write_binary( os, t_lastspike_ );
+}
+
+template < typename targetidentifierT >
+void
+STDPConnectionHom< targetidentifierT >::load_state( std::istream& is )
+{
+  read_binary( is, weight_ );
+  read_binary( is, Kplus_ );
+  read_binary( is, t_lastspike_ );
+}
+
 template < typename targetidentifierT >
 void
 STDPConnectionHom< targetidentifierT >::set_status( const DictionaryDatum& d, ConnectorModel& cm )
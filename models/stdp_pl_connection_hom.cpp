@@ -45,6 +45,8 @@ STDPPLHomCommonProperties::STDPPLHomCommonProperties()
   , lambda_( 0.1 )
   , alpha_( 1.0 )
   , mu_( 0.4 )
+  , tabulate_decay_( false )
+  , decay_plus_()
 {
 }
 
@@ -57,6 +59,7 @@ STDPPLHomCommonProperties::get_status( DictionaryDatum& d ) const
   def< double >( d, names::lambda, lambda_ );
   def< double >( d, names::alpha, alpha_ );
   def< double >( d, names::mu, mu_ );
+  def< bool >( d, names::tabulate_decay, tabulate_decay_ );
 }
 
 void
@@ -76,6 +79,28 @@ STDPPLHomCommonProperties::set_status( const DictionaryDatum& d, ConnectorModel&
   updateValue< double >( d, names::lambda, lambda_ );
   updateValue< double >( d, names::alpha, alpha_ );
   updateValue< double >( d, names::mu, mu_ );
+  updateValue< bool >( d, names::tabulate_decay, tabulate_decay_ );
+  tabulate_();
+}
+
+void
+STDPPLHomCommonProperties::calibrate( const TimeConverter& tc )
+{
+  CommonSynapseProperties::calibrate( tc );
+  tabulate_();
+}
+
+void
+STDPPLHomCommonProperties::tabulate_()
+{
+  if ( tabulate_decay_ )
+  {
+    decay_plus_.tabulate( tau_plus_, Time::get_resolution().get_ms() );
+  }
+  else
+  {
+    decay_plus_.clear();
+  }
 }
 
 } // of namespace nest
@@ -26,6 +26,11 @@
 // C++ includes:
 #include <cmath>
 
+// Includes from libnestutil:
+#include "binary_io.h"
+#include "decay_table.h"
+#include "numerics.h"
+
 // Includes from nestkernel:
 #include "connection.h"
 
@@ -55,6 +60,9 @@ Parameters:
  alpha     real    Asymmetry parameter (scales depressing increments as
                    alpha*lambda)
  mu        real    Weight dependence exponent, potentiation
+ tabulate_decay
+           boolean If true, look up the decay factors of the presynaptic
+                   trace in a table (default: false)
 =========  ======  ====================================================
 \endverbatim
 
@@ -63,6 +71,13 @@ Remarks:
 The parameters can only be set by SetDefaults and apply to all synapses of
 the model.
 
+With tabulate_decay set, the decay factors exp(-dt/tau_plus) for spike
+time differences dt on the simulation grid are taken from a table of
+exp(-n h/tau_plus) covering 20 tau_plus, instead of being computed. The
+relative error of a tabulated factor is at most 1e-6 h/tau_plus, plus
+rounding; factors for precise spike times or longer intervals are
+computed as before.
+
 References:
 
 \verbatim embed:rst
@@ -103,12 +118,22 @@ public:
    */
   void set_status( const DictionaryDatum& d, ConnectorModel& cm );
 
+  /**
+   * Tabulate the decay factors anew for a changed resolution.
+   */
+  void calibrate( const TimeConverter& );
+
   // data members common to all connections
   double tau_plus_;
   double tau_plus_inv_; //!< 1 / tau_plus for efficiency
   double lambda_;
   double alpha_;
   double mu_;
+  bool tabulate_decay_;
+  DecayTable decay_plus_; //!< exp( dt / tau_plus ), if tabulate_decay_
+
+private:
+  void tabulate_();
 };
 
 
@@ -156,6 +181,12 @@ public:
    */
   void set_status( const DictionaryDatum& d, ConnectorModel& cm );
 
+  /**
+   * Write and read the weight and presynaptic trace of this connection.
+   */
+  void save_state( std::ostream& os ) const;
+  void load_state( std::istream& is );
+
   /**
    * Send an event to the receiver of this connection.
    * \param e The event to send
@@ -198,6 +229,12 @@ public:
     t.register_stdp_connection( t_lastspike_ - get_delay(), get_delay() );
   }
 
+  void
+  delay_changed( const thread t, const double old_delay )
+  {
+    get_target( t )->reregister_stdp_connection( t_lastspike_ - old_delay, t_lastspike_ - get_delay(), get_delay() );
+  }
+
   void
   set_weight( double w )
   {
@@ -208,7 +245,7 @@ private:
   double
   facilitate_( double w, double kplus, const STDPPLHomCommonProperties& cp )
   {
-    return w + ( cp.lambda_ * std::pow( w, cp.mu_ ) * kplus );
+    return w + ( cp.lambda_ * numerics::pow( w, cp.mu_ ) * kplus );
   }
 
   double
@@ -261,7 +298,8 @@ STDPPLConnectionHom< targetidentifierT >::send( Event& e, thread t, const STDPPL
     // get_history() should make sure that
     // start->t_ > t_lastspike - dendritic_delay, i.e. minus_dt < 0
     assert( minus_dt < -1.0 * kernel().connection_manager.get_stdp_eps() );
-    weight_ = facilitate_( weight_, Kplus_ * std::exp( minus_dt * cp.tau_plus_inv_ ), cp );
+    const double decay = cp.tabulate_decay_ ? cp.decay_plus_( minus_dt ) : std::exp( minus_dt * cp.tau_plus_inv_ );
+    weight_ = facilitate_( weight_, Kplus_ * decay, cp );
   }
 
   // depression due to new pre-synaptic spike
@@ -273,7 +311,9 @@ STDPPLConnectionHom< targetidentifierT >::send( Event& e, thread t, const STDPPL
   e.set_rport( get_rport() );
   e();
 
-  Kplus_ = Kplus_ * std::exp( ( t_lastspike_ - t_spike ) * cp.tau_plus_inv_ ) + 1.0;
+  const double decay = cp.tabulate_decay_ ? cp.decay_plus_( t_lastspike_ - t_spike )
+                                         : std::exp( ( t_lastspike_ - t_spike ) * cp.tau_plus_inv_ );
+  Kplus_ = Kplus_ * decay + 1.0;
 
   t_lastspike_ = t_spike;
 }
@@ -310,6 +350,24 @@ STDPPLConnectionHom< targetidentifierT >::get_status( DictionaryDatum& d ) const
   def< long >( d, names::size_of, sizeof( *this ) );
 }
 
+template < typename targetidentifierT >
+void
+STDPPLConnectionHom< targetidentifierT >::save_state( std::ostream& os ) const
+{
+  write_binary( os, weight_ );
+  write_binary( os, Kplus_ );
+  write_binary( os, t_lastspike_ );
+}
+
+template < typename targetidentifierT >
+void
+STDPPLConnectionHom< targetidentifierT >::load_state( std::istream& is )
+{
+  read_binary( is, weight_ );
+  read_binary( is, Kplus_ );
+  read_binary( is, t_lastspike_ );
+}
+
 template < typename targetidentifierT >
 void
 STDPPLConnectionHom< targetidentifierT >::set_status( const DictionaryDatum& d, ConnectorModel& cm )
@@ -173,6 +173,22 @@ nest::weight_recorder::get_status( DictionaryDatum& d ) const
   P_.get( d );
 }
 
+void
+nest::weight_recorder::take_events( DictionaryDatum& events )
+{
+  device_.take_events( events );
+
+  if ( get_thread() == 0 )
+  {
+    const SiblingContainer* siblings = kernel().node_manager.get_thread_siblings( get_gid() );
+    std::vector< Node* >::const_iterator sibling;
+    for ( sibling = siblings->begin() + 1; sibling != siblings->end(); ++sibling )
+    {
+      ( *sibling )->take_events( events );
+    }
+  }
+}
+
 void
 nest::weight_recorder::set_status( const DictionaryDatum& d )
 {
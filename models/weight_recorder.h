@@ -103,6 +103,8 @@ public:
   void get_status( DictionaryDatum& ) const;
   void set_status( const DictionaryDatum& );
 
+  void take_events( DictionaryDatum& );
+
 private:
   void init_state_( Node const& );
   void init_buffers_();
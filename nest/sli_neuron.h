@@ -124,6 +124,12 @@ public:
   void get_status( DictionaryDatum& ) const;
   void set_status( const DictionaryDatum& );
 
+  /**
+   * The copied state dictionary shares its entries with the prototype,
+   * whose reference counts are not atomic.
+   */
+  bool has_thread_safe_copy() const;
+
 private:
   DictionaryDatum get_status_dict_();
 
@@ -211,6 +217,12 @@ private:
   /** @} */
 };
 
+inline bool
+sli_neuron::has_thread_safe_copy() const
+{
+  return false;
+}
+
 inline port
 sli_neuron::send_test_event( Node& target, rport receptor_type, synindex, bool )
 {
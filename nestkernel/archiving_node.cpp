@@ -29,6 +29,12 @@
 
 #include "archiving_node.h"
 
+// C++ includes:
+#include <cassert>
+
+// Includes from libnestutil:
+#include "binary_io.h"
+
 // Includes from nestkernel:
 #include "kernel_manager.h"
 
@@ -42,6 +48,7 @@ namespace nest
 
 nest::Archiving_Node::Archiving_Node()
   : n_incoming_( 0 )
+  , n_waiting_for_next_( 0 )
   , Kminus_( 0.0 )
   , triplet_Kminus_( 0.0 )
   , tau_minus_( 20.0 )
@@ -60,6 +67,7 @@ nest::Archiving_Node::Archiving_Node()
 nest::Archiving_Node::Archiving_Node( const Archiving_Node& n )
   : Node( n )
   , n_incoming_( n.n_incoming_ )
+  , n_waiting_for_next_( n.n_incoming_ )
   , Kminus_( n.Kminus_ )
   , triplet_Kminus_( n.triplet_Kminus_ )
   , tau_minus_( n.tau_minus_ )
@@ -80,16 +88,17 @@ nest::Archiving_Node::Archiving_Node( const Archiving_Node& n )
 void
 Archiving_Node::register_stdp_connection( double t_first_read, double delay )
 {
-  // Mark all entries in the deque, which we will not read in future as read by
-  // this input input, so that we savely increment the incoming number of
-  // connections afterwards without leaving spikes in the history.
-  // For details see bug #218. MH 08-04-22
+  // Let the new input wait at the first entry in the deque it will read, so
+  // that the entries before are not kept for it. For details see bug #218.
+  std::deque< histentry >::iterator runner = first_to_read_( t_first_read );
 
-  for ( std::deque< histentry >::iterator runner = history_.begin();
-        runner != history_.end() and ( t_first_read - runner->t_ > -1.0 * kernel().connection_manager.get_stdp_eps() );
-        ++runner )
+  if ( runner == history_.end() )
   {
-    ( runner->access_counter_ )++;
+    ++n_waiting_for_next_;
+  }
+  else
+  {
+    ++runner->n_waiting_;
   }
 
   n_incoming_++;
@@ -97,6 +106,51 @@ Archiving_Node::register_stdp_connection( double t_first_read, double delay )
   max_delay_ = std::max( delay, max_delay_ );
 }
 
+void
+nest::Archiving_Node::reregister_stdp_connection( double t_old_first_read, double t_first_read, double delay )
+{
+  // The connection waits at the first entry it has not read with its
+  // previous delay. This entry cannot have been removed from the history.
+  std::deque< histentry >::iterator runner = first_to_read_( t_old_first_read );
+  if ( runner == history_.end() )
+  {
+    assert( n_waiting_for_next_ > 0 );
+    --n_waiting_for_next_;
+  }
+  else
+  {
+    assert( runner->n_waiting_ > 0 );
+    --runner->n_waiting_;
+  }
+
+  // Entries read with the new delay that have already been removed are
+  // skipped, as in register_stdp_connection().
+  runner = first_to_read_( t_first_read );
+  if ( runner == history_.end() )
+  {
+    ++n_waiting_for_next_;
+  }
+  else
+  {
+    ++runner->n_waiting_;
+  }
+
+  max_delay_ = std::max( delay, max_delay_ );
+}
+
+std::deque< nest::histentry >::iterator
+nest::Archiving_Node::first_to_read_( double t_first_read )
+{
+  // same condition as for the start of the entries read by get_history()
+  std::deque< histentry >::iterator runner = history_.begin();
+  while (
+    runner != history_.end() and ( t_first_read - runner->t_ > -1.0 * kernel().connection_manager.get_stdp_eps() ) )
+  {
+    ++runner;
+  }
+  return runner;
+}
+
 double
 nest::Archiving_Node::get_K_value( double t )
 {
@@ -186,10 +240,26 @@ nest::Archiving_Node::get_history( double t1,
   *finish = runner.base();
   while ( runner != history_.rend() and runner->t_ >= t1_lim )
   {
-    runner->access_counter_++;
     ++runner;
   }
   *start = runner.base();
+
+  // The reading connection waited at start and now waits at finish. As the
+  // ranges read by a connection are consecutive, this accounts for all
+  // entries read, without touching them.
+  if ( *start != *finish )
+  {
+    assert( ( *start )->n_waiting_ > 0 );
+    --( *start )->n_waiting_;
+    if ( *finish == history_.end() )
+    {
+      ++n_waiting_for_next_;
+    }
+    else
+    {
+      ++( *finish )->n_waiting_;
+    }
+  }
 }
 
 void
@@ -203,14 +273,14 @@ nest::Archiving_Node::set_spiketime( Time const& t_sp, double offset )
   {
     // prune all spikes from history which are no longer needed
     // only remove a spike if:
-    // - its access counter indicates it has been read out by all connected
-    //   STDP synapses, and
+    // - no connected STDP synapse waits to read it, i.e., it has been read
+    //   out by all of them, and
     // - there is another, later spike, that is strictly more than
     //   (max_delay_ + eps) away from the new spike (at t_sp_ms)
     while ( history_.size() > 1 )
     {
       const double next_t_sp = history_[ 1 ].t_;
-      if ( history_.front().access_counter_ >= n_incoming_
+      if ( history_.front().n_waiting_ == 0
         and t_sp_ms - next_t_sp > max_delay_ + kernel().connection_manager.get_stdp_eps() )
       {
         history_.pop_front();
@@ -224,7 +294,8 @@ nest::Archiving_Node::set_spiketime( Time const& t_sp, double offset )
     Kminus_ = Kminus_ * std::exp( ( last_spike_ - t_sp_ms ) * tau_minus_inv_ ) + 1.0;
     triplet_Kminus_ = triplet_Kminus_ * std::exp( ( last_spike_ - t_sp_ms ) * tau_minus_triplet_inv_ ) + 1.0;
     last_spike_ = t_sp_ms;
-    history_.push_back( histentry( last_spike_, Kminus_, triplet_Kminus_, 0 ) );
+    history_.push_back( histentry( last_spike_, Kminus_, triplet_Kminus_, n_waiting_for_next_ ) );
+    n_waiting_for_next_ = 0;
   }
   else
   {
@@ -346,10 +417,82 @@ nest::Archiving_Node::clear_history()
   Kminus_ = 0.0;
   triplet_Kminus_ = 0.0;
   history_.clear();
+  n_waiting_for_next_ = n_incoming_;
   Ca_minus_ = 0.0;
   Ca_t_ = 0.0;
 }
 
+void
+nest::Archiving_Node::save_archiving_state_( std::ostream& os ) const
+{
+  if ( not synaptic_elements_map_.empty() )
+  {
+    throw CheckpointError( "Checkpoints of nodes with synaptic elements are not supported." );
+  }
+
+  write_binary( os, n_incoming_ );
+  write_binary( os, n_waiting_for_next_ );
+  write_binary( os, Kminus_ );
+  write_binary( os, triplet_Kminus_ );
+  write_binary( os, tau_minus_ );
+  write_binary( os, tau_minus_inv_ );
+  write_binary( os, tau_minus_triplet_ );
+  write_binary( os, tau_minus_triplet_inv_ );
+  write_binary( os, max_delay_ );
+  write_binary( os, trace_ );
+  write_binary( os, last_spike_ );
+  write_binary( os, Ca_t_ );
+  write_binary( os, Ca_minus_ );
+  write_binary( os, tau_Ca_ );
+  write_binary( os, beta_Ca_ );
+
+  // histentry has no default constructor, so entries are written field by field
+  write_binary( os, history_.size() );
+  for ( std::deque< histentry >::const_iterator it = history_.begin(); it != history_.end(); ++it )
+  {
+    write_binary( os, it->t_ );
+    write_binary( os, it->Kminus_ );
+    write_binary( os, it->triplet_Kminus_ );
+    write_binary( os, it->n_waiting_ );
+  }
+}
+
+void
+nest::Archiving_Node::load_archiving_state_( std::istream& is )
+{
+  read_binary( is, n_incoming_ );
+  read_binary( is, n_waiting_for_next_ );
+  read_binary( is, Kminus_ );
+  read_binary( is, triplet_Kminus_ );
+  read_binary( is, tau_minus_ );
+  read_binary( is, tau_minus_inv_ );
+  read_binary( is, tau_minus_triplet_ );
+  read_binary( is, tau_minus_triplet_inv_ );
+  read_binary( is, max_delay_ );
+  read_binary( is, trace_ );
+  read_binary( is, last_spike_ );
+  read_binary( is, Ca_t_ );
+  read_binary( is, Ca_minus_ );
+  read_binary( is, tau_Ca_ );
+  read_binary( is, beta_Ca_ );
+
+  size_t history_size = 0;
+  read_binary( is, history_size );
+  history_.clear();
+  for ( size_t i = 0; i < history_size; ++i )
+  {
+    double t = 0.0;
+    double Kminus = 0.0;
+    double triplet_Kminus = 0.0;
+    size_t n_waiting = 0;
+    read_binary( is, t );
+    read_binary( is, Kminus );
+    read_binary( is, triplet_Kminus );
+    read_binary( is, n_waiting );
+    history_.push_back( histentry( t, Kminus, triplet_Kminus, n_waiting ) );
+  }
+}
+
 
 /* ----------------------------------------------------------------
 * Get the number of synaptic_elements
@@ -71,6 +71,13 @@ public:
    * Copy Constructor.
    */
   Archiving_Node( const Archiving_Node& );
+
+  /**
+   * Copies of synaptic elements create their growth curves with
+   * dictionaries, which are not thread safe.
+   */
+  bool has_thread_safe_copy() const;
+
   /**
 
    * \fn double get_Ca_minus()
@@ -176,7 +183,9 @@ public:
    * std::deque<Archiver::histentry>::iterator* start,
    * std::deque<Archiver::histentry>::iterator* finish)
    * return the spike times (in steps) of spikes which occurred in the range
-   * (t1,t2].
+   * (t1,t2]. Each incoming connection must read consecutive ranges, i.e.,
+   * t1 must be t2 of its previous call. The entries in the range are not
+   * modified.
    */
   void get_history( double t1,
     double t2,
@@ -191,6 +200,17 @@ public:
    */
   void register_stdp_connection( double t_first_read, double delay );
 
+  /**
+   * Move a registered STDP connection whose delay has changed to the
+   * place in the history where it continues reading.
+   *
+   * t_old_first_read: The synapse would have read the history entries
+   * with t > t_old_first_read with its previous delay.
+   * t_first_read: The synapse will read the history entries with
+   * t > t_first_read with its new delay.
+   */
+  void reregister_stdp_connection( double t_old_first_read, double t_first_read, double delay );
+
   void get_status( DictionaryDatum& d ) const;
   void set_status( const DictionaryDatum& d );
 
@@ -219,11 +239,31 @@ protected:
    */
   void clear_history();
 
+  /**
+   * Return the first entry of the history with t > t_first_read, at which
+   * a connection reading from t_first_read waits.
+   */
+  std::deque< histentry >::iterator first_to_read_( double t_first_read );
+
+  /**
+   * Write spike history, traces and calcium concentration to a
+   * checkpoint, for use in save_state() of derived models.
+   * @throws CheckpointError if the node has synaptic elements
+   */
+  void save_archiving_state_( std::ostream& ) const;
+
+  //! Restore the state written by save_archiving_state_()
+  void load_archiving_state_( std::istream& );
+
   // number of incoming connections from stdp connectors.
   // needed to determine, if every incoming connection has
   // read the spikehistory for a given point in time
   size_t n_incoming_;
 
+  // number of incoming connections which have read all entries of the
+  // history; they will wait at the next entry added
+  size_t n_waiting_for_next_;
+
 private:
   // sum exp(-(t-ti)/tau_minus)
   double Kminus_;
@@ -288,5 +328,11 @@ Archiving_Node::get_Ca_minus() const
   return Ca_minus_;
 }
 
+inline bool
+Archiving_Node::has_thread_safe_copy() const
+{
+  return synaptic_elements_map_.empty();
+}
+
 } // of namespace
 #endif
@@ -0,0 +1,243 @@
+/*
+ *  async_writer.cpp
+ *
+ *  This file is part of NEST.
+ *
+ *  Copyright (C) 2004 The NEST Initiative
+ *
+ *  NEST is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  NEST is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with NEST.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "async_writer.h"
+
+// C++ includes:
+#include <cassert>
+#include <chrono>
+
+// Includes from libnestutil:
+#include "compose.hpp"
+#include "logging.h"
+
+// Includes from nestkernel:
+#include "kernel_manager.h"
+
+// Includes from sli:
+#include "sliexceptions.h"
+
+const size_t nest::AsyncWriter::batch_size;
+const size_t nest::AsyncWriter::queue_capacity;
+
+nest::AsyncWriter::Queue::Queue()
+  : chunks_( queue_capacity )
+  , head_( 0 )
+  , tail_( 0 )
+  , bytes_( 0 )
+{
+}
+
+nest::AsyncWriter::AsyncWriter()
+  : queues_()
+  , max_bytes_( 0 )
+  , thread_()
+  , stop_( false )
+  , num_queued_( 0 )
+  , mutex_()
+  , cv_()
+  , failed_file_()
+{
+}
+
+nest::AsyncWriter::~AsyncWriter()
+{
+  stop();
+}
+
+void
+nest::AsyncWriter::start( size_t num_threads, size_t max_bytes )
+{
+  assert( not is_running() );
+  assert( max_bytes > 0 );
+
+  queues_.resize( num_threads );
+  for ( size_t t = 0; t < num_threads; ++t )
+  {
+    queues_[ t ] = new Queue();
+  }
+  max_bytes_ = max_bytes;
+  failed_file_.clear();
+
+  stop_ = false;
+  thread_ = std::thread( &AsyncWriter::run_, this );
+}
+
+void
+nest::AsyncWriter::stop()
+{
+  if ( not is_running() )
+  {
+    return;
+  }
+
+  stop_ = true;
+  cv_.notify_one();
+  thread_.join();
+
+  for ( size_t t = 0; t < queues_.size(); ++t )
+  {
+    delete queues_[ t ];
+  }
+  queues_.clear();
+}
+
+void
+nest::AsyncWriter::write( thread tid,
+  std::ostream& os,
+  const std::string& filename,
+  std::string& data,
+  bool flush )
+{
+  if ( data.empty() and not flush )
+  {
+    return;
+  }
+
+  if ( not is_running() )
+  {
+    // writer stopped while devices were set up for it, write directly
+    os.write( data.data(), data.size() );
+    if ( flush )
+    {
+      os.flush();
+    }
+    data.clear();
+    return;
+  }
+
+  Queue& q = *queues_[ tid ];
+  const size_t tail = q.tail_.load( std::memory_order_relaxed );
+
+  // Wait for space in the queue. A chunk larger than max_bytes_ is only
+  // accepted by an empty queue.
+  while ( tail - q.head_.load( std::memory_order_acquire ) == queue_capacity
+    or ( q.bytes_.load( std::memory_order_acquire ) > 0 and q.bytes_ + data.size() > max_bytes_ ) )
+  {
+    cv_.notify_one();
+    std::this_thread::yield();
+  }
+
+  Chunk& c = q.chunks_[ tail % queue_capacity ];
+  c.os = &os;
+  c.filename = &filename;
+  c.data.swap( data );
+  c.flush = flush;
+
+  q.bytes_ += c.data.size();
+  ++num_queued_;
+  q.tail_.store( tail + 1, std::memory_order_release );
+
+  if ( q.bytes_.load( std::memory_order_relaxed ) >= batch_size )
+  {
+    cv_.notify_one();
+  }
+}
+
+void
+nest::AsyncWriter::drain()
+{
+  if ( not is_running() )
+  {
+    return;
+  }
+
+  cv_.notify_one();
+  while ( num_queued_.load( std::memory_order_acquire ) > 0 )
+  {
+    std::this_thread::yield();
+  }
+
+  std::string failed_file;
+  {
+    std::lock_guard< std::mutex > lock( mutex_ );
+    failed_file.swap( failed_file_ );
+  }
+  if ( not failed_file.empty() )
+  {
+    std::string msg = String::compose( "I/O error while writing file '%1'", failed_file );
+    LOG( M_ERROR, "AsyncWriter::drain()", msg );
+
+    throw IOError();
+  }
+}
+
+void
+nest::AsyncWriter::run_()
+{
+  while ( true )
+  {
+    if ( write_queued_() )
+    {
+      continue;
+    }
+
+    // stop only once all data has been written
+    if ( stop_ )
+    {
+      break;
+    }
+
+    // producers do not wake us for small chunks, so poll regularly
+    std::unique_lock< std::mutex > lock( mutex_ );
+    cv_.wait_for( lock, std::chrono::milliseconds( 1 ) );
+  }
+}
+
+bool
+nest::AsyncWriter::write_queued_()
+{
+  bool have_written = false;
+
+  for ( size_t t = 0; t < queues_.size(); ++t )
+  {
+    Queue& q = *queues_[ t ];
+    const size_t tail = q.tail_.load( std::memory_order_acquire );
+    for ( size_t head = q.head_.load( std::memory_order_relaxed ); head != tail; ++head )
+    {
+      Chunk& c = q.chunks_[ head % queue_capacity ];
+      c.os->write( c.data.data(), c.data.size() );
+      if ( c.flush )
+      {
+        c.os->flush();
+      }
+      if ( not c.os->good() )
+      {
+        std::lock_guard< std::mutex > lock( mutex_ );
+        if ( failed_file_.empty() )
+        {
+          failed_file_ = *c.filename;
+        }
+      }
+
+      const size_t size = c.data.size();
+      std::string().swap( c.data ); // release memory of written chunk
+
+      q.bytes_ -= size;
+      q.head_.store( head + 1, std::memory_order_release );
+      --num_queued_;
+      have_written = true;
+    }
+  }
+
+  return have_written;
+}
@@ -0,0 +1,159 @@
+/*
+ *  async_writer.h
+ *
+ *  This file is part of NEST.
+ *
+ *  Copyright (C) 2004 The NEST Initiative
+ *
+ *  NEST is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  NEST is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with NEST.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifndef ASYNC_WRITER_H
+#define ASYNC_WRITER_H
+
+// C++ includes:
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+#include <ostream>
+#include <string>
+#include <thread>
+#include <vector>
+
+// Includes from nestkernel:
+#include "nest_types.h"
+
+namespace nest
+{
+
+/**
+ * Background thread writing the file output of recording devices.
+ *
+ * Recording devices collect their output in memory and hand it over in
+ * batches of about batch_size bytes. Each simulation thread has its own
+ * single-producer single-consumer queue, so handing over data requires
+ * no locks. The writer thread takes the batches from all queues and
+ * writes them to the output streams in the order in which they were
+ * queued per thread.
+ *
+ * The queue of a thread holds at most max_bytes bytes. A thread trying to
+ * queue more data waits until the writer has caught up (back-pressure).
+ *
+ * drain() waits until all queued data has been written. The streams must
+ * not be used by anyone else while data for them is queued.
+ */
+class AsyncWriter
+{
+public:
+  //! Devices hand over their output once it exceeds this number of bytes
+  static const size_t batch_size = 1 << 16;
+
+  AsyncWriter();
+  ~AsyncWriter();
+
+  /**
+   * Start writer thread with one queue per simulation thread.
+   * @param num_threads number of simulation threads
+   * @param max_bytes maximum number of bytes held by each queue
+   */
+  void start( size_t num_threads, size_t max_bytes );
+
+  /**
+   * Write all queued data and stop writer thread.
+   */
+  void stop();
+
+  bool
+  is_running() const
+  {
+    return thread_.joinable();
+  }
+
+  size_t
+  get_num_queues() const
+  {
+    return queues_.size();
+  }
+
+  /**
+   * Queue data to be written to a stream.
+   *
+   * Must only be called by simulation thread tid. The content of data is
+   * moved into the queue, data is empty on return.
+   * @param tid simulation thread
+   * @param os stream to write to
+   * @param filename name of file for error messages, must remain valid until
+   *                 the data has been written
+   * @param data data to write
+   * @param flush if true, flush stream after writing
+   */
+  void write( thread tid, std::ostream& os, const std::string& filename, std::string& data, bool flush );
+
+  /**
+   * Wait until all queued data has been written.
+   * @throws IOError if writing to any stream failed
+   */
+  void drain();
+
+private:
+  //! Maximum number of chunks per queue
+  static const size_t queue_capacity = 1024;
+
+  struct Chunk
+  {
+    std::ostream* os;
+    const std::string* filename;
+    std::string data;
+    bool flush;
+  };
+
+  /**
+   * Ring buffer of chunks.
+   *
+   * head_ and tail_ count the chunks taken and queued, respectively,
+   * chunk i is in slot i % queue_capacity. Only the simulation thread
+   * modifies tail_, only the writer thread modifies head_.
+   */
+  struct Queue
+  {
+    std::vector< Chunk > chunks_;
+    std::atomic< size_t > head_;
+    std::atomic< size_t > tail_;
+    std::atomic< size_t > bytes_; //!< number of bytes queued
+
+    Queue();
+  };
+
+  //! Main loop of writer thread
+  void run_();
+
+  //! Write all queued chunks, return false if there were none
+  bool write_queued_();
+
+  std::vector< Queue* > queues_;
+  size_t max_bytes_;
+
+  std::thread thread_;
+  std::atomic< bool > stop_;
+  std::atomic< size_t > num_queued_; //!< number of chunks not yet written
+
+  std::mutex mutex_;           //!< protects failed_file_, used by cv_
+  std::condition_variable cv_; //!< wakes writer thread
+  std::string failed_file_;    //!< name of first file that could not be written
+};
+
+} // namespace nest
+
+#endif /* ASYNC_WRITER_H */
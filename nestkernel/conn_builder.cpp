@@ -33,6 +33,7 @@
 #include "gsl_binomial_randomdev.h"
 #include "gslrandomgen.h"
 #include "normal_randomdev.h"
+#include "typed_randomgen.h"
 
 // Includes from nestkernel:
 #include "conn_builder_impl.h"
@@ -66,6 +67,7 @@ nest::ConnBuilder::ConnBuilder( const GIDCollection& sources,
   , delay_( 0 )
   , param_dicts_()
   , parameters_requiring_skipping_()
+  , rng_purpose_( kernel().rng_manager.next_connection_purpose() )
 {
   // read out rule-related parameters -------------------------
   //  - /rule has been taken care of above
@@ -545,6 +547,16 @@ nest::ConnBuilder::loop_over_targets_() const
     or parameters_requiring_skipping_.size() > 0;
 }
 
+librandom::RngPtr
+nest::ConnBuilder::get_target_rng_( thread tid, index tgid, librandom::RngPtr& rng ) const
+{
+  if ( kernel().rng_manager.keyed_connection_rngs() )
+  {
+    return kernel().rng_manager.get_keyed_rng( tid, rng_purpose_, tgid, 0 );
+  }
+  return rng;
+}
+
 nest::OneToOneBuilder::OneToOneBuilder( const GIDCollection& sources,
   const GIDCollection& targets,
   const DictionaryDatum& conn_spec,
@@ -601,7 +613,8 @@ nest::OneToOneBuilder::connect_()
             continue;
           }
 
-          single_connect_( *sgid, *target, target_thread, rng );
+          librandom::RngPtr target_rng = get_target_rng_( tid, *tgid, rng );
+          single_connect_( *sgid, *target, target_thread, target_rng );
         }
       }
       else
@@ -636,7 +649,8 @@ nest::OneToOneBuilder::connect_()
             continue;
           }
 
-          single_connect_( sgid, *target, target_thread, rng );
+          librandom::RngPtr target_rng = get_target_rng_( tid, tgid, rng );
+          single_connect_( sgid, *target, target_thread, target_rng );
         }
       }
     }
@@ -821,7 +835,8 @@ nest::AllToAllBuilder::connect_()
 
           Node* const target = kernel().node_manager.get_node( *tgid, tid );
 
-          inner_connect_( tid, rng, target, *tgid, true );
+          librandom::RngPtr target_rng = get_target_rng_( tid, *tgid, rng );
+          inner_connect_( tid, target_rng, target, *tgid, true );
         }
       }
       else
@@ -839,7 +854,8 @@ nest::AllToAllBuilder::connect_()
             continue;
           }
 
-          inner_connect_( tid, rng, target, tgid, false );
+          librandom::RngPtr target_rng = get_target_rng_( tid, tgid, rng );
+          inner_connect_( tid, target_rng, target, tgid, false );
         }
       }
     }
@@ -1091,7 +1107,8 @@ nest::FixedInDegreeBuilder::connect_()
 
           Node* target = kernel().node_manager.get_node( *tgid, tid );
 
-          inner_connect_( tid, rng, target, *tgid, true );
+          librandom::RngPtr target_rng = get_target_rng_( tid, *tgid, rng );
+          inner_connect_( tid, target_rng, target, *tgid, true );
         }
       }
       else
@@ -1109,7 +1126,8 @@ nest::FixedInDegreeBuilder::connect_()
             continue;
           }
 
-          inner_connect_( tid, rng, target, tgid, false );
+          librandom::RngPtr target_rng = get_target_rng_( tid, tgid, rng );
+          inner_connect_( tid, target_rng, target, tgid, false );
         }
       }
     }
@@ -1138,6 +1156,16 @@ nest::FixedInDegreeBuilder::inner_connect_( const int tid, librandom::RngPtr& rn
     return;
   }
 
+  ConnectSources_ connect_sources = { this, &rng, target, tgid };
+  librandom::with_typed_rng( *rng, connect_sources );
+}
+
+template < typename TypedRng >
+void
+nest::FixedInDegreeBuilder::connect_sources_( TypedRng& trng, librandom::RngPtr& rng, Node* target, index tgid )
+{
+  const thread target_thread = target->get_thread();
+
   std::set< long > ch_ids;
   long n_rnd = sources_->size();
 
@@ -1148,7 +1176,7 @@ nest::FixedInDegreeBuilder::inner_connect_( const int tid, librandom::RngPtr& rn
 
     do
     {
-      s_id = rng->ulrand( n_rnd );
+      s_id = trng.ulrand( n_rnd );
       sgid = ( *sources_ )[ s_id ];
     } while ( ( not autapses_ and sgid == tgid ) or ( not multapses_ and ch_ids.find( s_id ) != ch_ids.end() ) );
 
@@ -1210,6 +1238,200 @@ nest::FixedOutDegreeBuilder::FixedOutDegreeBuilder( const GIDCollection& sources
 
 void
 nest::FixedOutDegreeBuilder::connect_()
+{
+  if ( can_split_() )
+  {
+    connect_split_();
+  }
+  else
+  {
+    connect_global_();
+  }
+}
+
+bool
+nest::FixedOutDegreeBuilder::can_split_() const
+{
+  if ( not multapses_ or parameters_requiring_skipping_.size() > 0 or kernel().rng_manager.keyed_connection_rngs()
+    or ( not autapses_ and not targets_->is_range() ) )
+  {
+    return false;
+  }
+
+  if ( targets_->is_range() )
+  {
+    const index last = ( *targets_ )[ targets_->size() - 1 ];
+    for ( index gid = ( *targets_ )[ 0 ]; gid <= last; )
+    {
+      const modelrange& range = kernel().modelrange_manager.get_contiguous_gid_range( gid );
+      if ( not kernel().model_manager.get_model( range.get_model_id() )->has_proxies() )
+      {
+        return false;
+      }
+      gid = range.get_last_gid() + 1;
+    }
+  }
+  else
+  {
+    for ( GIDCollection::const_iterator tgid = targets_->begin(); tgid != targets_->end(); ++tgid )
+    {
+      if ( not kernel().modelrange_manager.get_model_of_gid( *tgid )->has_proxies() )
+      {
+        return false;
+      }
+    }
+  }
+  return true;
+}
+
+void
+nest::FixedOutDegreeBuilder::connect_split_()
+{
+  const size_t n_vps = kernel().vp_manager.get_num_virtual_processes();
+  const size_t n_targets = targets_->size();
+  const bool is_range = targets_->is_range();
+  const index first = ( *targets_ )[ 0 ];
+  const index last = ( *targets_ )[ n_targets - 1 ];
+
+  // cumulative number of targets on virtual processes 0, ..., vp - 1
+  std::vector< size_t > targets_below_vp( n_vps + 1, 0 );
+  if ( is_range )
+  {
+    for ( size_t vp = 0; vp < n_vps; ++vp )
+    {
+      const index first_on_vp = first + ( vp + n_vps - first % n_vps ) % n_vps;
+      targets_below_vp[ vp + 1 ] = first_on_vp > last ? 0 : ( last - first_on_vp ) / n_vps + 1;
+    }
+  }
+  else
+  {
+    for ( GIDCollection::const_iterator tgid = targets_->begin(); tgid != targets_->end(); ++tgid )
+    {
+      ++targets_below_vp[ kernel().vp_manager.suggest_vp_for_gid( *tgid ) + 1 ];
+    }
+  }
+  for ( size_t vp = 0; vp < n_vps; ++vp )
+  {
+    targets_below_vp[ vp + 1 ] += targets_below_vp[ vp ];
+  }
+
+#pragma omp parallel
+  {
+    // get thread id
+    const thread tid = kernel().vp_manager.get_thread_id();
+
+    try
+    {
+      const size_t vp = kernel().vp_manager.thread_to_vp( tid );
+
+      // gather the targets on this virtual process
+      std::vector< index > vp_targets;
+      vp_targets.reserve( targets_below_vp[ vp + 1 ] - targets_below_vp[ vp ] );
+      if ( is_range )
+      {
+        for ( index tgid = first + ( vp + n_vps - first % n_vps ) % n_vps; tgid <= last; tgid += n_vps )
+        {
+          vp_targets.push_back( tgid );
+        }
+      }
+      else
+      {
+        for ( GIDCollection::const_iterator tgid = targets_->begin(); tgid != targets_->end(); ++tgid )
+        {
+          if ( kernel().vp_manager.suggest_vp_for_gid( *tgid ) == static_cast< thread >( vp ) )
+          {
+            vp_targets.push_back( *tgid );
+          }
+        }
+      }
+
+      librandom::BinomialRandomDev bino( 0.5, outdegree_ );
+
+      for ( GIDCollection::const_iterator sgid = sources_->begin(); sgid != sources_->end(); ++sgid )
+      {
+        // If autapses are excluded, the targets are a range and the source
+        // is not a valid target on its virtual process.
+        const bool exclude_source = not autapses_ and first <= *sgid and *sgid <= last;
+        const size_t source_vp = kernel().vp_manager.suggest_vp_for_gid( *sgid );
+
+        // descend from the root, covering all virtual processes, to the
+        // leaf of this virtual process; node is the index of the tree node
+        // in heap order and selects its random stream
+        size_t lo = 0;
+        size_t hi = n_vps;
+        unsigned long node = 1;
+        unsigned long n_conns = outdegree_;
+        size_t n_valid = n_targets - ( exclude_source ? 1 : 0 );
+
+        while ( hi - lo > 1 and n_conns > 0 )
+        {
+          const size_t mid = ( lo + hi ) / 2;
+          const size_t n_valid_lower = targets_below_vp[ mid ] - targets_below_vp[ lo ]
+            - ( exclude_source and lo <= source_vp and source_vp < mid ? 1 : 0 );
+
+          unsigned long n_conns_lower;
+          if ( n_valid_lower == 0 )
+          {
+            n_conns_lower = 0;
+          }
+          else if ( n_valid_lower == n_valid )
+          {
+            n_conns_lower = n_conns;
+          }
+          else
+          {
+            librandom::RngPtr rng = kernel().rng_manager.get_keyed_rng( tid, rng_purpose_, *sgid, node );
+            bino.set_p_n( static_cast< double >( n_valid_lower ) / n_valid, n_conns );
+            n_conns_lower = bino.ldev( rng );
+          }
+
+          if ( vp < mid )
+          {
+            hi = mid;
+            n_conns = n_conns_lower;
+            n_valid = n_valid_lower;
+            node = 2 * node;
+          }
+          else
+          {
+            lo = mid;
+            n_conns -= n_conns_lower;
+            n_valid -= n_valid_lower;
+            node = 2 * node + 1;
+          }
+        }
+
+        if ( n_conns == 0 or n_valid == 0 )
+        {
+          continue;
+        }
+
+        // draw the targets on this virtual process
+        librandom::RngPtr rng = kernel().rng_manager.get_keyed_rng( tid, rng_purpose_, *sgid, node );
+        for ( unsigned long j = 0; j < n_conns; ++j )
+        {
+          index tgid;
+          do
+          {
+            tgid = vp_targets[ rng->ulrand( vp_targets.size() ) ];
+          } while ( exclude_source and tgid == *sgid );
+
+          Node* const target = kernel().node_manager.get_node( tgid, tid );
+          single_connect_( *sgid, *target, tid, rng );
+        }
+      }
+    }
+    catch ( std::exception& err )
+    {
+      // We must create a new exception here, err's lifetime ends at
+      // the end of the catch block.
+      exceptions_raised_.at( tid ) = lockPTR< WrappedThreadException >( new WrappedThreadException( err ) );
+    }
+  }
+}
+
+void
+nest::FixedOutDegreeBuilder::connect_global_()
 {
   librandom::RngPtr grng = kernel().rng_manager.get_grng();
 
@@ -1500,7 +1722,8 @@ nest::BernoulliBuilder::connect_()
 
           Node* const target = kernel().node_manager.get_node( *tgid, tid );
 
-          inner_connect_( tid, rng, target, *tgid );
+          librandom::RngPtr target_rng = get_target_rng_( tid, *tgid, rng );
+          inner_connect_( tid, target_rng, target, *tgid );
         }
       }
 
@@ -1519,7 +1742,8 @@ nest::BernoulliBuilder::connect_()
             continue;
           }
 
-          inner_connect_( tid, rng, target, tgid );
+          librandom::RngPtr target_rng = get_target_rng_( tid, tgid, rng );
+          inner_connect_( tid, target_rng, target, tgid );
         }
       }
     }
@@ -1543,6 +1767,16 @@ nest::BernoulliBuilder::inner_connect_( const int tid, librandom::RngPtr& rng, N
     return;
   }
 
+  ConnectSources_ connect_sources = { this, &rng, target, tgid };
+  librandom::with_typed_rng( *rng, connect_sources );
+}
+
+template < typename TypedRng >
+void
+nest::BernoulliBuilder::connect_sources_( TypedRng& trng, librandom::RngPtr& rng, Node* target, index tgid )
+{
+  const thread target_thread = target->get_thread();
+
   // It is not possible to create multapses with this type of BernoulliBuilder,
   // hence leave out corresponding checks.
 
@@ -1553,7 +1787,7 @@ nest::BernoulliBuilder::inner_connect_( const int tid, librandom::RngPtr& rng, N
       continue;
     }
 
-    if ( rng->drand() >= p_ )
+    if ( trng.drand() >= p_ )
     {
       continue;
     }
@@ -173,6 +173,16 @@ protected:
    */
   bool loop_over_targets_() const;
 
+  /**
+   * Returns the random generator for the connections of target tgid.
+   *
+   * This is rng, the generator of the thread, unless the kernel property
+   * keyed_connection_rngs is set. Then it is the keyed stream of tgid for
+   * this connection call, which does not depend on the number of threads
+   * and processes.
+   */
+  librandom::RngPtr get_target_rng_( thread, index tgid, librandom::RngPtr& rng ) const;
+
   GIDCollection const* sources_;
   GIDCollection const* targets_;
 
@@ -237,6 +247,9 @@ private:
 protected:
   //! pointers to connection parameters specified as arrays
   std::vector< ConnParameter* > parameters_requiring_skipping_;
+
+  //! purpose of the keyed random streams used by this builder
+  unsigned long rng_purpose_;
 };
 
 class OneToOneBuilder : public ConnBuilder
@@ -310,6 +323,30 @@ protected:
 
 private:
   void inner_connect_( const int, librandom::RngPtr&, Node*, index, bool );
+
+  /**
+   * Draw and connect the sources of one target. Sources are drawn
+   * through trng, which gives non-virtual access to rng.
+   */
+  template < typename TypedRng >
+  void connect_sources_( TypedRng& trng, librandom::RngPtr& rng, Node* target, index tgid );
+
+  //! Calls connect_sources_() with the typed generator, for with_typed_rng()
+  struct ConnectSources_
+  {
+    FixedInDegreeBuilder* builder;
+    librandom::RngPtr* rng;
+    Node* target;
+    index tgid;
+
+    template < typename TypedRng >
+    void
+    operator()( TypedRng& trng )
+    {
+      builder->connect_sources_( trng, *rng, target, tgid );
+    }
+  };
+
   long indegree_;
 };
 
@@ -322,6 +359,33 @@ protected:
   void connect_();
 
 private:
+  /**
+   * Draw the targets of all sources from the global RNG on every
+   * process, then connect the local ones. The work per process is
+   * proportional to the total number of connections.
+   */
+  void connect_global_();
+
+  /**
+   * Split the outdegree of each source over the virtual processes by a
+   * binary tree of binomial draws, and draw only the targets on local
+   * virtual processes. Each node of the tree draws from its own keyed
+   * stream, so all virtual processes agree on the split without
+   * communication. The work per virtual process is proportional to the
+   * number of sources times log of the number of virtual processes plus
+   * the number of local connections.
+   */
+  void connect_split_();
+
+  /**
+   * Return true if connect_split_() can be used. This requires multapses,
+   * no parameter arrays, targets with proxies and, if autapses are
+   * excluded, a range of targets. With keyed_connection_rngs set,
+   * connect_global_() is used, as the split depends on the number of
+   * virtual processes.
+   */
+  bool can_split_() const;
+
   long outdegree_;
 };
 
@@ -347,6 +411,31 @@ protected:
 
 private:
   void inner_connect_( const int, librandom::RngPtr&, Node*, index );
+
+  /**
+   * Connect the sources to one target with probability p_. The
+   * Bernoulli trials are drawn through trng, which gives non-virtual
+   * access to rng.
+   */
+  template < typename TypedRng >
+  void connect_sources_( TypedRng& trng, librandom::RngPtr& rng, Node* target, index tgid );
+
+  //! Calls connect_sources_() with the typed generator, for with_typed_rng()
+  struct ConnectSources_
+  {
+    BernoulliBuilder* builder;
+    librandom::RngPtr* rng;
+    Node* target;
+    index tgid;
+
+    template < typename TypedRng >
+    void
+    operator()( TypedRng& trng )
+    {
+      builder->connect_sources_( trng, *rng, target, tgid );
+    }
+  };
+
   double p_; //!< connection probability
 };
 
@@ -23,6 +23,9 @@
 #ifndef CONNECTION_H
 #define CONNECTION_H
 
+// C++ includes:
+#include <iosfwd>
+
 // Includes from nestkernel:
 #include "common_synapse_properties.h"
 #include "connection_label.h"
@@ -150,6 +153,13 @@ public:
    */
   void set_status( const DictionaryDatum& d, ConnectorModel& cm );
 
+  /**
+   * Called after set_status() has changed the delay of the connection
+   * from old_delay. Connections that read the spike history of their
+   * target override this to move their place in the history.
+   */
+  void delay_changed( const thread tid, const double old_delay );
+
   /**
    * Check syn_spec dictionary for parameters that are not allowed with the
    * given connection.
@@ -167,6 +177,20 @@ public:
    */
   void calibrate( const TimeConverter& );
 
+  /**
+   * Write the state of this connection that changes during simulation
+   * to a binary stream.
+   *
+   * @note Classes supporting checkpoints need to override save_state() and
+   * load_state(), as the base class implementations throw CheckpointError.
+   */
+  void save_state( std::ostream& ) const;
+
+  /**
+   * Read the state written by save_state() from a binary stream.
+   */
+  void load_state( std::istream& );
+
   /**
    * Return the delay of the connection in ms
    */
@@ -372,6 +396,12 @@ Connection< targetidentifierT >::set_status( const DictionaryDatum& d, Connector
   // no call to target_.set_status() because target and rport cannot be changed
 }
 
+template < typename targetidentifierT >
+inline void
+Connection< targetidentifierT >::delay_changed( const thread, const double )
+{
+}
+
 template < typename targetidentifierT >
 inline void
 Connection< targetidentifierT >::check_synapse_params( const DictionaryDatum& d ) const
@@ -391,6 +421,20 @@ Connection< targetidentifierT >::calibrate( const TimeConverter& tc )
   }
 }
 
+template < typename targetidentifierT >
+inline void
+Connection< targetidentifierT >::save_state( std::ostream& ) const
+{
+  throw CheckpointError( "Connection does not support checkpoints." );
+}
+
+template < typename targetidentifierT >
+inline void
+Connection< targetidentifierT >::load_state( std::istream& )
+{
+  throw CheckpointError( "Connection does not support checkpoints." );
+}
+
 template < typename targetidentifierT >
 inline void
 Connection< targetidentifierT >::trigger_update_weight( const thread,
@@ -35,6 +35,7 @@
 #include <vector>
 
 // Includes from libnestutil:
+#include "binary_io.h"
 #include "compose.hpp"
 #include "logging.h"
 
@@ -66,10 +67,14 @@ nest::ConnectionManager::ConnectionManager()
   : connruledict_( new Dictionary() )
   , connbuilder_factories_()
   , min_delay_( 1 )
+  , min_connection_delay_( 1 )
   , max_delay_( 1 )
   , keep_source_table_( true )
   , have_connections_changed_( true )
   , sort_connections_by_source_( true )
+  , incremental_connection_update_( false )
+  , requires_full_update_( true )
+  , incremental_update_( false )
   , has_primary_connections_( false )
   , check_primary_connections_()
   , secondary_connections_exist_( false )
@@ -95,6 +100,8 @@ nest::ConnectionManager::initialize()
   connections_.resize( num_threads );
   secondary_recv_buffer_pos_.resize( num_threads );
   sort_connections_by_source_ = true;
+  requires_full_update_ = true;
+  incremental_update_ = false;
 
   check_primary_connections_.resize( num_threads, false );
   check_secondary_connections_.resize( num_threads, false );
@@ -118,7 +125,7 @@ nest::ConnectionManager::initialize()
 
   // The following line is executed by all processes, no need to communicate
   // this change in delays.
-  min_delay_ = max_delay_ = 1;
+  min_delay_ = min_connection_delay_ = max_delay_ = 1;
 }
 
 void
@@ -130,6 +137,7 @@ nest::ConnectionManager::finalize()
   delete_connections_();
   std::vector< std::vector< ConnectorBase* > >().swap( connections_ );
   std::vector< std::vector< std::vector< size_t > > >().swap( secondary_recv_buffer_pos_ );
+  incremental_connection_update_ = false;
 }
 
 void
@@ -155,6 +163,15 @@ nest::ConnectionManager::set_status( const DictionaryDatum& d )
       "If structural plasticity is enabled, sort_connections_by_source can not "
       "be set to false." );
   }
+
+  // connections that have been communicated are only sorted and kept
+  // consistently if both properties are unchanged
+  if ( d->known( names::keep_source_table ) or d->known( names::sort_connections_by_source ) )
+  {
+    requires_full_update_ = true;
+  }
+  updateValue< bool >( d, names::incremental_connection_update, incremental_connection_update_ );
+
   //  Need to update the saved values if we have changed the delay bounds.
   if ( d->known( names::min_delay ) or d->known( names::max_delay ) )
   {
@@ -172,13 +189,96 @@ void
 nest::ConnectionManager::get_status( DictionaryDatum& dict )
 {
   update_delay_extrema_();
-  def< double >( dict, names::min_delay, Time( Time::step( min_delay_ ) ).get_ms() );
+  def< double >( dict, names::min_delay, Time( Time::step( min_connection_delay_ ) ).get_ms() );
   def< double >( dict, names::max_delay, Time( Time::step( max_delay_ ) ).get_ms() );
 
   const size_t n = get_num_connections();
   def< long >( dict, names::num_connections, n );
   def< bool >( dict, names::keep_source_table, keep_source_table_ );
   def< bool >( dict, names::sort_connections_by_source, sort_connections_by_source_ );
+  def< bool >( dict, names::incremental_connection_update, incremental_connection_update_ );
+}
+
+void
+nest::ConnectionManager::save_checkpoint( std::ostream& os )
+{
+  write_binary( os, min_delay_ );
+  write_binary( os, max_delay_ );
+
+  for ( thread tid = 0; tid < kernel().vp_manager.get_num_threads(); ++tid )
+  {
+    write_binary( os, connections_[ tid ].size() );
+    for ( synindex syn_id = 0; syn_id < connections_[ tid ].size(); ++syn_id )
+    {
+      const bool has_connector = connections_[ tid ][ syn_id ] != NULL;
+      write_binary( os, has_connector );
+      if ( has_connector )
+      {
+        try
+        {
+          connections_[ tid ][ syn_id ]->save_state( os );
+        }
+        catch ( CheckpointError& )
+        {
+          throw CheckpointError( String::compose( "Synapse model %1 does not support checkpoints.",
+            kernel().model_manager.get_synapse_prototype( syn_id ).get_name() ) );
+        }
+      }
+    }
+    target_table_devices_.save_state( tid, os );
+  }
+}
+
+void
+nest::ConnectionManager::load_checkpoint( std::istream& is )
+{
+  update_delay_extrema_();
+
+  delay min_delay = 0;
+  delay max_delay = 0;
+  read_binary( is, min_delay );
+  read_binary( is, max_delay );
+  if ( min_delay != min_delay_ or max_delay != max_delay_ )
+  {
+    throw CheckpointError( "Delays differ from checkpoint." );
+  }
+
+  // The checkpoint was written after connections had been sorted by
+  // the first call to prepare(). Sort the rebuilt connections in the
+  // same way, so that the order of connections matches.
+  if ( have_connections_changed() or kernel().node_manager.have_nodes_changed() )
+  {
+    kernel().node_manager.ensure_valid_thread_local_ids();
+#pragma omp parallel
+    {
+      const thread tid = kernel().vp_manager.get_thread_id();
+      kernel().simulation_manager.update_connection_infrastructure( tid );
+    } // of omp parallel
+  }
+
+  for ( thread tid = 0; tid < kernel().vp_manager.get_num_threads(); ++tid )
+  {
+    size_t num_syn_ids = 0;
+    read_binary( is, num_syn_ids );
+    if ( num_syn_ids != connections_[ tid ].size() )
+    {
+      throw CheckpointError( "Synapse models differ from checkpoint." );
+    }
+    for ( synindex syn_id = 0; syn_id < connections_[ tid ].size(); ++syn_id )
+    {
+      bool has_connector = false;
+      read_binary( is, has_connector );
+      if ( has_connector != ( connections_[ tid ][ syn_id ] != NULL ) )
+      {
+        throw CheckpointError( "Connections differ from checkpoint." );
+      }
+      if ( has_connector )
+      {
+        connections_[ tid ][ syn_id ]->load_state( is );
+      }
+    }
+    target_table_devices_.load_state( tid, is );
+  }
 }
 
 DictionaryDatum
@@ -244,7 +344,7 @@ nest::ConnectionManager::set_synapse_status( const index source_gid,
       or ( ( source->has_proxies() and not target->has_proxies() and not target->local_receiver()
            and connections_[ tid ][ syn_id ] != NULL ) ) )
     {
-      connections_[ tid ][ syn_id ]->set_synapse_status( lcid, dict, cm );
+      connections_[ tid ][ syn_id ]->set_synapse_status( tid, lcid, dict, cm );
     }
     else if ( source->has_proxies() and not target->has_proxies() and target->local_receiver() )
     {
@@ -413,6 +513,15 @@ nest::ConnectionManager::update_delay_extrema_()
   {
     min_delay_ = Time::get_resolution().get_steps();
   }
+
+  min_connection_delay_ = min_delay_;
+  if ( kernel().event_delivery_manager.get_pipeline_spike_communication() )
+  {
+    // Spikes are delivered one time slice late, so a slice must not be
+    // longer than half of the smallest delay. SimulationManager::prepare()
+    // rejects delays of a single step.
+    min_delay_ = std::max( min_connection_delay_ / 2, static_cast< delay >( 1 ) );
+  }
 }
 
 // gid node thread syn_id dict delay weight
@@ -672,29 +781,35 @@ nest::ConnectionManager::increase_connection_count( const thread tid, const syni
 nest::index
 nest::ConnectionManager::find_connection( const thread tid, const synindex syn_id, const index sgid, const index tgid )
 {
-  // lcid will hold the position of the /first/ connection from node
-  // sgid to any local node, or be invalid
-  index lcid = source_table_.find_first_source( tid, syn_id, sgid );
-  if ( lcid == invalid_index )
-  {
-    return invalid_index;
-  }
+  // connections from sgid can be found in each sorted segment of the
+  // source table
+  for ( size_t segment = 0; segment < source_table_.num_segments( tid, syn_id ); ++segment )
+  {
+    // lcid will hold the position of the /first/ connection from node
+    // sgid to any local node in this segment, or be invalid
+    index lcid = source_table_.find_first_source( tid, syn_id, sgid, segment );
+    if ( lcid == invalid_index )
+    {
+      continue;
+    }
 
-  // lcid will hold the position of the /first/ connection from node
-  // sgid to node tgid, or be invalid
-  lcid = connections_[ tid ][ syn_id ]->find_first_target( tid, lcid, tgid );
-  if ( lcid != invalid_index )
-  {
-    return lcid;
+    // lcid will hold the position of the /first/ connection from node
+    // sgid to node tgid, or be invalid
+    lcid = connections_[ tid ][ syn_id ]->find_first_target( tid, lcid, tgid );
+    if ( lcid != invalid_index )
+    {
+      return lcid;
+    }
   }
 
-  return lcid;
+  return invalid_index;
 }
 
 void
 nest::ConnectionManager::disconnect( const thread tid, const synindex syn_id, const index sgid, const index tgid )
 {
   have_connections_changed_ = true;
+  requires_full_update_ = true;
 
   assert( syn_id != invalid_synindex );
 
@@ -1345,10 +1460,13 @@ nest::ConnectionManager::get_targets( const std::vector< index >& sources,
   {
     for ( size_t i = 0; i < sources.size(); ++i )
     {
-      const index start_lcid = source_table_.find_first_source( tid, syn_id, sources[ i ] );
-      if ( start_lcid != invalid_index )
+      for ( size_t segment = 0; segment < source_table_.num_segments( tid, syn_id ); ++segment )
       {
-        connections_[ tid ][ syn_id ]->get_target_gids( tid, start_lcid, post_synaptic_element, targets[ i ] );
+        const index start_lcid = source_table_.find_first_source( tid, syn_id, sources[ i ], segment );
+        if ( start_lcid != invalid_index )
+        {
+          connections_[ tid ][ syn_id ]->get_target_gids( tid, start_lcid, post_synaptic_element, targets[ i ] );
+        }
       }
     }
   }
@@ -1364,13 +1482,33 @@ nest::ConnectionManager::sort_connections( const thread tid )
     {
       if ( connections_[ tid ][ syn_id ] != NULL )
       {
-        connections_[ tid ][ syn_id ]->sort_connections( source_table_.get_thread_local_sources( tid )[ syn_id ] );
+        const index first = source_table_.get_num_processed( tid, syn_id );
+        connections_[ tid ][ syn_id ]->sort_connections(
+          source_table_.get_thread_local_sources( tid )[ syn_id ], first );
+        source_table_.set_sorted_from( tid, syn_id, first );
       }
     }
     remove_disabled_connections( tid );
   }
 }
 
+void
+nest::ConnectionManager::check_incremental_update()
+{
+  // Deleted connections are only removed by sorting the full source
+  // table, and secondary connections require all receive buffer
+  // positions to be recomputed. Each incremental update adds a sorted
+  // segment to the source table that lookups have to search, so the
+  // segments are merged by a full update once there are too many.
+  const size_t max_num_segments = 8;
+  const bool requires_full_update = requires_full_update_ or not incremental_connection_update_
+    or not keep_source_table_ or secondary_connections_exist_ or source_table_.is_cleared()
+    or source_table_.max_num_segments() >= max_num_segments;
+
+  incremental_update_ = not kernel().mpi_manager.any_true( requires_full_update );
+  requires_full_update_ = false;
+}
+
 void
 nest::ConnectionManager::compute_target_data_buffer_size()
 {
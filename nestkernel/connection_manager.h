@@ -73,6 +73,9 @@ public:
   virtual void set_status( const DictionaryDatum& );
   virtual void get_status( DictionaryDatum& );
 
+  virtual void save_checkpoint( std::ostream& );
+  virtual void load_checkpoint( std::istream& );
+
   DictionaryDatum& get_connruledict();
 
   void compute_target_data_buffer_size();
@@ -233,10 +236,18 @@ public:
 
   /**
    * Return minimal connection delay, which is precomputed by
-   * update_delay_extrema_().
+   * update_delay_extrema_(). This is the length of a time slice, i.e.,
+   * the interval between two spike exchanges. With pipelined spike
+   * communication, it is half of get_min_connection_delay().
    */
   delay get_min_delay() const;
 
+  /**
+   * Return smallest delay of all connections, which is precomputed by
+   * update_delay_extrema_().
+   */
+  delay get_min_connection_delay() const;
+
   /**
    * Return maximal connection delay, which is precomputed by
    * update_delay_extrema_().
@@ -259,6 +270,12 @@ public:
    */
   void send_from_device( const thread tid, const index ldid, Event& e );
 
+  /**
+   * Return number of targets of source device ldid (local device id) on
+   * thread tid, i.e., the number of events send_from_device() delivers.
+   */
+  size_t get_num_targets_from_device( const thread tid, const index ldid ) const;
+
   /**
    * Send event e to all targets of node source on thread t
    */
@@ -322,7 +339,9 @@ public:
 
   /**
    * Sorts connections in the presynaptic infrastructure by increasing
-   * source gid.
+   * source gid. Connections that have been communicated in an earlier
+   * update of the connection infrastructure are not moved; connections
+   * created since then are sorted among themselves.
    */
   void sort_connections( const thread tid );
 
@@ -352,6 +371,37 @@ public:
    */
   void restructure_connection_tables( const thread tid );
 
+  /**
+   * Determines whether the next update of the connection
+   * infrastructure can be incremental, i.e., only sorts and
+   * communicates connections created since the previous update, and
+   * keeps the existing TargetTable. This is the case if
+   * incremental_connection_update is set on all MPI processes, no
+   * connections have been deleted since the previous update and the
+   * source table consists of few sorted segments. Must be called by a
+   * single thread on all MPI processes.
+   */
+  void check_incremental_update();
+
+  //! Returns true if the current update of the connection infrastructure is incremental.
+  bool is_incremental_update() const;
+
+  //! Returns the kernel property incremental_connection_update.
+  bool get_incremental_connection_update() const;
+
+  /**
+   * Sets the kernel property incremental_connection_update. Used to keep
+   * the setting of the user when the number of threads changes, as
+   * finalize() resets it.
+   */
+  void set_incremental_connection_update( const bool incremental );
+
+  /**
+   * Marks all connections as communicated, so that a subsequent
+   * incremental update only considers connections created later.
+   */
+  void set_connections_processed( const thread tid );
+
   void set_has_source_subsequent_targets( const thread tid,
     const synindex syn_id,
     const index lcid,
@@ -572,7 +622,9 @@ private:
   //! ConnBuilder factories, indexed by connruledict_ elements.
   std::vector< GenericConnBuilderFactory* > connbuilder_factories_;
 
-  delay min_delay_; //!< Value of the smallest delay in the network.
+  delay min_delay_; //!< Length of a time slice in steps.
+
+  delay min_connection_delay_; //!< Value of the smallest delay in the network.
 
   delay max_delay_; //!< Value of the largest delay in the network in steps.
 
@@ -586,6 +638,16 @@ private:
   //! Whether to sort connections by source gid.
   bool sort_connections_by_source_;
 
+  //! Whether to update the connection infrastructure incrementally if possible.
+  bool incremental_connection_update_;
+
+  //! True if the next update of the connection infrastructure cannot be
+  //! incremental, e.g., because connections have been deleted.
+  bool requires_full_update_;
+
+  //! Whether the current update of the connection infrastructure is incremental.
+  bool incremental_update_;
+
   //! Whether primary connections (spikes) exist.
   bool has_primary_connections_;
 
@@ -615,12 +677,24 @@ ConnectionManager::get_min_delay() const
   return min_delay_;
 }
 
+inline delay
+ConnectionManager::get_min_connection_delay() const
+{
+  return min_connection_delay_;
+}
+
 inline delay
 ConnectionManager::get_max_delay() const
 {
   return max_delay_;
 }
 
+inline size_t
+ConnectionManager::get_num_targets_from_device( const thread tid, const index ldid ) const
+{
+  return target_table_devices_.get_num_targets_from_device( tid, ldid );
+}
+
 inline void
 ConnectionManager::clean_source_table( const thread tid )
 {
@@ -805,6 +879,30 @@ ConnectionManager::restructure_connection_tables( const thread tid )
   source_table_.reset_processed_flags( tid );
 }
 
+inline bool
+ConnectionManager::is_incremental_update() const
+{
+  return incremental_update_;
+}
+
+inline bool
+ConnectionManager::get_incremental_connection_update() const
+{
+  return incremental_connection_update_;
+}
+
+inline void
+ConnectionManager::set_incremental_connection_update( const bool incremental )
+{
+  incremental_connection_update_ = incremental;
+}
+
+inline void
+ConnectionManager::set_connections_processed( const thread tid )
+{
+  source_table_.set_all_processed( tid );
+}
+
 inline void
 ConnectionManager::set_has_source_subsequent_targets( const thread tid,
   const synindex syn_id,
@@ -28,9 +28,11 @@
 
 // C++ includes:
 #include <cstdlib>
+#include <iosfwd>
 #include <vector>
 
 // Includes from libnestutil:
+#include "binary_io.h"
 #include "compose.hpp"
 #include "sort.h"
 #include "vector_util.h"
@@ -87,7 +89,8 @@ public:
    * Set status of the connection at position lcid according to the
    * dictionary dict.
    */
-  virtual void set_synapse_status( const index lcid, const DictionaryDatum& dict, ConnectorModel& cm ) = 0;
+  virtual void
+  set_synapse_status( const thread tid, const index lcid, const DictionaryDatum& dict, ConnectorModel& cm ) = 0;
 
   /**
    * Add ConnectionID with given source_gid and lcid to conns. If
@@ -170,9 +173,10 @@ public:
     const std::vector< ConnectorModel* >& cm ) = 0;
 
   /**
-   * Sort connections according to source gids.
+   * Sort connections from position first onwards according to source
+   * gids.
    */
-  virtual void sort_connections( BlockVector< Source >& ) = 0;
+  virtual void sort_connections( BlockVector< Source >&, const index first ) = 0;
 
   /**
    * Set a flag in the connection indicating whether the following
@@ -207,6 +211,17 @@ public:
    * Remove disabled connections from the connector.
    */
   virtual void remove_disabled_connections( const index first_disabled_index ) = 0;
+
+  /**
+   * Write the state of all connections to a binary stream.
+   */
+  virtual void save_state( std::ostream& os ) const = 0;
+
+  /**
+   * Read the state of all connections from a binary stream. The
+   * connector must hold as many connections as when saving.
+   */
+  virtual void load_state( std::istream& is ) = 0;
 };
 
 /**
@@ -255,11 +270,30 @@ public:
   }
 
   void
-  set_synapse_status( const index lcid, const DictionaryDatum& dict, ConnectorModel& cm )
+  set_synapse_status( const thread tid, const index lcid, const DictionaryDatum& dict, ConnectorModel& cm )
   {
     assert( lcid < C_.size() );
 
-    C_[ lcid ].set_status( dict, static_cast< GenericConnectorModel< ConnectionT >& >( cm ) );
+    // A change of delay is passed on with tid, which is needed to find
+    // the target of hpc synapses. This includes the case that set_status()
+    // fails after it has changed the delay.
+    const double old_delay = C_[ lcid ].get_delay();
+    try
+    {
+      C_[ lcid ].set_status( dict, static_cast< GenericConnectorModel< ConnectionT >& >( cm ) );
+    }
+    catch ( ... )
+    {
+      if ( C_[ lcid ].get_delay() != old_delay )
+      {
+        C_[ lcid ].delay_changed( tid, old_delay );
+      }
+      throw;
+    }
+    if ( C_[ lcid ].get_delay() != old_delay )
+    {
+      C_[ lcid ].delay_changed( tid, old_delay );
+    }
   }
 
   void
@@ -432,9 +466,9 @@ public:
   }
 
   void
-  sort_connections( BlockVector< Source >& sources )
+  sort_connections( BlockVector< Source >& sources, const index first )
   {
-    nest::sort( sources, C_ );
+    nest::sort( sources, C_, first );
   }
 
   void
@@ -490,6 +524,31 @@ public:
     assert( C_[ first_disabled_index ].is_disabled() );
     C_.erase( C_.begin() + first_disabled_index, C_.end() );
   }
+
+  void
+  save_state( std::ostream& os ) const
+  {
+    write_binary( os, C_.size() );
+    for ( size_t i = 0; i < C_.size(); ++i )
+    {
+      C_[ i ].save_state( os );
+    }
+  }
+
+  void
+  load_state( std::istream& is )
+  {
+    size_t size = 0;
+    read_binary( is, size );
+    if ( size != C_.size() )
+    {
+      throw CheckpointError( "Number of connections differs from checkpoint." );
+    }
+    for ( size_t i = 0; i < C_.size(); ++i )
+    {
+      C_[ i ].load_state( is );
+    }
+  }
 };
 
 } // of namespace nest
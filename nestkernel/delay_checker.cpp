@@ -132,7 +132,7 @@ nest::DelayChecker::assert_valid_delay_ms( double requested_new_delay )
   // min_delay and the max_delay which have been used during simulation
   if ( kernel().simulation_manager.has_been_simulated() )
   {
-    const bool bad_min_delay = new_delay < kernel().connection_manager.get_min_delay();
+    const bool bad_min_delay = new_delay < kernel().connection_manager.get_min_connection_delay();
     const bool bad_max_delay = new_delay > kernel().connection_manager.get_max_delay();
     if ( bad_min_delay or bad_max_delay )
     {
@@ -193,7 +193,7 @@ nest::DelayChecker::assert_two_valid_delays_steps( delay new_delay1, delay new_d
 
   if ( kernel().simulation_manager.has_been_simulated() )
   {
-    const bool bad_min_delay = ldelay < kernel().connection_manager.get_min_delay();
+    const bool bad_min_delay = ldelay < kernel().connection_manager.get_min_connection_delay();
     const bool bad_max_delay = hdelay > kernel().connection_manager.get_max_delay();
     if ( bad_min_delay )
     {
@@ -30,6 +30,7 @@
 #include "event.h"
 
 // Includes from nestkernel:
+#include "kernel_manager.h"
 #include "node.h"
 
 namespace nest
@@ -40,6 +41,9 @@ Event::Event()
                      // this is safe
   , sender_( NULL )
   , receiver_( NULL )
+  , sender_tid_( 0 )
+  , sender_syn_id_( 0 )
+  , sender_lcid_( invalid_index )
   , p_( -1 )
   , rp_( 0 )
   , d_( 1 )
@@ -50,6 +54,12 @@ Event::Event()
 {
 }
 
+index
+Event::get_source_gid_() const
+{
+  return kernel().connection_manager.get_source_gid( sender_tid_, sender_syn_id_, sender_lcid_ );
+}
+
 
 void SpikeEvent::operator()()
 {
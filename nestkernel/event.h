@@ -143,6 +143,14 @@ public:
    */
   void set_sender_gid( index );
 
+  /**
+   * Set the position of the connection through which the event is
+   * delivered. The GID of the sending Node is then only looked up in
+   * the SourceTable if the receiver calls get_sender_gid(), which keeps
+   * the lookup out of spike delivery for most receivers.
+   */
+  void set_sender_position( thread tid, synindex syn_id, index lcid );
+
   /**
    * Return time stamp of the event.
    * The stamp denotes the time when the event was created.
@@ -284,6 +292,13 @@ protected:
   Node* sender_;     //!< Pointer to sender or NULL.
   Node* receiver_;   //!< Pointer to receiver or NULL.
 
+  /**
+   * Position of the delivering connection, used to look up the sender
+   * GID on demand. sender_lcid_ is invalid_index if sender_gid_ is set.
+   */
+  thread sender_tid_;
+  synindex sender_syn_id_;
+  index sender_lcid_;
 
   /**
    * Sender port number.
@@ -342,6 +357,9 @@ protected:
    * Weight of the connection.
    */
   weight w_;
+
+  //! Look up the sender GID from the position of the delivering connection.
+  index get_source_gid_() const;
 };
 
 
@@ -372,7 +390,13 @@ inline SpikeEvent::SpikeEvent()
 inline SpikeEvent*
 SpikeEvent::clone() const
 {
-  return new SpikeEvent( *this );
+  SpikeEvent* se = new SpikeEvent( *this );
+  // clones are kept beyond delivery, when connections may have moved
+  if ( sender_lcid_ != invalid_index )
+  {
+    se->set_sender_gid( get_source_gid_() );
+  }
+  return se;
 }
 
 inline void
@@ -1275,6 +1299,16 @@ inline void
 Event::set_sender_gid( index gid )
 {
   sender_gid_ = gid;
+  sender_lcid_ = invalid_index;
+}
+
+inline void
+Event::set_sender_position( thread tid, synindex syn_id, index lcid )
+{
+  sender_gid_ = 0;
+  sender_tid_ = tid;
+  sender_syn_id_ = syn_id;
+  sender_lcid_ = lcid;
 }
 
 inline Node&
@@ -1292,6 +1326,10 @@ Event::get_sender( void ) const
 inline index
 Event::get_sender_gid( void ) const
 {
+  if ( sender_lcid_ != invalid_index )
+  {
+    return get_source_gid_();
+  }
   assert( sender_gid_ > 0 );
   return sender_gid_;
 }
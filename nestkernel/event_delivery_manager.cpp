@@ -23,11 +23,12 @@
 #include "event_delivery_manager.h"
 
 // C++ includes:
-#include <algorithm> // rotate
+#include <algorithm> // rotate, min
 #include <iostream>
 #include <numeric> // accumulate
 
 // Includes from libnestutil:
+#include "binary_io.h"
 #include "logging.h"
 
 // Includes from nestkernel:
@@ -48,10 +49,17 @@ namespace nest
 {
 EventDeliveryManager::EventDeliveryManager()
   : off_grid_spiking_( false )
+  , partition_spike_delivery_( false )
+  , pipeline_spike_communication_( false )
+  , spike_data_pending_( false )
   , moduli_()
   , slice_moduli_()
   , spike_register_()
   , off_grid_spike_register_()
+  , pending_spike_register_()
+  , pending_off_grid_spike_register_()
+  , restored_spike_register_()
+  , restored_off_grid_spike_register_()
   , send_buffer_secondary_events_()
   , recv_buffer_secondary_events_()
   , time_collocate_( 0.0 )
@@ -61,6 +69,9 @@ EventDeliveryManager::EventDeliveryManager()
   , recv_buffer_spike_data_()
   , send_buffer_off_grid_spike_data_()
   , recv_buffer_off_grid_spike_data_()
+  , spike_data_positions_()
+  , spike_data_end_markers_()
+  , spike_data_valid_ends_()
   , send_buffer_target_data_()
   , recv_buffer_target_data_()
   , buffer_size_target_data_has_changed_( false )
@@ -83,9 +94,14 @@ EventDeliveryManager::initialize()
   reset_timers_counters();
   spike_register_.resize( num_threads );
   off_grid_spike_register_.resize( num_threads );
+  pending_spike_register_.resize( num_threads );
+  pending_off_grid_spike_register_.resize( num_threads );
   gather_completed_checker_.resize( num_threads, false );
+  spike_data_positions_.resize( num_threads );
+  spike_data_end_markers_.resize( num_threads );
   // Ensures that ResetKernel resets off_grid_spiking_
   off_grid_spiking_ = false;
+  spike_data_pending_ = false;
   buffer_size_target_data_has_changed_ = false;
   buffer_size_spike_data_has_changed_ = false;
 
@@ -93,11 +109,22 @@ EventDeliveryManager::initialize()
   {
     const thread tid = kernel().vp_manager.get_thread_id();
     spike_register_[ tid ].resize( num_threads,
-      std::vector< std::vector< Target > >( kernel().connection_manager.get_min_delay(), std::vector< Target >() ) );
+      std::vector< std::vector< SpikeTarget > >( kernel().connection_manager.get_min_delay(),
+                                              std::vector< SpikeTarget >() ) );
 
     off_grid_spike_register_[ tid ].resize( num_threads,
       std::vector< std::vector< OffGridTarget > >( kernel().connection_manager.get_min_delay(),
                                               std::vector< OffGridTarget >() ) );
+
+    pending_spike_register_[ tid ].resize( num_threads,
+      std::vector< std::vector< SpikeTarget > >( kernel().connection_manager.get_min_delay(),
+                                              std::vector< SpikeTarget >() ) );
+
+    pending_off_grid_spike_register_[ tid ].resize( num_threads,
+      std::vector< std::vector< OffGridTarget > >( kernel().connection_manager.get_min_delay(),
+                                              std::vector< OffGridTarget >() ) );
+
+    spike_data_positions_[ tid ].resize( num_threads );
   } // of omp parallel
 }
 
@@ -105,9 +132,18 @@ void
 EventDeliveryManager::finalize()
 {
   // clear the spike buffers
-  std::vector< std::vector< std::vector< std::vector< Target > > > >().swap( spike_register_ );
+  std::vector< std::vector< std::vector< std::vector< SpikeTarget > > > >().swap( spike_register_ );
   std::vector< std::vector< std::vector< std::vector< OffGridTarget > > > >().swap( off_grid_spike_register_ );
+  std::vector< std::vector< std::vector< std::vector< SpikeTarget > > > >().swap( pending_spike_register_ );
+  std::vector< std::vector< std::vector< std::vector< OffGridTarget > > > >().swap(
+    pending_off_grid_spike_register_ );
+  std::vector< std::vector< std::vector< std::vector< SpikeTarget > > > >().swap( restored_spike_register_ );
+  std::vector< std::vector< std::vector< std::vector< OffGridTarget > > > >().swap(
+    restored_off_grid_spike_register_ );
   gather_completed_checker_.clear();
+  std::vector< std::vector< std::vector< unsigned int > > >().swap( spike_data_positions_ );
+  std::vector< std::vector< std::pair< thread, unsigned int > > >().swap( spike_data_end_markers_ );
+  spike_data_valid_ends_.clear();
 
   send_buffer_secondary_events_.clear();
   recv_buffer_secondary_events_.clear();
@@ -115,24 +151,157 @@ EventDeliveryManager::finalize()
   recv_buffer_spike_data_.clear();
   send_buffer_off_grid_spike_data_.clear();
   recv_buffer_off_grid_spike_data_.clear();
+
+  // Reset here instead of in initialize(), which is also called when the
+  // number of threads changes and must keep the settings of the user
+  partition_spike_delivery_ = false;
+  pipeline_spike_communication_ = false;
 }
 
 void
 EventDeliveryManager::set_status( const DictionaryDatum& dict )
 {
   updateValue< bool >( dict, names::off_grid_spiking, off_grid_spiking_ );
+  updateValue< bool >( dict, names::partition_spike_delivery, partition_spike_delivery_ );
+
+  bool pipeline_spike_communication = pipeline_spike_communication_;
+  if ( updateValue< bool >( dict, names::pipeline_spike_communication, pipeline_spike_communication )
+    and pipeline_spike_communication != pipeline_spike_communication_ )
+  {
+    // the length of a slice depends on this setting, see
+    // ConnectionManager::update_delay_extrema_()
+    if ( kernel().simulation_manager.has_been_simulated() )
+    {
+      throw KernelException(
+        "Pipelined spike communication cannot be enabled or disabled "
+        "after Simulate has been called." );
+    }
+    pipeline_spike_communication_ = pipeline_spike_communication;
+  }
 }
 
 void
 EventDeliveryManager::get_status( DictionaryDatum& dict )
 {
   def< bool >( dict, names::off_grid_spiking, off_grid_spiking_ );
+  def< bool >( dict, names::partition_spike_delivery, partition_spike_delivery_ );
+  def< bool >( dict, names::pipeline_spike_communication, pipeline_spike_communication_ );
   def< double >( dict, names::time_collocate, time_collocate_ );
   def< double >( dict, names::time_communicate, time_communicate_ );
   def< unsigned long >(
     dict, names::local_spike_counter, std::accumulate( local_spike_counter_.begin(), local_spike_counter_.end(), 0 ) );
 }
 
+void
+EventDeliveryManager::save_checkpoint( std::ostream& os )
+{
+  if ( kernel().connection_manager.secondary_connections_exist() or kernel().node_manager.wfr_is_used() )
+  {
+    throw CheckpointError( "Checkpoints do not support secondary events or waveform relaxation." );
+  }
+  assert( not spike_data_pending_ );
+
+  // spikes emitted in the last, incomplete slice have not been delivered yet
+  for ( thread tid = 0; tid < static_cast< thread >( spike_register_.size() ); ++tid )
+  {
+    for ( thread rtid = 0; rtid < static_cast< thread >( spike_register_[ tid ].size() ); ++rtid )
+    {
+      const std::vector< std::vector< SpikeTarget > >& lags = spike_register_[ tid ][ rtid ];
+      const std::vector< std::vector< OffGridTarget > >& off_grid_lags = off_grid_spike_register_[ tid ][ rtid ];
+      write_binary( os, lags.size() );
+      for ( size_t lag = 0; lag < lags.size(); ++lag )
+      {
+        write_binary( os, lags[ lag ].size() );
+        for ( std::vector< SpikeTarget >::const_iterator it = lags[ lag ].begin(); it != lags[ lag ].end(); ++it )
+        {
+          write_binary( os, it->get_tid() );
+          write_binary( os, it->get_rank() );
+          write_binary( os, it->get_syn_id() );
+          write_binary( os, it->get_lcid() );
+          write_binary( os, it->get_multiplicity() );
+        }
+
+        write_binary( os, off_grid_lags[ lag ].size() );
+        for ( std::vector< OffGridTarget >::const_iterator it = off_grid_lags[ lag ].begin();
+              it != off_grid_lags[ lag ].end();
+              ++it )
+        {
+          write_binary( os, it->get_tid() );
+          write_binary( os, it->get_rank() );
+          write_binary( os, it->get_syn_id() );
+          write_binary( os, it->get_lcid() );
+          write_binary( os, it->get_multiplicity() );
+          write_binary( os, it->get_offset() );
+        }
+      }
+    }
+  }
+}
+
+void
+EventDeliveryManager::load_checkpoint( std::istream& is )
+{
+  const thread num_threads = kernel().vp_manager.get_num_threads();
+  const size_t min_delay = kernel().connection_manager.get_min_delay();
+
+  restored_spike_register_.assign(
+    num_threads, std::vector< std::vector< std::vector< SpikeTarget > > >( num_threads ) );
+  restored_off_grid_spike_register_.assign(
+    num_threads, std::vector< std::vector< std::vector< OffGridTarget > > >( num_threads ) );
+
+  for ( thread tid = 0; tid < num_threads; ++tid )
+  {
+    for ( thread rtid = 0; rtid < num_threads; ++rtid )
+    {
+      std::vector< std::vector< SpikeTarget > >& lags = restored_spike_register_[ tid ][ rtid ];
+      std::vector< std::vector< OffGridTarget > >& off_grid_lags = restored_off_grid_spike_register_[ tid ][ rtid ];
+      size_t num_lags = 0;
+      read_binary( is, num_lags );
+      if ( num_lags != min_delay )
+      {
+        throw CheckpointError( "Spike register differs from checkpoint." );
+      }
+      lags.resize( num_lags );
+      off_grid_lags.resize( num_lags );
+
+      for ( size_t lag = 0; lag < num_lags; ++lag )
+      {
+        thread target_tid = 0;
+        thread target_rank = 0;
+        synindex syn_id = 0;
+        index lcid = 0;
+        unsigned int multiplicity = 0;
+        double offset = 0.0;
+
+        size_t num_spikes = 0;
+        read_binary( is, num_spikes );
+        for ( size_t i = 0; i < num_spikes; ++i )
+        {
+          read_binary( is, target_tid );
+          read_binary( is, target_rank );
+          read_binary( is, syn_id );
+          read_binary( is, lcid );
+          read_binary( is, multiplicity );
+          lags[ lag ].push_back( SpikeTarget( Target( target_tid, target_rank, syn_id, lcid ), multiplicity ) );
+        }
+
+        read_binary( is, num_spikes );
+        for ( size_t i = 0; i < num_spikes; ++i )
+        {
+          read_binary( is, target_tid );
+          read_binary( is, target_rank );
+          read_binary( is, syn_id );
+          read_binary( is, lcid );
+          read_binary( is, multiplicity );
+          read_binary( is, offset );
+          off_grid_lags[ lag ].push_back(
+            OffGridTarget( Target( target_tid, target_rank, syn_id, lcid ), multiplicity, offset ) );
+        }
+      }
+    }
+  }
+}
+
 void
 EventDeliveryManager::clear_pending_spikes()
 {
@@ -177,6 +346,26 @@ EventDeliveryManager::configure_spike_register()
     reset_spike_register_( tid );
     resize_spike_register_( tid );
   }
+
+  // configure pending spike registers in the same way
+  swap_spike_registers_();
+  for ( thread tid = 0; tid < kernel().vp_manager.get_num_threads(); ++tid )
+  {
+    reset_spike_register_( tid );
+    resize_spike_register_( tid );
+  }
+  swap_spike_registers_();
+
+  if ( not restored_spike_register_.empty() )
+  {
+    spike_register_.swap( restored_spike_register_ );
+    off_grid_spike_register_.swap( restored_off_grid_spike_register_ );
+    std::vector< std::vector< std::vector< std::vector< SpikeTarget > > > >().swap( restored_spike_register_ );
+    std::vector< std::vector< std::vector< std::vector< OffGridTarget > > > >().swap(
+      restored_off_grid_spike_register_ );
+  }
+
+  spike_data_pending_ = false;
 }
 
 void
@@ -296,22 +485,192 @@ EventDeliveryManager::deliver_secondary_events( const thread tid, const bool cal
 
 void
 EventDeliveryManager::gather_spike_data( const thread tid )
+{
+  // deliver only at end of time slice
+  assert( kernel().simulation_manager.get_to_step() == kernel().connection_manager.get_min_delay() );
+
+  if ( pipeline_spike_communication_ )
+  {
+    if ( off_grid_spiking_ )
+    {
+      complete_spike_data_exchange_( tid, send_buffer_off_grid_spike_data_, recv_buffer_off_grid_spike_data_ );
+      start_spike_data_exchange_( tid, send_buffer_off_grid_spike_data_, recv_buffer_off_grid_spike_data_ );
+    }
+    else
+    {
+      complete_spike_data_exchange_( tid, send_buffer_spike_data_, recv_buffer_spike_data_ );
+      start_spike_data_exchange_( tid, send_buffer_spike_data_, recv_buffer_spike_data_ );
+    }
+  }
+  else
+  {
+    if ( off_grid_spiking_ )
+    {
+      gather_spike_data_( tid,
+        send_buffer_off_grid_spike_data_,
+        recv_buffer_off_grid_spike_data_,
+        kernel().simulation_manager.get_clock() );
+    }
+    else
+    {
+      gather_spike_data_( tid, send_buffer_spike_data_, recv_buffer_spike_data_, kernel().simulation_manager.get_clock() );
+    }
+  }
+}
+
+void
+EventDeliveryManager::complete_pending_spike_data( const thread tid )
 {
   if ( off_grid_spiking_ )
   {
-    gather_spike_data_( tid, send_buffer_off_grid_spike_data_, recv_buffer_off_grid_spike_data_ );
+    complete_spike_data_exchange_( tid, send_buffer_off_grid_spike_data_, recv_buffer_off_grid_spike_data_ );
   }
   else
   {
-    gather_spike_data_( tid, send_buffer_spike_data_, recv_buffer_spike_data_ );
+    complete_spike_data_exchange_( tid, send_buffer_spike_data_, recv_buffer_spike_data_ );
   }
 }
 
 template < typename SpikeDataT >
 void
-EventDeliveryManager::gather_spike_data_( const thread tid,
+EventDeliveryManager::start_spike_data_exchange_( const thread tid,
+  std::vector< SpikeDataT >& send_buffer,
+  std::vector< SpikeDataT >& recv_buffer )
+{
+  const AssignedRanks assigned_ranks = kernel().vp_manager.get_assigned_ranks( tid );
+
+#pragma omp single
+  {
+    if ( kernel().mpi_manager.adaptive_spike_buffers() and buffer_size_spike_data_has_changed_ )
+    {
+      resize_send_recv_buffers_spike_data_();
+      buffer_size_spike_data_has_changed_ = false;
+    }
+  } // of omp single; implicit barrier
+
+  SendBufferPosition send_buffer_position(
+    assigned_ranks, kernel().mpi_manager.get_send_recv_count_spike_data_per_rank() );
+
+  // Collocate spikes to send buffer. Only a single round is started
+  // here, spikes that do not fit are exchanged by
+  // complete_spike_data_exchange_().
+  bool collocate_completed =
+    collocate_spike_data_buffers_( tid, assigned_ranks, send_buffer_position, spike_register_, send_buffer );
+  if ( off_grid_spiking_ )
+  {
+    collocate_completed = collocate_spike_data_buffers_(
+      tid, assigned_ranks, send_buffer_position, off_grid_spike_register_, send_buffer ) and collocate_completed;
+  }
+  gather_completed_checker_.set( tid, collocate_completed );
+
+#pragma omp barrier
+  set_end_and_invalid_markers_( assigned_ranks, send_buffer_position, send_buffer );
+  clean_spike_register_( tid );
+
+  if ( gather_completed_checker_.all_true() )
+  {
+    set_complete_marker_spike_data_( assigned_ranks, send_buffer_position, send_buffer );
+  }
+#pragma omp barrier
+
+#pragma omp single
+  {
+    // Spikes of the next slice are written to the other register, while
+    // the remaining spikes of this slice wait for the next exchange.
+    swap_spike_registers_();
+
+    if ( off_grid_spiking_ )
+    {
+      kernel().mpi_manager.communicate_off_grid_spike_data_Ialltoall( send_buffer, recv_buffer );
+    }
+    else
+    {
+      kernel().mpi_manager.communicate_spike_data_Ialltoall( send_buffer, recv_buffer );
+    }
+    spike_data_pending_ = true;
+  } // of omp single; implicit barrier
+}
+
+template < typename SpikeDataT >
+void
+EventDeliveryManager::complete_spike_data_exchange_( const thread tid,
   std::vector< SpikeDataT >& send_buffer,
   std::vector< SpikeDataT >& recv_buffer )
+{
+  if ( not spike_data_pending_ )
+  {
+    return;
+  }
+
+#pragma omp single
+  {
+    kernel().mpi_manager.wait_spike_data();
+  } // of omp single; implicit barrier
+
+  // Pending spikes were generated in the slice before the last
+  // advance of the clock. Since the communication interval is at most
+  // half of the smallest delay, none of them is due yet.
+  const Time slice_origin =
+    kernel().simulation_manager.get_clock() - Time::step( kernel().connection_manager.get_min_delay() );
+
+  // All ranks see the same complete markers, so they agree on whether
+  // more rounds are required.
+  const bool deliver_completed = deliver_spike_data_( tid, recv_buffer, slice_origin );
+
+#pragma omp barrier
+#pragma omp single
+  {
+    spike_data_pending_ = false;
+    if ( not deliver_completed )
+    {
+      if ( kernel().mpi_manager.adaptive_spike_buffers() )
+      {
+        buffer_size_spike_data_has_changed_ = kernel().mpi_manager.increase_buffer_size_spike_data();
+      }
+      swap_spike_registers_();
+    }
+  } // of omp single; implicit barrier
+
+  if ( not deliver_completed )
+  {
+    // exchange remaining spikes of the previous slice in blocking rounds
+    gather_spike_data_( tid, send_buffer, recv_buffer, slice_origin );
+#pragma omp barrier
+#pragma omp single
+    {
+      swap_spike_registers_();
+    } // of omp single; implicit barrier
+  }
+}
+
+template < typename SpikeDataT >
+bool
+EventDeliveryManager::deliver_spike_data_( const thread tid,
+  const std::vector< SpikeDataT >& recv_buffer,
+  const Time& slice_origin )
+{
+  if ( partition_spike_delivery_ )
+  {
+    partition_spike_data_( tid, recv_buffer );
+#pragma omp barrier
+#pragma omp single
+    {
+      set_spike_data_valid_ends_();
+    } // of omp single; implicit barrier
+    return deliver_partitioned_events_( tid, recv_buffer, slice_origin );
+  }
+  else
+  {
+    return deliver_events_( tid, recv_buffer, slice_origin );
+  }
+}
+
+template < typename SpikeDataT >
+void
+EventDeliveryManager::gather_spike_data_( const thread tid,
+  std::vector< SpikeDataT >& send_buffer,
+  std::vector< SpikeDataT >& recv_buffer,
+  const Time& slice_origin )
 {
   // Assume all threads have some work to do
   gather_completed_checker_.set( tid, false );
@@ -379,7 +738,7 @@ EventDeliveryManager::gather_spike_data_( const thread tid,
     } // of omp single; implicit barrier
 
     // Deliver spikes from receive buffer to ring buffers.
-    const bool deliver_completed = deliver_events_( tid, recv_buffer );
+    const bool deliver_completed = deliver_spike_data_( tid, recv_buffer, slice_origin );
     gather_completed_checker_.logical_and( tid, deliver_completed );
 
 // Exit gather loop if all local threads and remote processes are
@@ -414,6 +773,8 @@ EventDeliveryManager::collocate_spike_data_buffers_( const thread tid,
   // not be fit into the MPI buffer.
   bool is_spike_register_empty = true;
 
+  const unsigned int max_multiplicity = SpikeDataT::MAX_MULTIPLICITY;
+
   // First dimension: loop over writing thread
   for (
     typename std::vector< std::vector< std::vector< std::vector< TargetT > > > >::iterator it = spike_register.begin();
@@ -434,24 +795,35 @@ EventDeliveryManager::collocate_spike_data_buffers_( const thread tid,
 
         const thread rank = iiit->get_rank();
 
-        if ( send_buffer_position.is_chunk_filled( rank ) )
+        // Spikes with multiplicity are split into as few entries as
+        // possible. If the chunk fills up, the remaining spikes stay in
+        // the register for the next round.
+        unsigned int multiplicity = iiit->get_multiplicity();
+        while ( multiplicity > 0 and not send_buffer_position.is_chunk_filled( rank ) )
+        {
+          const unsigned int entry_multiplicity = std::min( multiplicity, max_multiplicity );
+          send_buffer[ send_buffer_position.idx( rank ) ].set( ( *iiit ).get_tid(),
+            ( *iiit ).get_syn_id(),
+            ( *iiit ).get_lcid(),
+            lag,
+            ( *iiit ).get_offset(),
+            entry_multiplicity );
+          multiplicity -= entry_multiplicity;
+          send_buffer_position.increase( rank );
+        }
+
+        if ( multiplicity == 0 )
         {
+          ( *iiit ).set_status( TARGET_ID_PROCESSED ); // mark entry for removal
+        }
+        else
+        {
+          iiit->set_multiplicity( multiplicity );
           is_spike_register_empty = false;
           if ( send_buffer_position.are_all_chunks_filled() )
           {
             return is_spike_register_empty;
           }
-          else
-          {
-            continue;
-          }
-        }
-        else
-        {
-          send_buffer[ send_buffer_position.idx( rank ) ].set(
-            ( *iiit ).get_tid(), ( *iiit ).get_syn_id(), ( *iiit ).get_lcid(), lag, ( *iiit ).get_offset() );
-          ( *iiit ).set_status( TARGET_ID_PROCESSED ); // mark entry for removal
-          send_buffer_position.increase( rank );
         }
       }
     }
@@ -520,7 +892,9 @@ EventDeliveryManager::set_complete_marker_spike_data_( const AssignedRanks& assi
 
 template < typename SpikeDataT >
 bool
-EventDeliveryManager::deliver_events_( const thread tid, const std::vector< SpikeDataT >& recv_buffer )
+EventDeliveryManager::deliver_events_( const thread tid,
+  const std::vector< SpikeDataT >& recv_buffer,
+  const Time& slice_origin )
 {
   const unsigned int send_recv_count_spike_data_per_rank =
     kernel().mpi_manager.get_send_recv_count_spike_data_per_rank();
@@ -528,16 +902,13 @@ EventDeliveryManager::deliver_events_( const thread tid, const std::vector< Spik
 
   bool are_others_completed = true;
 
-  // deliver only at end of time slice
-  assert( kernel().simulation_manager.get_to_step() == kernel().connection_manager.get_min_delay() );
-
   SpikeEvent se;
 
   // prepare Time objects for every possible time stamp within min_delay_
   std::vector< Time > prepared_timestamps( kernel().connection_manager.get_min_delay() );
   for ( size_t lag = 0; lag < ( size_t ) kernel().connection_manager.get_min_delay(); ++lag )
   {
-    prepared_timestamps[ lag ] = kernel().simulation_manager.get_clock() + Time::step( lag + 1 );
+    prepared_timestamps[ lag ] = slice_origin + Time::step( lag + 1 );
   }
 
   for ( thread rank = 0; rank < kernel().mpi_manager.get_num_processes(); ++rank )
@@ -566,10 +937,14 @@ EventDeliveryManager::deliver_events_( const thread tid, const std::vector< Spik
 
         const index syn_id = spike_data.get_syn_id();
         const index lcid = spike_data.get_lcid();
-        const index source_gid = kernel().connection_manager.get_source_gid( tid, syn_id, lcid );
-        se.set_sender_gid( source_gid );
+        se.set_sender_position( tid, syn_id, lcid );
 
-        kernel().connection_manager.send( tid, syn_id, lcid, cm, se );
+        // spikes of multiplicity m are delivered as m separate spikes,
+        // as if they had been transmitted in separate entries
+        for ( unsigned int k = 0; k < spike_data.get_multiplicity(); ++k )
+        {
+          kernel().connection_manager.send( tid, syn_id, lcid, cm, se );
+        }
       }
 
       // break if this was the last valid entry from this rank
@@ -583,6 +958,154 @@ EventDeliveryManager::deliver_events_( const thread tid, const std::vector< Spik
   return are_others_completed;
 }
 
+template < typename SpikeDataT >
+void
+EventDeliveryManager::partition_spike_data_( const thread tid, const std::vector< SpikeDataT >& recv_buffer )
+{
+  const unsigned int send_recv_count_spike_data_per_rank =
+    kernel().mpi_manager.get_send_recv_count_spike_data_per_rank();
+  const unsigned int buffer_size = kernel().mpi_manager.get_num_processes() * send_recv_count_spike_data_per_rank;
+  const unsigned int num_threads = kernel().vp_manager.get_num_threads();
+  const unsigned int segment_size = ( buffer_size + num_threads - 1 ) / num_threads;
+  const unsigned int begin = std::min( tid * segment_size, buffer_size );
+  const unsigned int end = std::min( begin + segment_size, buffer_size );
+
+  std::vector< std::vector< unsigned int > >& positions = spike_data_positions_[ tid ];
+  for ( std::vector< std::vector< unsigned int > >::iterator it = positions.begin(); it != positions.end(); ++it )
+  {
+    it->clear();
+  }
+  std::vector< std::pair< thread, unsigned int > >& end_markers = spike_data_end_markers_[ tid ];
+  end_markers.clear();
+
+  // Entries behind an end marker contain stale data from earlier
+  // communication rounds. We can not know where the valid part of
+  // a rank's chunk ends if the end marker lies in the segment of
+  // another thread, so we only remember the first marker per chunk
+  // and filter during delivery.
+  thread last_marked_rank = -1;
+  for ( unsigned int i = begin; i < end; ++i )
+  {
+    const SpikeDataT& spike_data = recv_buffer[ i ];
+    const thread rank = i / send_recv_count_spike_data_per_rank;
+
+    if ( rank != last_marked_rank )
+    {
+      if ( i % send_recv_count_spike_data_per_rank == 0 and spike_data.is_invalid_marker() )
+      {
+        // no spikes were sent by this rank
+        end_markers.push_back( std::make_pair( rank, i ) );
+        last_marked_rank = rank;
+      }
+      else if ( spike_data.is_end_marker() )
+      {
+        // the entry carrying the end marker is still valid
+        end_markers.push_back( std::make_pair( rank, i + 1 ) );
+        last_marked_rank = rank;
+      }
+    }
+
+    const thread target_tid = spike_data.get_tid();
+    if ( target_tid < static_cast< thread >( num_threads ) )
+    {
+      positions[ target_tid ].push_back( i );
+    }
+  }
+}
+
+void
+EventDeliveryManager::set_spike_data_valid_ends_()
+{
+  const unsigned int send_recv_count_spike_data_per_rank =
+    kernel().mpi_manager.get_send_recv_count_spike_data_per_rank();
+  const thread num_processes = kernel().mpi_manager.get_num_processes();
+
+  // Without any marker, the chunk has been filled completely and its
+  // end marker was replaced by the complete marker.
+  spike_data_valid_ends_.resize( num_processes );
+  for ( thread rank = 0; rank < num_processes; ++rank )
+  {
+    spike_data_valid_ends_[ rank ] = ( rank + 1 ) * send_recv_count_spike_data_per_rank;
+  }
+
+  // The first marker found in a chunk is the one that was written by
+  // the sending rank, all later ones are stale.
+  for ( std::vector< std::vector< std::pair< thread, unsigned int > > >::const_iterator it =
+          spike_data_end_markers_.begin();
+        it != spike_data_end_markers_.end();
+        ++it )
+  {
+    for ( std::vector< std::pair< thread, unsigned int > >::const_iterator iit = it->begin(); iit != it->end(); ++iit )
+    {
+      spike_data_valid_ends_[ iit->first ] = std::min( spike_data_valid_ends_[ iit->first ], iit->second );
+    }
+  }
+}
+
+template < typename SpikeDataT >
+bool
+EventDeliveryManager::deliver_partitioned_events_( const thread tid,
+  const std::vector< SpikeDataT >& recv_buffer,
+  const Time& slice_origin )
+{
+  const unsigned int send_recv_count_spike_data_per_rank =
+    kernel().mpi_manager.get_send_recv_count_spike_data_per_rank();
+  const std::vector< ConnectorModel* >& cm = kernel().model_manager.get_synapse_prototypes( tid );
+
+  bool are_others_completed = true;
+
+  SpikeEvent se;
+
+  // prepare Time objects for every possible time stamp within min_delay_
+  std::vector< Time > prepared_timestamps( kernel().connection_manager.get_min_delay() );
+  for ( size_t lag = 0; lag < ( size_t ) kernel().connection_manager.get_min_delay(); ++lag )
+  {
+    prepared_timestamps[ lag ] = slice_origin + Time::step( lag + 1 );
+  }
+
+  for ( thread rank = 0; rank < kernel().mpi_manager.get_num_processes(); ++rank )
+  {
+    if ( not recv_buffer[ ( rank + 1 ) * send_recv_count_spike_data_per_rank - 1 ].is_complete_marker() )
+    {
+      are_others_completed = false;
+    }
+  }
+
+  // Iterating over segments in order preserves the order in which
+  // spikes are delivered by deliver_events_().
+  for ( std::vector< std::vector< std::vector< unsigned int > > >::const_iterator it = spike_data_positions_.begin();
+        it != spike_data_positions_.end();
+        ++it )
+  {
+    const std::vector< unsigned int >& positions = ( *it )[ tid ];
+    for ( std::vector< unsigned int >::const_iterator iit = positions.begin(); iit != positions.end(); ++iit )
+    {
+      if ( *iit >= spike_data_valid_ends_[ *iit / send_recv_count_spike_data_per_rank ] )
+      {
+        continue;
+      }
+
+      const SpikeDataT& spike_data = recv_buffer[ *iit ];
+
+      se.set_stamp( prepared_timestamps[ spike_data.get_lag() ] );
+      se.set_offset( spike_data.get_offset() );
+
+      const index syn_id = spike_data.get_syn_id();
+      const index lcid = spike_data.get_lcid();
+      se.set_sender_position( tid, syn_id, lcid );
+
+      // spikes of multiplicity m are delivered as m separate spikes,
+      // as if they had been transmitted in separate entries
+      for ( unsigned int k = 0; k < spike_data.get_multiplicity(); ++k )
+      {
+        kernel().connection_manager.send( tid, syn_id, lcid, cm, se );
+      }
+    }
+  }
+
+  return are_others_completed;
+}
+
 void
 EventDeliveryManager::gather_target_data( const thread tid )
 {
@@ -787,11 +1310,11 @@ nest::EventDeliveryManager::distribute_target_data_buffers_( const thread tid )
 void
 EventDeliveryManager::resize_spike_register_( const thread tid )
 {
-  for ( std::vector< std::vector< std::vector< Target > > >::iterator it = spike_register_[ tid ].begin();
+  for ( std::vector< std::vector< std::vector< SpikeTarget > > >::iterator it = spike_register_[ tid ].begin();
         it != spike_register_[ tid ].end();
         ++it )
   {
-    it->resize( kernel().connection_manager.get_min_delay(), std::vector< Target >() );
+    it->resize( kernel().connection_manager.get_min_delay(), std::vector< SpikeTarget >() );
   }
 
   for (
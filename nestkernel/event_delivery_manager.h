@@ -26,6 +26,7 @@
 // C++ includes:
 #include <cassert>
 #include <limits>
+#include <utility>
 #include <vector>
 
 // Includes from libnestutil:
@@ -65,6 +66,9 @@ public:
   virtual void set_status( const DictionaryDatum& );
   virtual void get_status( DictionaryDatum& );
 
+  virtual void save_checkpoint( std::ostream& );
+  virtual void load_checkpoint( std::istream& );
+
   /**
    * Standard routine for sending events. This method decides if
    * the event has to be delivered locally or globally. It exists
@@ -201,9 +205,25 @@ public:
   /**
    * Collocates spikes from register to MPI buffers, communicates via
    * MPI and delivers events to targets.
+   *
+   * With pipelined spike communication, the spikes of the current slice
+   * are only sent, and the spikes of the previous slice are delivered.
    */
   void gather_spike_data( const thread tid );
 
+  /**
+   * Waits for spikes that are still being communicated with pipelined
+   * spike communication and delivers them. Needs to be called before
+   * the connection infrastructure changes and at the end of a run.
+   */
+  void complete_pending_spike_data( const thread tid );
+
+  /**
+   * Returns whether spike communication is overlapped with the update
+   * of the next slice.
+   */
+  bool get_pipeline_spike_communication() const;
+
   /**
    * Collocates presynaptic connection information, communicates via
    * MPI and creates presynaptic connection infrastructure.
@@ -242,11 +262,50 @@ public:
   virtual void reset_timers_counters();
 
 private:
+  /**
+   * Exchanges spikes in the register and delivers them, in as many
+   * rounds as necessary. Spikes have been generated in the slice that
+   * starts at slice_origin.
+   */
   template < typename SpikeDataT >
   void gather_spike_data_( const thread tid,
+    std::vector< SpikeDataT >& send_buffer,
+    std::vector< SpikeDataT >& recv_buffer,
+    const Time& slice_origin );
+
+  /**
+   * Collocates spikes in the register to MPI buffers and starts a
+   * non-blocking exchange. Spikes that do not fit into the MPI buffers
+   * remain in the pending spike register.
+   */
+  template < typename SpikeDataT >
+  void start_spike_data_exchange_( const thread tid,
     std::vector< SpikeDataT >& send_buffer,
     std::vector< SpikeDataT >& recv_buffer );
 
+  /**
+   * Waits for the exchange started by start_spike_data_exchange_(),
+   * delivers the received spikes and exchanges all remaining spikes of
+   * the pending spike register.
+   */
+  template < typename SpikeDataT >
+  void complete_spike_data_exchange_( const thread tid,
+    std::vector< SpikeDataT >& send_buffer,
+    std::vector< SpikeDataT >& recv_buffer );
+
+  /**
+   * Swaps spike registers with pending spike registers.
+   */
+  void swap_spike_registers_();
+
+  /**
+   * Delivers spikes in MPI receive buffer, either directly or after
+   * partitioning by target thread. Returns whether all ranks have sent
+   * all their spikes.
+   */
+  template < typename SpikeDataT >
+  bool deliver_spike_data_( const thread tid, const std::vector< SpikeDataT >& recv_buffer, const Time& slice_origin );
+
   void resize_send_recv_buffers_spike_data_();
 
   /**
@@ -291,7 +350,32 @@ private:
    * nodes.
    */
   template < typename SpikeDataT >
-  bool deliver_events_( const thread tid, const std::vector< SpikeDataT >& recv_buffer );
+  bool deliver_events_( const thread tid, const std::vector< SpikeDataT >& recv_buffer, const Time& slice_origin );
+
+  /**
+   * Sorts positions of spikes in one segment of the MPI receive
+   * buffer by target thread. Each thread processes one segment of
+   * equal size, such that every entry of the buffer is read only
+   * once, independent of the number of threads.
+   */
+  template < typename SpikeDataT >
+  void partition_spike_data_( const thread tid, const std::vector< SpikeDataT >& recv_buffer );
+
+  /**
+   * Determines the last valid entry of each rank's part of the MPI
+   * receive buffer from the markers found by partition_spike_data_().
+   */
+  void set_spike_data_valid_ends_();
+
+  /**
+   * Reads spikes that have been sorted by partition_spike_data_()
+   * from MPI buffers and delivers them to ringbuffer of nodes. Only
+   * visits entries that belong to thread tid.
+   */
+  template < typename SpikeDataT >
+  bool deliver_partitioned_events_( const thread tid,
+    const std::vector< SpikeDataT >& recv_buffer,
+    const Time& slice_origin );
 
   /**
    * Deletes all spikes from spike registers and resets spike
@@ -356,6 +440,15 @@ private:
   bool off_grid_spiking_; //!< indicates whether spikes are not constrained to
                           //!< the grid
 
+  bool partition_spike_delivery_; //!< whether received spikes are sorted by
+                                  //!< target thread before delivery
+
+  bool pipeline_spike_communication_; //!< whether spikes are communicated
+                                      //!< during the update of the next slice
+
+  bool spike_data_pending_; //!< whether a non-blocking exchange of spikes
+                            //!< has been started and not completed
+
   /**
    * Table of pre-computed modulos.
    * This table is used to map time steps, given as offset from now,
@@ -386,9 +479,9 @@ private:
    * - First dim: write threads (from node to register)
    * - Second dim: read threads (from register to MPI buffer)
    * - Third dim: lag
-   * - Fourth dim: Target (will be converted in SpikeData)
+   * - Fourth dim: SpikeTarget (will be converted in SpikeData)
    */
-  std::vector< std::vector< std::vector< std::vector< Target > > > > spike_register_;
+  std::vector< std::vector< std::vector< std::vector< SpikeTarget > > > > spike_register_;
 
   /**
    * Register for gids of precise neurons that spiked. This is a 4-dim
@@ -402,6 +495,22 @@ private:
    */
   std::vector< std::vector< std::vector< std::vector< OffGridTarget > > > > off_grid_spike_register_;
 
+  /**
+   * Registers for spikes of the previous slice, which are still being
+   * communicated during the update of the current slice if spike
+   * communication is pipelined. Same layout as spike_register_ and
+   * off_grid_spike_register_.
+   */
+  std::vector< std::vector< std::vector< std::vector< SpikeTarget > > > > pending_spike_register_;
+  std::vector< std::vector< std::vector< std::vector< OffGridTarget > > > > pending_off_grid_spike_register_;
+
+  /**
+   * Spike registers restored from a checkpoint. They replace the spike
+   * registers when these are set up by configure_spike_register().
+   */
+  std::vector< std::vector< std::vector< std::vector< SpikeTarget > > > > restored_spike_register_;
+  std::vector< std::vector< std::vector< std::vector< OffGridTarget > > > > restored_off_grid_spike_register_;
+
   /**
    * Buffer to collect the secondary events
    * after serialization.
@@ -432,6 +541,28 @@ private:
   std::vector< OffGridSpikeData > send_buffer_off_grid_spike_data_;
   std::vector< OffGridSpikeData > recv_buffer_off_grid_spike_data_;
 
+  /**
+   * Positions of received spikes sorted by target thread, used for
+   * partitioned spike delivery.
+   * - First dim: segment of MPI receive buffer (one per thread)
+   * - Second dim: target thread
+   * - Third dim: position in MPI receive buffer
+   */
+  std::vector< std::vector< std::vector< unsigned int > > > spike_data_positions_;
+
+  /**
+   * Ends of valid regions of each rank's chunk derived from end and
+   * invalid markers found in each segment of the MPI receive buffer,
+   * at most one per rank and segment.
+   */
+  std::vector< std::vector< std::pair< thread, unsigned int > > > spike_data_end_markers_;
+
+  /**
+   * One past the position of the last valid entry in the part of the
+   * MPI receive buffer that belongs to each rank.
+   */
+  std::vector< unsigned int > spike_data_valid_ends_;
+
   std::vector< TargetData > send_buffer_target_data_;
   std::vector< TargetData > recv_buffer_target_data_;
   //!< whether size of MPI buffer for communication of connections was changed
@@ -445,11 +576,11 @@ private:
 inline void
 EventDeliveryManager::reset_spike_register_( const thread tid )
 {
-  for ( std::vector< std::vector< std::vector< Target > > >::iterator it = spike_register_[ tid ].begin();
+  for ( std::vector< std::vector< std::vector< SpikeTarget > > >::iterator it = spike_register_[ tid ].begin();
         it < spike_register_[ tid ].end();
         ++it )
   {
-    for ( std::vector< std::vector< Target > >::iterator iit = it->begin(); iit < it->end(); ++iit )
+    for ( std::vector< std::vector< SpikeTarget > >::iterator iit = it->begin(); iit < it->end(); ++iit )
     {
       ( *iit ).clear();
     }
@@ -476,13 +607,13 @@ EventDeliveryManager::is_marked_for_removal_( const Target& target )
 inline void
 EventDeliveryManager::clean_spike_register_( const thread tid )
 {
-  for ( std::vector< std::vector< std::vector< Target > > >::iterator it = spike_register_[ tid ].begin();
+  for ( std::vector< std::vector< std::vector< SpikeTarget > > >::iterator it = spike_register_[ tid ].begin();
         it < spike_register_[ tid ].end();
         ++it )
   {
-    for ( std::vector< std::vector< Target > >::iterator iit = it->begin(); iit < it->end(); ++iit )
+    for ( std::vector< std::vector< SpikeTarget > >::iterator iit = it->begin(); iit < it->end(); ++iit )
     {
-      std::vector< Target >::iterator new_end = std::remove_if( iit->begin(), iit->end(), is_marked_for_removal_ );
+      std::vector< SpikeTarget >::iterator new_end = std::remove_if( iit->begin(), iit->end(), is_marked_for_removal_ );
       iit->erase( new_end, iit->end() );
     }
   }
@@ -518,6 +649,19 @@ EventDeliveryManager::set_off_grid_communication( bool off_grid_spiking )
   off_grid_spiking_ = off_grid_spiking;
 }
 
+inline bool
+EventDeliveryManager::get_pipeline_spike_communication() const
+{
+  return pipeline_spike_communication_;
+}
+
+inline void
+EventDeliveryManager::swap_spike_registers_()
+{
+  spike_register_.swap( pending_spike_register_ );
+  off_grid_spike_register_.swap( pending_off_grid_spike_register_ );
+}
+
 inline size_t
 EventDeliveryManager::read_toggle() const
 {
@@ -110,10 +110,7 @@ EventDeliveryManager::send_remote( thread tid, SpikeEvent& e, const long lag )
   for ( std::vector< Target >::const_iterator it = targets.begin(); it != targets.end(); ++it )
   {
     const thread assigned_tid = ( *it ).get_rank() / kernel().vp_manager.get_num_assigned_ranks_per_thread();
-    for ( int i = 0; i < e.get_multiplicity(); ++i )
-    {
-      spike_register_[ tid ][ assigned_tid ][ lag ].push_back( *it );
-    }
+    spike_register_[ tid ][ assigned_tid ][ lag ].push_back( SpikeTarget( *it, e.get_multiplicity() ) );
   }
 }
 
@@ -127,10 +124,8 @@ EventDeliveryManager::send_off_grid_remote( thread tid, SpikeEvent& e, const lon
   for ( std::vector< Target >::const_iterator it = targets.begin(); it != targets.end(); ++it )
   {
     const thread assigned_tid = ( *it ).get_rank() / kernel().vp_manager.get_num_assigned_ranks_per_thread();
-    for ( int i = 0; i < e.get_multiplicity(); ++i )
-    {
-      off_grid_spike_register_[ tid ][ assigned_tid ][ lag ].push_back( OffGridTarget( *it, e.get_offset() ) );
-    }
+    off_grid_spike_register_[ tid ][ assigned_tid ][ lag ].push_back(
+      OffGridTarget( *it, e.get_multiplicity(), e.get_offset() ) );
   }
 }
 
@@ -137,6 +137,12 @@ nest::NodeWithProxiesExpected::message() const
   return out.str();
 }
 
+std::string
+nest::RecorderExpected::message() const
+{
+  return "Model " + model_ + " does not record events.";
+}
+
 std::string
 nest::UnknownReceptorType::message() const
 {
@@ -411,3 +417,9 @@ nest::InternalError::message() const
 {
   return msg_;
 }
+
+std::string
+nest::CheckpointError::message() const
+{
+  return msg_;
+}
@@ -309,6 +309,29 @@ public:
   std::string message() const;
 };
 
+/**
+ * Exception to be thrown if events are taken from a node
+ * that does not record events.
+ * @ingroup KernelExceptions
+ */
+class RecorderExpected : public KernelException
+{
+  std::string model_;
+
+public:
+  RecorderExpected( const std::string& model )
+    : KernelException( "RecorderExpected" )
+    , model_( model )
+  {
+  }
+
+  ~RecorderExpected() throw()
+  {
+  }
+
+  std::string message() const;
+};
+
 /**
  * Exception to be thrown if the specified
  * receptor type does not exist in the node.
@@ -958,6 +981,29 @@ public:
 };
 
 
+/**
+ * Exception to be thrown if a checkpoint cannot be written or restored.
+ * @ingroup KernelExceptions
+ */
+class CheckpointError : public KernelException
+{
+  std::string msg_;
+
+public:
+  //! @param detailed error message
+  CheckpointError( std::string msg )
+    : KernelException( "CheckpointError" )
+    , msg_( msg )
+  {
+  }
+
+  ~CheckpointError() throw()
+  {
+  }
+
+  std::string message() const;
+};
+
 #ifdef HAVE_MUSIC
 /**
  * Exception to be thrown if a music_event_out_proxy is generated, but the music
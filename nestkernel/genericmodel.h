@@ -59,6 +59,7 @@ public:
   bool has_proxies();
   bool one_node_per_process();
   bool is_off_grid();
+  bool has_thread_safe_copy();
   /**
      @note The decision of whether one node can receive a certain
      event was originally in the node. But in the distributed case,
@@ -187,6 +188,13 @@ GenericModel< ElementT >::is_off_grid()
   return proto_.is_off_grid();
 }
 
+template < typename ElementT >
+inline bool
+GenericModel< ElementT >::has_thread_safe_copy()
+{
+  return proto_.has_thread_safe_copy();
+}
+
 template < typename ElementT >
 inline port
 GenericModel< ElementT >::send_test_event( Node& target, rport receptor, synindex syn_id, bool dummy_target )
@@ -30,11 +30,11 @@
 
 #include "histentry.h"
 
-nest::histentry::histentry( double t, double Kminus, double triplet_Kminus, size_t access_counter )
+nest::histentry::histentry( double t, double Kminus, double triplet_Kminus, size_t n_waiting )
   : t_( t )
   , Kminus_( Kminus )
   , triplet_Kminus_( triplet_Kminus )
-  , access_counter_( access_counter )
+  , n_waiting_( n_waiting )
 {
 }
 
@@ -42,14 +42,15 @@ namespace nest
 class histentry
 {
 public:
-  histentry( double t, double Kminus, double triplet_Kminus, size_t access_counter );
+  histentry( double t, double Kminus, double triplet_Kminus, size_t n_waiting );
 
   double t_;              //!< point in time when spike occurred (in ms)
   double Kminus_;         //!< value of Kminus at that time
   double triplet_Kminus_; //!< value of triplet STDP Kminus at that time
-  //! how often this entry was accessed (to enable removal, once read by all
-  //! neurons which need it)
-  size_t access_counter_;
+  //! number of incoming connections for which this is the next entry to read
+  //! (to enable removal, once all entries up to and including it are read
+  //! by all connections which need them)
+  size_t n_waiting_;
 };
 
 // entry in the history of LTD and LTP for clopath-STDP synapse
@@ -35,6 +35,7 @@
 #include "logging.h"
 
 // Includes from nestkernel:
+#include "exceptions.h"
 #include "kernel_manager.h"
 
 // Includes from sli:
@@ -42,6 +43,8 @@
 
 nest::IOManager::IOManager()
   : overwrite_files_( false )
+  , async_recording_( false )
+  , async_recording_buffer_size_( 1 << 26 )
 {
 }
 
@@ -118,16 +121,35 @@ nest::IOManager::finalize()
   data_path_ = "";
   data_prefix_ = "";
   overwrite_files_ = false;
+
+  async_writer_.stop();
+  async_recording_ = false;
+  async_recording_buffer_size_ = 1 << 26;
 }
 
 /*
      - set the data_path, data_prefix and overwrite_files properties
+     - set the properties of asynchronous recording
 */
 void
 nest::IOManager::set_status( const DictionaryDatum& d )
 {
   set_data_path_prefix_( d );
   updateValue< bool >( d, names::overwrite_files, overwrite_files_ );
+
+  long buffer_size = async_recording_buffer_size_;
+  const bool buffer_size_changed = updateValue< long >( d, names::async_recording_buffer_size, buffer_size );
+  if ( buffer_size_changed and buffer_size <= 0 )
+  {
+    throw BadProperty( "async_recording_buffer_size must be positive." );
+  }
+  async_recording_buffer_size_ = buffer_size;
+
+  if ( updateValue< bool >( d, names::async_recording, async_recording_ ) or buffer_size_changed )
+  {
+    // the writer is restarted with the new settings by prepare()
+    async_writer_.stop();
+  }
 }
 
 void
@@ -136,4 +158,36 @@ nest::IOManager::get_status( DictionaryDatum& d )
   ( *d )[ names::data_path ] = data_path_;
   ( *d )[ names::data_prefix ] = data_prefix_;
   ( *d )[ names::overwrite_files ] = overwrite_files_;
+  ( *d )[ names::async_recording ] = async_recording_;
+  ( *d )[ names::async_recording_buffer_size ] = async_recording_buffer_size_;
+}
+
+void
+nest::IOManager::prepare()
+{
+  // devices write output left over from an interrupted simulation directly
+  // to their files in calibrate(), after the output queued before
+  async_writer_.drain();
+
+  if ( async_recording_
+    and async_writer_.get_num_queues() != static_cast< size_t >( kernel().vp_manager.get_num_threads() ) )
+  {
+    async_writer_.stop();
+  }
+  if ( async_recording_ and not async_writer_.is_running() )
+  {
+    async_writer_.start( kernel().vp_manager.get_num_threads(), async_recording_buffer_size_ );
+  }
+}
+
+void
+nest::IOManager::post_run_cleanup()
+{
+  async_writer_.drain();
+}
+
+void
+nest::IOManager::stop_async_writer()
+{
+  async_writer_.stop();
 }
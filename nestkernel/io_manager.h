@@ -29,6 +29,9 @@
 // Includes from libnestutil:
 #include "manager_interface.h"
 
+// Includes from nestkernel:
+#include "async_writer.h"
+
 // Includes from sli:
 #include "dictdatum.h"
 
@@ -75,10 +78,42 @@ public:
    */
   bool overwrite_files() const;
 
+  /**
+   * Indicate if recording devices hand their file output to the
+   * asynchronous writer.
+   * @see get_async_writer()
+   */
+  bool async_recording() const;
+
+  AsyncWriter& get_async_writer();
+
+  /**
+   * Write output still queued from an interrupted simulation and start the
+   * asynchronous writer if required, called before simulating.
+   */
+  void prepare();
+
+  /**
+   * Write all queued output and stop the asynchronous writer.
+   * Must be called before recording devices are deleted, since the writer
+   * writes to their streams.
+   */
+  void stop_async_writer();
+
+  /**
+   * Wait until the asynchronous writer has written all file output of
+   * recording devices, called after the devices' post_run_cleanup().
+   */
+  void post_run_cleanup();
+
 private:
   std::string data_path_;   //!< Path for all files written by devices
   std::string data_prefix_; //!< Prefix for all files written by devices
   bool overwrite_files_;    //!< If true, overwrite existing data files.
+
+  bool async_recording_;             //!< If true, write files in background thread
+  long async_recording_buffer_size_; //!< Bytes queued per thread for writer
+  AsyncWriter async_writer_;         //!< Background thread for file output
 };
 }
 
@@ -101,4 +136,16 @@ nest::IOManager::overwrite_files() const
   return overwrite_files_;
 }
 
+inline bool
+nest::IOManager::async_recording() const
+{
+  return async_recording_;
+}
+
+inline nest::AsyncWriter&
+nest::IOManager::get_async_writer()
+{
+  return async_writer_;
+}
+
 #endif /* IO_MANAGER_H */
@@ -22,8 +22,30 @@
 
 #include "kernel_manager.h"
 
+// C++ includes:
+#include <fstream>
+
+// Includes from libnestutil:
+#include "binary_io.h"
+#include "compose.hpp"
+
 nest::KernelManager* nest::KernelManager::kernel_manager_instance_ = 0;
 
+namespace
+{
+// "NESTCKPT" in ASCII
+const uint64_t checkpoint_magic = 0x4e455354434b5054ULL;
+
+// increase whenever the content of checkpoints changes
+const unsigned int checkpoint_version = 1;
+
+std::string
+checkpoint_filename( const std::string& prefix )
+{
+  return String::compose( "%1-%2.nestckpt", prefix, nest::kernel().mpi_manager.get_rank() );
+}
+}
+
 void
 nest::KernelManager::create_kernel_manager()
 {
@@ -113,6 +135,10 @@ nest::KernelManager::finalize()
 {
   initialized_ = false;
 
+  // the writer may still hold output of recording devices if a simulation
+  // was interrupted, so it must write it before the devices are deleted
+  io_manager.stop_async_writer();
+
   // reverse order of calls as in initialize()
   node_manager.finalize();
   music_manager.finalize();
@@ -142,11 +168,16 @@ nest::KernelManager::reset()
 void
 nest::KernelManager::change_num_threads( size_t num_threads )
 {
+  io_manager.stop_async_writer();
+  // keep the setting of the user, which connection_manager.finalize() resets
+  const bool incremental_connection_update = connection_manager.get_incremental_connection_update();
+
   node_manager.finalize();
   connection_manager.finalize();
   model_manager.finalize();
   modelrange_manager.finalize();
-  rng_manager.finalize();
+  // rng_manager is not finalized, as this would reset the settings of the
+  // user; initialize() creates the RNGs for the new number of threads
 
   vp_manager.set_num_threads( num_threads );
 
@@ -155,6 +186,7 @@ nest::KernelManager::change_num_threads( size_t num_threads )
   modelrange_manager.initialize();
   model_manager.initialize();
   connection_manager.initialize();
+  connection_manager.set_incremental_connection_update( incremental_connection_update );
   event_delivery_manager.initialize();
   music_manager.initialize();
   node_manager.initialize();
@@ -206,3 +238,120 @@ nest::KernelManager::get_status( DictionaryDatum& dict )
 
   node_manager.get_status( dict );
 }
+
+void
+nest::KernelManager::save_checkpoint( const std::string& prefix )
+{
+  assert( is_initialized() );
+
+  if ( simulation_manager.has_been_prepared() )
+  {
+    throw CheckpointError( "Checkpoints cannot be written between Prepare and Cleanup." );
+  }
+
+  const std::string filename = checkpoint_filename( prefix );
+  std::ofstream os;
+  os.exceptions( std::ios_base::failbit | std::ios_base::badbit );
+  try
+  {
+    os.open( filename.c_str(), std::ios_base::out | std::ios_base::binary | std::ios_base::trunc );
+
+    write_binary( os, checkpoint_magic );
+    write_binary( os, checkpoint_version );
+    write_binary( os, mpi_manager.get_num_processes() );
+    write_binary( os, mpi_manager.get_rank() );
+    write_binary( os, vp_manager.get_num_threads() );
+    write_binary( os, node_manager.size() );
+    write_binary( os, Time::get_resolution().get_tics() );
+
+    // the order of managers must match load_checkpoint()
+    simulation_manager.save_checkpoint( os );
+    rng_manager.save_checkpoint( os );
+    connection_manager.save_checkpoint( os );
+    node_manager.save_checkpoint( os );
+    event_delivery_manager.save_checkpoint( os );
+
+    os.close();
+  }
+  catch ( std::ios_base::failure& )
+  {
+    throw CheckpointError( String::compose( "Could not write checkpoint file %1.", filename ) );
+  }
+}
+
+void
+nest::KernelManager::load_checkpoint( const std::string& prefix )
+{
+  assert( is_initialized() );
+
+  if ( simulation_manager.has_been_simulated() or simulation_manager.has_been_prepared() )
+  {
+    throw CheckpointError( "Checkpoints can only be loaded before the first simulation." );
+  }
+
+  const std::string filename = checkpoint_filename( prefix );
+  std::ifstream is;
+  is.exceptions( std::ios_base::failbit | std::ios_base::badbit );
+
+  // set once the first manager has started to restore its state; an error
+  // after this point leaves the kernel partly restored
+  bool restoring = false;
+  try
+  {
+    is.open( filename.c_str(), std::ios_base::in | std::ios_base::binary );
+
+    uint64_t magic = 0;
+    read_binary( is, magic );
+    unsigned int version = 0;
+    read_binary( is, version );
+    if ( magic != checkpoint_magic or version != checkpoint_version )
+    {
+      throw CheckpointError( String::compose( "%1 is not a checkpoint file of this version of NEST.", filename ) );
+    }
+
+    thread num_processes = 0;
+    thread rank = 0;
+    thread num_threads = 0;
+    index network_size = 0;
+    tic_t resolution = 0;
+    read_binary( is, num_processes );
+    read_binary( is, rank );
+    read_binary( is, num_threads );
+    read_binary( is, network_size );
+    read_binary( is, resolution );
+    if ( num_processes != mpi_manager.get_num_processes() or rank != mpi_manager.get_rank()
+      or num_threads != vp_manager.get_num_threads() )
+    {
+      throw CheckpointError( "Number of processes and threads must be the same as for the checkpoint." );
+    }
+    if ( network_size != node_manager.size() or resolution != Time::get_resolution().get_tics() )
+    {
+      throw CheckpointError( "Network or resolution differ from checkpoint." );
+    }
+
+    restoring = true;
+    simulation_manager.load_checkpoint( is );
+    rng_manager.load_checkpoint( is );
+    connection_manager.load_checkpoint( is );
+    node_manager.load_checkpoint( is );
+    event_delivery_manager.load_checkpoint( is );
+  }
+  catch ( std::ios_base::failure& )
+  {
+    if ( restoring )
+    {
+      reset();
+      throw CheckpointError(
+        String::compose( "Could not read checkpoint file %1. The kernel has been reset.", filename ) );
+    }
+    throw CheckpointError( String::compose( "Could not read checkpoint file %1.", filename ) );
+  }
+  catch ( ... )
+  {
+    if ( restoring )
+    {
+      reset();
+    }
+    throw;
+  }
+}
@@ -23,6 +23,9 @@
 #ifndef KERNEL_MANAGER_H
 #define KERNEL_MANAGER_H
 
+// C++ includes:
+#include <string>
+
 // Includes from nestkernel:
 #include "connection_manager.h"
 #include "event_delivery_manager.h"
@@ -92,6 +95,10 @@
                                              (default is the current directory)
  data_prefix                   stringtype  - A common prefix for all data files
  overwrite_files               booltype    - Whether to overwrite existing data files
+ async_recording               booltype    - Whether recording devices write files in a background thread
+                                             instead of the simulation threads
+ async_recording_buffer_size   integertype - Maximal number of bytes of file output queued per thread
+                                             for the background thread (default 64 MiB)
  print_time                    booltype    - Whether to print progress information during the simulation
 
  Network information
@@ -175,6 +182,30 @@ public:
   void set_status( const DictionaryDatum& );
   void get_status( DictionaryDatum& );
 
+  /**
+   * Write the state of the simulation to a checkpoint.
+   *
+   * Each MPI process writes the state of its part of the network to the
+   * file <prefix>-<rank>.nestckpt. The checkpoint contains the state that
+   * changes during simulation, i.e., the network time, the states of the
+   * random generators, nodes and connections, and the spikes not yet
+   * delivered. It does not contain the network itself.
+   *
+   * @see load_checkpoint()
+   */
+  void save_checkpoint( const std::string& prefix );
+
+  /**
+   * Restore the state of the simulation from a checkpoint.
+   *
+   * The network must have been rebuilt in the same way and with the same
+   * kernel parameters as the network the checkpoint was written for, and
+   * must not have been simulated yet.
+   *
+   * @see save_checkpoint()
+   */
+  void load_checkpoint( const std::string& prefix );
+
   //! Returns true if kernel is initialized
   bool is_initialized() const;
 
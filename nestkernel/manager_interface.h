@@ -23,6 +23,9 @@
 #ifndef MANAGER_INTERFACE_H
 #define MANAGER_INTERFACE_H
 
+// C++ includes:
+#include <iosfwd>
+
 // Includes from sli:
 #include "dictdatum.h"
 
@@ -89,6 +92,30 @@ public:
 
   virtual void set_status( const DictionaryDatum& ) = 0;
   virtual void get_status( DictionaryDatum& ) = 0;
+
+  /**
+   * Write the state of the manager that changes during simulation to a
+   * checkpoint.
+   *
+   * Managers without such state need not override this method.
+   *
+   * @see KernelManager::save_checkpoint(), load_checkpoint()
+   */
+  virtual void
+  save_checkpoint( std::ostream& )
+  {
+  }
+
+  /**
+   * Restore the state written by save_checkpoint().
+   *
+   * The network must have been rebuilt as it was when the checkpoint was
+   * written, but must not have been simulated yet.
+   */
+  virtual void
+  load_checkpoint( std::istream& )
+  {
+  }
 };
 }
 
@@ -134,6 +134,7 @@ public:
   virtual bool has_proxies() = 0;
   virtual bool one_node_per_process() = 0;
   virtual bool is_off_grid() = 0;
+  virtual bool has_thread_safe_copy() = 0;
 
   /**
    * Change properties of the prototype node according to the
@@ -75,6 +75,7 @@ nest::MPIManager::MPIManager()
   , COMM_OVERFLOW_ERROR( std::numeric_limits< unsigned int >::max() )
   , comm( 0 )
   , MPI_OFFGRID_SPIKE( 0 )
+  , spike_data_request_( MPI_REQUEST_NULL )
 #endif
 {
 }
@@ -655,6 +656,39 @@ nest::MPIManager::communicate_Allreduce_max_in_place( std::vector< long >& buffe
   MPI_Allreduce( MPI_IN_PLACE, &buffer[ 0 ], 1, MPI_LONG, MPI_MAX, comm );
 }
 
+void
+nest::MPIManager::communicate_Alltoallv( std::vector< unsigned long >& send_buffer,
+  const std::vector< int >& send_counts,
+  std::vector< unsigned long >& recv_buffer,
+  const std::vector< int >& recv_counts )
+{
+  assert( send_counts.size() == static_cast< size_t >( num_processes_ ) );
+  assert( recv_counts.size() == static_cast< size_t >( num_processes_ ) );
+
+  std::vector< int > send_displacements( num_processes_, 0 );
+  std::vector< int > recv_displacements( num_processes_, 0 );
+  for ( int i = 1; i < num_processes_; ++i )
+  {
+    send_displacements[ i ] = send_displacements[ i - 1 ] + send_counts[ i - 1 ];
+    recv_displacements[ i ] = recv_displacements[ i - 1 ] + recv_counts[ i - 1 ];
+  }
+  assert( send_buffer.size()
+    == static_cast< size_t >( send_displacements[ num_processes_ - 1 ] + send_counts[ num_processes_ - 1 ] ) );
+  recv_buffer.resize( recv_displacements[ num_processes_ - 1 ] + recv_counts[ num_processes_ - 1 ] );
+
+  // MPI does not access empty buffers, but &v[ 0 ] is undefined for them
+  unsigned long dummy = 0;
+  MPI_Alltoallv( send_buffer.empty() ? &dummy : &send_buffer[ 0 ],
+    const_cast< int* >( &send_counts[ 0 ] ),
+    &send_displacements[ 0 ],
+    MPI_UNSIGNED_LONG,
+    recv_buffer.empty() ? &dummy : &recv_buffer[ 0 ],
+    const_cast< int* >( &recv_counts[ 0 ] ),
+    &recv_displacements[ 0 ],
+    MPI_UNSIGNED_LONG,
+    comm );
+}
+
 void
 nest::MPIManager::communicate_Allgather( std::vector< long >& buffer )
 {
@@ -682,6 +716,33 @@ nest::MPIManager::communicate_secondary_events_Alltoall_( void* send_buffer, voi
     comm );
 }
 
+void
+nest::MPIManager::communicate_Ialltoall_( void* send_buffer, void* recv_buffer, const unsigned int send_recv_count )
+{
+  assert( spike_data_request_ == MPI_REQUEST_NULL );
+#if MPI_VERSION >= 3
+  MPI_Ialltoall( send_buffer,
+    send_recv_count,
+    MPI_UNSIGNED,
+    recv_buffer,
+    send_recv_count,
+    MPI_UNSIGNED,
+    comm,
+    &spike_data_request_ );
+#else
+  MPI_Alltoall( send_buffer, send_recv_count, MPI_UNSIGNED, recv_buffer, send_recv_count, MPI_UNSIGNED, comm );
+#endif
+}
+
+void
+nest::MPIManager::wait_spike_data()
+{
+  if ( spike_data_request_ != MPI_REQUEST_NULL )
+  {
+    MPI_Wait( &spike_data_request_, MPI_STATUS_IGNORE );
+  }
+}
+
 /**
  * Ensure all processes have reached the same stage by waiting until all
  * processes have sent a dummy message to process 0.
@@ -1119,4 +1180,13 @@ nest::MPIManager::communicate_Allreduce_max_in_place( std::vector< long >& buffe
   // Max already is the input
 }
 
+void
+nest::MPIManager::communicate_Alltoallv( std::vector< unsigned long >& send_buffer,
+  const std::vector< int >&,
+  std::vector< unsigned long >& recv_buffer,
+  const std::vector< int >& )
+{
+  recv_buffer.swap( send_buffer );
+}
+
 #endif /* #ifdef HAVE_MPI */
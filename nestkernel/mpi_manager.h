@@ -153,6 +153,20 @@ public:
    */
   void communicate_Allreduce_max_in_place( std::vector< long >& buffer );
 
+  /**
+   * Personalized all-to-all exchange of variable-sized blocks.
+   *
+   * send_buffer holds the blocks for all ranks in rank order, block r
+   * having send_counts[ r ] entries. recv_buffer is resized to hold the
+   * blocks received from all ranks in rank order, block r having
+   * recv_counts[ r ] entries. The counts must be consistent across ranks,
+   * i.e., send_counts[ r ] on rank s equals recv_counts[ s ] on rank r.
+   */
+  void communicate_Alltoallv( std::vector< unsigned long >& send_buffer,
+    const std::vector< int >& send_counts,
+    std::vector< unsigned long >& recv_buffer,
+    const std::vector< int >& recv_counts );
+
   /**
    * Collect GIDs for all nodes in a given node list across processes.
    * The NodeListType should be one of LocalNodeList, LocalLeafList,
@@ -204,6 +218,8 @@ public:
   void communicate_Alltoall_( void* send_buffer, void* recv_buffer, const unsigned int send_recv_count );
 
   void communicate_secondary_events_Alltoall_( void* send_buffer, void* recv_buffer );
+
+  void communicate_Ialltoall_( void* send_buffer, void* recv_buffer, const unsigned int send_recv_count );
 #endif // HAVE_MPI
 
   template < class D >
@@ -219,6 +235,22 @@ public:
   template < class D >
   void communicate_secondary_events_Alltoall( std::vector< D >& send_buffer, std::vector< D >& recv_buffer );
 
+  /**
+   * Starts a non-blocking exchange of spike data. The buffers must not
+   * be accessed before wait_spike_data() has returned. Without support
+   * for non-blocking collectives (MPI < 3), the exchange is blocking.
+   */
+  template < class D >
+  void communicate_spike_data_Ialltoall( std::vector< D >& send_buffer, std::vector< D >& recv_buffer );
+  template < class D >
+  void communicate_off_grid_spike_data_Ialltoall( std::vector< D >& send_buffer, std::vector< D >& recv_buffer );
+
+  /**
+   * Waits for completion of the exchange started by
+   * communicate_spike_data_Ialltoall().
+   */
+  void wait_spike_data();
+
   void synchronize();
 
   // TODO: not used...
@@ -316,6 +348,9 @@ private:
 #endif /* #ifdef HAVE_MUSIC */
   MPI_Datatype MPI_OFFGRID_SPIKE;
 
+  //! Request of pending non-blocking exchange of spike data
+  MPI_Request spike_data_request_;
+
   void communicate_Allgather( std::vector< unsigned int >& send_buffer,
     std::vector< unsigned int >& recv_buffer,
     std::vector< int >& displacements );
@@ -654,6 +689,11 @@ MPIManager::synchronize()
 {
 }
 
+inline void
+MPIManager::wait_spike_data()
+{
+}
+
 inline void
 test_link( int, int )
 {
@@ -735,6 +775,30 @@ MPIManager::communicate_secondary_events_Alltoall( std::vector< D >& send_buffer
   communicate_secondary_events_Alltoall_( send_buffer_int, recv_buffer_int );
 }
 
+template < class D >
+void
+MPIManager::communicate_spike_data_Ialltoall( std::vector< D >& send_buffer, std::vector< D >& recv_buffer )
+{
+  const size_t send_recv_count_spike_data_in_int_per_rank =
+    sizeof( SpikeData ) / sizeof( unsigned int ) * send_recv_count_spike_data_per_rank_;
+
+  communicate_Ialltoall_( static_cast< void* >( &send_buffer[ 0 ] ),
+    static_cast< void* >( &recv_buffer[ 0 ] ),
+    send_recv_count_spike_data_in_int_per_rank );
+}
+
+template < class D >
+void
+MPIManager::communicate_off_grid_spike_data_Ialltoall( std::vector< D >& send_buffer, std::vector< D >& recv_buffer )
+{
+  const size_t send_recv_count_off_grid_spike_data_in_int_per_rank =
+    sizeof( OffGridSpikeData ) / sizeof( unsigned int ) * send_recv_count_spike_data_per_rank_;
+
+  communicate_Ialltoall_( static_cast< void* >( &send_buffer[ 0 ] ),
+    static_cast< void* >( &recv_buffer[ 0 ] ),
+    send_recv_count_off_grid_spike_data_in_int_per_rank );
+}
+
 
 #else // HAVE_MPI
 template < class D >
@@ -753,6 +817,20 @@ MPIManager::communicate_secondary_events_Alltoall( std::vector< D >& send_buffer
   recv_buffer.swap( send_buffer );
 }
 
+template < class D >
+void
+MPIManager::communicate_spike_data_Ialltoall( std::vector< D >& send_buffer, std::vector< D >& recv_buffer )
+{
+  recv_buffer.swap( send_buffer );
+}
+
+template < class D >
+void
+MPIManager::communicate_off_grid_spike_data_Ialltoall( std::vector< D >& send_buffer, std::vector< D >& recv_buffer )
+{
+  recv_buffer.swap( send_buffer );
+}
+
 #endif // HAVE_MPI
 
 template < class D >
@@ -158,6 +158,24 @@ get_node_status( const index node_id )
   return kernel().node_manager.get_status( node_id );
 }
 
+DictionaryDatum
+take_node_events( const index node_id )
+{
+  return kernel().node_manager.take_events( node_id );
+}
+
+std::vector< double >
+get_node_values( const GIDCollection& gids, const Name& name )
+{
+  return kernel().node_manager.get_values( gids, name );
+}
+
+void
+set_node_values( const GIDCollection& gids, const Name& name, const std::vector< double >& values )
+{
+  kernel().node_manager.set_values( gids, name, values );
+}
+
 void
 set_connection_status( const ConnectionDatum& conn, const DictionaryDatum& dict )
 {
@@ -288,6 +306,18 @@ cleanup()
   kernel().simulation_manager.cleanup();
 }
 
+void
+save_checkpoint( const std::string& prefix )
+{
+  kernel().save_checkpoint( prefix );
+}
+
+void
+load_checkpoint( const std::string& prefix )
+{
+  kernel().load_checkpoint( prefix );
+}
+
 void
 copy_model( const Name& oldmodname, const Name& newmodname, const DictionaryDatum& dict )
 {
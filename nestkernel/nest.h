@@ -25,6 +25,7 @@
 
 // C++ includes:
 #include <ostream>
+#include <vector>
 
 // Includes from libnestutil:
 #include "enum_bitfield.h"
@@ -107,6 +108,24 @@ DictionaryDatum get_kernel_status();
 void set_node_status( const index node_id, const DictionaryDatum& dict );
 DictionaryDatum get_node_status( const index node_id );
 
+/**
+ * Return the events recorded by a recording device and erase them from
+ * the device, so that they are not held twice.
+ */
+DictionaryDatum take_node_events( const index node_id );
+
+/**
+ * Return a numeric state variable or parameter of nodes as one array.
+ * Values of nodes that are not local to this process are NaN.
+ */
+std::vector< double > get_node_values( const GIDCollection& gids, const Name& name );
+
+/**
+ * Set a numeric state variable or parameter of nodes from one array,
+ * which must have one value per node.
+ */
+void set_node_values( const GIDCollection& gids, const Name& name, const std::vector< double >& values );
+
 void set_connection_status( const ConnectionDatum& conn, const DictionaryDatum& dict );
 DictionaryDatum get_connection_status( const ConnectionDatum& conn );
 
@@ -162,6 +181,27 @@ void prepare();
  */
 void cleanup();
 
+/**
+ * @fn save_checkpoint(const std::string& prefix)
+ * @brief write the state of the simulation to checkpoint files
+ *
+ * Each MPI process writes the file <prefix>-<rank>.nestckpt.
+ *
+ * @see load_checkpoint()
+ */
+void save_checkpoint( const std::string& prefix );
+
+/**
+ * @fn load_checkpoint(const std::string& prefix)
+ * @brief restore the state of the simulation from checkpoint files
+ *
+ * The network must have been rebuilt as when the checkpoint was written
+ * and must not have been simulated yet.
+ *
+ * @see save_checkpoint()
+ */
+void load_checkpoint( const std::string& prefix );
+
 void copy_model( const Name& oldmodname, const Name& newmodname, const DictionaryDatum& dict );
 
 void set_model_defaults( const Name& model_name, const DictionaryDatum& );
@@ -67,13 +67,17 @@ const Name asc_init( "asc_init" );
 const Name asc_r( "asc_r" );
 const Name ASCurrents( "ASCurrents" );
 const Name ASCurrents_sum( "ASCurrents_sum" );
+const Name async_recording( "async_recording" );
+const Name async_recording_buffer_size( "async_recording_buffer_size" );
 const Name autapses( "autapses" );
 const Name available( "available" );
 
 const Name b( "b" );
+const Name batch_node_update( "batch_node_update" );
 const Name beta( "beta" );
 const Name beta_Ca( "beta_Ca" );
 const Name binary( "binary" );
+const Name binary_file( "binary_file" );
 const Name buffer_size_secondary_events( "buffer_size_secondary_events" );
 const Name buffer_size_spike_data( "buffer_size_spike_data" );
 const Name buffer_size_target_data( "buffer_size_target_data" );
@@ -232,6 +236,7 @@ const Name I_T( "I_T" );
 const Name in_spikes( "in_spikes" );
 const Name Inact_h( "Inact_h" );
 const Name Inact_p( "Inact_p" );
+const Name incremental_connection_update( "incremental_connection_update" );
 const Name indegree( "indegree" );
 const Name index_map( "index_map" );
 const Name individual_spike_trains( "individual_spike_trains" );
@@ -243,6 +248,7 @@ const Name interval( "interval" );
 const Name is_refractory( "is_refractory" );
 
 const Name keep_source_table( "keep_source_table" );
+const Name keyed_connection_rngs( "keyed_connection_rngs" );
 const Name Kplus( "Kplus" );
 const Name Kplus_triplet( "Kplus_triplet" );
 
@@ -317,7 +323,9 @@ const Name P( "P" );
 const Name p_copy( "p_copy" );
 const Name p_transmit( "p_transmit" );
 const Name parent( "parent" );
+const Name partition_spike_delivery( "partition_spike_delivery" );
 const Name phase( "phase" );
+const Name pipeline_spike_communication( "pipeline_spike_communication" );
 const Name port( "port" );
 const Name port_name( "port_name" );
 const Name port_width( "port_width" );
@@ -411,6 +419,7 @@ const Name t_ref_abs( "t_ref_abs" );
 const Name t_ref_remaining( "t_ref_remaining" );
 const Name t_ref_tot( "t_ref_tot" );
 const Name t_spike( "t_spike" );
+const Name tabulate_decay( "tabulate_decay" );
 const Name target( "target" );
 const Name target_thread( "target_thread" );
 const Name targets( "targets" );
@@ -490,6 +499,7 @@ const Name time_communicate( "time_communicate" );
 const Name time_in_steps( "time_in_steps" );
 const Name times( "times" );
 const Name to_accumulator( "to_accumulator" );
+const Name to_binary_file( "to_binary_file" );
 const Name to_do( "to_do" );
 const Name to_file( "to_file" );
 const Name to_memory( "to_memory" );
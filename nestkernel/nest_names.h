@@ -88,13 +88,17 @@ extern const Name asc_init;
 extern const Name asc_r;
 extern const Name ASCurrents;
 extern const Name ASCurrents_sum;
+extern const Name async_recording;
+extern const Name async_recording_buffer_size;
 extern const Name autapses;
 extern const Name available;
 
 extern const Name b;
+extern const Name batch_node_update;
 extern const Name beta;
 extern const Name beta_Ca;
 extern const Name binary;
+extern const Name binary_file;
 extern const Name buffer_size_secondary_events;
 extern const Name buffer_size_spike_data;
 extern const Name buffer_size_target_data;
@@ -253,6 +257,7 @@ extern const Name I_T;
 extern const Name in_spikes;
 extern const Name Inact_h;
 extern const Name Inact_p;
+extern const Name incremental_connection_update;
 extern const Name indegree;
 extern const Name index_map;
 extern const Name individual_spike_trains;
@@ -264,6 +269,7 @@ extern const Name interval;
 extern const Name is_refractory;
 
 extern const Name keep_source_table;
+extern const Name keyed_connection_rngs;
 extern const Name Kplus;
 extern const Name Kplus_triplet;
 
@@ -338,7 +344,9 @@ extern const Name P;
 extern const Name p_copy;
 extern const Name p_transmit;
 extern const Name parent;
+extern const Name partition_spike_delivery;
 extern const Name phase;
+extern const Name pipeline_spike_communication;
 extern const Name port;
 extern const Name port_name;
 extern const Name port_width;
@@ -432,6 +440,7 @@ extern const Name t_ref_abs;
 extern const Name t_ref_remaining;
 extern const Name t_ref_tot;
 extern const Name t_spike;
+extern const Name tabulate_decay;
 extern const Name target;
 extern const Name target_thread;
 extern const Name targets;
@@ -511,6 +520,7 @@ extern const Name time_communicate;
 extern const Name time_in_steps;
 extern const Name times;
 extern const Name to_accumulator;
+extern const Name to_binary_file;
 extern const Name to_do;
 extern const Name to_file;
 extern const Name to_memory;
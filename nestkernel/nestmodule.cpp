@@ -393,6 +393,121 @@ NestModule::GetStatus_aFunction::execute( SLIInterpreter* i ) const
   i->EStack.pop();
 }
 
+/** @BeginDocumentation
+   Name: TakeEvents - return the events recorded by a device and erase them
+
+   Synopsis:
+   gid TakeEvents -> dict
+
+   Parameters:
+   gid  - global id of a recording device
+
+   Description:
+   TakeEvents returns the dictionary of events stored in memory by a
+   recording device, as gid /events get, and erases them from the device
+   as if /n_events were set to 0. Each event is thus returned only once.
+   The events are handed over instead of copied, which avoids holding the
+   data twice when reading large recordings during a simulation.
+
+   Examples:
+   SLI ] /spike_detector Create /sd Set
+   SLI ] sd TakeEvents /times get ==
+   <. .>
+
+   SeeAlso: GetStatus, spike_detector, multimeter
+*/
+void
+NestModule::TakeEvents_iFunction::execute( SLIInterpreter* i ) const
+{
+  i->assert_stack_load( 1 );
+
+  const index node_id = getValue< long >( i->OStack.pick( 0 ) );
+  DictionaryDatum events = take_node_events( node_id );
+
+  i->OStack.pop();
+  i->OStack.push( events );
+  i->EStack.pop();
+}
+
+/** @BeginDocumentation
+   Name: GetValues - return one property of many nodes as a vector
+
+   Synopsis:
+   gidcollection /name GetValues -> doublevector
+
+   Parameters:
+   gidcollection - nodes to read from
+   /name         - name of a state variable or parameter of type double
+
+   Description:
+   GetValues returns the property /name of all nodes in the collection as
+   one vector, in the order of the collection. This is equivalent to, but
+   much faster than, calling GetStatus for each node and extracting /name.
+   Recordables of iaf_psc_alpha, iaf_psc_delta and iaf_psc_exp are read
+   directly; other properties are read from the status dictionary of each
+   node. Values of nodes not local to this MPI process are NaN.
+
+   Examples:
+   SLI ] /iaf_psc_alpha 3 Create ;
+   SLI ] 1 3 cvgidcollection /V_m GetValues ==
+   <. -70 -70 -70 .>
+
+   SeeAlso: SetValues, GetStatus
+*/
+void
+NestModule::GetValues_g_lFunction::execute( SLIInterpreter* i ) const
+{
+  i->assert_stack_load( 2 );
+
+  const GIDCollectionDatum gids = getValue< GIDCollectionDatum >( i->OStack.pick( 1 ) );
+  const Name name = getValue< Name >( i->OStack.pick( 0 ) );
+
+  DoubleVectorDatum values( new std::vector< double >() );
+  get_node_values( gids, name ).swap( *values );
+
+  i->OStack.pop( 2 );
+  i->OStack.push( values );
+  i->EStack.pop();
+}
+
+/** @BeginDocumentation
+   Name: SetValues - set one property of many nodes from a vector
+
+   Synopsis:
+   gidcollection /name values SetValues -> -
+
+   Parameters:
+   gidcollection - nodes to set
+   /name         - name of a state variable or parameter of type double
+   values        - doublevector or array with one value per node
+
+   Description:
+   SetValues sets the property /name of the i-th node in the collection to
+   the i-th element of values. This is equivalent to, but much faster than,
+   calling SetStatus for each node with a dictionary containing only /name.
+   Nodes not local to this MPI process are skipped.
+
+   Examples:
+   SLI ] /iaf_psc_alpha 3 Create ;
+   SLI ] 1 3 cvgidcollection /V_m [-70.0 -65.0 -60.0] SetValues
+
+   SeeAlso: GetValues, SetStatus
+*/
+void
+NestModule::SetValues_g_l_dvFunction::execute( SLIInterpreter* i ) const
+{
+  i->assert_stack_load( 3 );
+
+  const GIDCollectionDatum gids = getValue< GIDCollectionDatum >( i->OStack.pick( 2 ) );
+  const Name name = getValue< Name >( i->OStack.pick( 1 ) );
+  const DoubleVectorDatum values = getValue< DoubleVectorDatum >( i->OStack.pick( 0 ) );
+
+  set_node_values( gids, name, *values );
+
+  i->OStack.pop( 3 );
+  i->EStack.pop();
+}
+
 /** @BeginDocumentation
   Name: SetDefaults - Set the default values for a node or synapse model.
   Synopsis: /modelname dict SetDefaults -> -
@@ -550,6 +665,93 @@ NestModule::CleanupFunction::execute( SLIInterpreter* i ) const
   i->EStack.pop();
 }
 
+/** @BeginDocumentation
+   Name: SaveCheckpoint - write the state of the simulation to checkpoint files
+
+   Synopsis:
+   prefix SaveCheckpoint -> -
+
+   Parameters:
+   prefix - string, path and prefix of the checkpoint files
+
+   Description:
+   SaveCheckpoint writes the state of the simulation that changes during
+   simulation to the file prefix-<rank>.nestckpt on each MPI process. This
+   comprises the network time, the states of random generators, neurons,
+   devices and synapses, and spikes not yet delivered. The network itself
+   and the data recorded so far are not saved.
+
+   To continue the simulation later, rebuild the network with the same
+   script and the same kernel parameters, call LoadCheckpoint and simulate.
+   The continued simulation yields the same results as if it had not been
+   interrupted.
+
+   Checkpoints are only supported for networks of the neuron models
+   iaf_psc_alpha, iaf_psc_delta, iaf_psc_exp and parrot_neuron, the devices
+   poisson_generator, spike_generator and spike_detector, and the synapse
+   models static_synapse, static_synapse_hom_w, stdp_synapse,
+   stdp_synapse_hom and stdp_pl_synapse_hom. SaveCheckpoint raises a
+   CheckpointError for networks with any other model, and for networks
+   using secondary events or waveform relaxation.
+
+   Checkpoints are binary files and can only be read by the same build of
+   NEST, with the same number of MPI processes and threads.
+
+   Examples:
+   SLI ] 100 Simulate
+   SLI ] (/tmp/run) SaveCheckpoint
+
+   SeeAlso: LoadCheckpoint, Simulate
+*/
+void
+NestModule::SaveCheckpoint_sFunction::execute( SLIInterpreter* i ) const
+{
+  i->assert_stack_load( 1 );
+
+  const std::string prefix = getValue< std::string >( i->OStack.pick( 0 ) );
+  save_checkpoint( prefix );
+
+  i->OStack.pop();
+  i->EStack.pop();
+}
+
+/** @BeginDocumentation
+   Name: LoadCheckpoint - restore the state of the simulation from checkpoint files
+
+   Synopsis:
+   prefix LoadCheckpoint -> -
+
+   Parameters:
+   prefix - string, path and prefix of the checkpoint files
+
+   Description:
+   LoadCheckpoint restores the state written by SaveCheckpoint. The network
+   must have been rebuilt in the same way and with the same kernel
+   parameters, and must not have been simulated yet. A subsequent call to
+   Simulate continues the simulation from the time of the checkpoint.
+
+   LoadCheckpoint raises a CheckpointError if the checkpoint does not match
+   the network. If the error is detected after part of the state has been
+   restored, the kernel is reset and the network must be built again.
+
+   Examples:
+   SLI ] (/tmp/run) LoadCheckpoint
+   SLI ] 100 Simulate
+
+   SeeAlso: SaveCheckpoint, Simulate
+*/
+void
+NestModule::LoadCheckpoint_sFunction::execute( SLIInterpreter* i ) const
+{
+  i->assert_stack_load( 1 );
+
+  const std::string prefix = getValue< std::string >( i->OStack.pick( 0 ) );
+  load_checkpoint( prefix );
+
+  i->OStack.pop();
+  i->EStack.pop();
+}
+
 /** @BeginDocumentation
    Name: CopyModel - copy a model to a new name, set parameters for copy, if
    given
@@ -1690,6 +1892,11 @@ NestModule::init( SLIInterpreter* i )
   i->createcommand( "GetStatus_C", &getstatus_Cfunction );
   i->createcommand( "GetStatus_a", &getstatus_afunction );
 
+  i->createcommand( "TakeEvents_i", &takeevents_ifunction );
+
+  i->createcommand( "GetValues_g_l", &getvalues_g_lfunction );
+  i->createcommand( "SetValues_g_l_dv", &setvalues_g_l_dvfunction );
+
   i->createcommand( "GetConnections_D", &getconnections_Dfunction );
   i->createcommand( "cva_C", &cva_cfunction );
 
@@ -1697,6 +1904,8 @@ NestModule::init( SLIInterpreter* i )
   i->createcommand( "Run_d", &runfunction );
   i->createcommand( "Prepare", &preparefunction );
   i->createcommand( "Cleanup", &cleanupfunction );
+  i->createcommand( "SaveCheckpoint_s", &savecheckpoint_sfunction );
+  i->createcommand( "LoadCheckpoint_s", &loadcheckpoint_sfunction );
 
   i->createcommand( "CopyModel_l_l_D", &copymodel_l_l_Dfunction );
   i->createcommand( "SetDefaults_l_D", &setdefaults_l_Dfunction );
@@ -177,6 +177,12 @@ public:
     void execute( SLIInterpreter* ) const;
   } getstatus_afunction;
 
+  class TakeEvents_iFunction : public SLIFunction
+  {
+  public:
+    void execute( SLIInterpreter* ) const;
+  } takeevents_ifunction;
+
   class SetStatus_idFunction : public SLIFunction
   {
   public:
@@ -201,6 +207,18 @@ public:
     void execute( SLIInterpreter* ) const;
   } setstatus_aafunction;
 
+  class GetValues_g_lFunction : public SLIFunction
+  {
+  public:
+    void execute( SLIInterpreter* ) const;
+  } getvalues_g_lfunction;
+
+  class SetValues_g_l_dvFunction : public SLIFunction
+  {
+  public:
+    void execute( SLIInterpreter* ) const;
+  } setvalues_g_l_dvfunction;
+
   class SetDefaults_l_DFunction : public SLIFunction
   {
   public:
@@ -249,6 +267,18 @@ public:
     void execute( SLIInterpreter* ) const;
   } cleanupfunction;
 
+  class SaveCheckpoint_sFunction : public SLIFunction
+  {
+  public:
+    void execute( SLIInterpreter* ) const;
+  } savecheckpoint_sfunction;
+
+  class LoadCheckpoint_sFunction : public SLIFunction
+  {
+  public:
+    void execute( SLIInterpreter* ) const;
+  } loadcheckpoint_sfunction;
+
   class Create_l_iFunction : public SLIFunction
   {
   public:
@@ -201,6 +201,77 @@ Node::set_status_base( const DictionaryDatum& dict )
   updateValue< bool >( dict, names::frozen, frozen_ );
 }
 
+/**
+ * Default implementation of save_state() and load_state() just
+ * throws CheckpointError
+ */
+void
+Node::save_state( std::ostream& ) const
+{
+  throw CheckpointError( String::compose( "Model %1 does not support checkpoints.", get_name() ) );
+}
+
+void
+Node::load_state( std::istream& )
+{
+  throw CheckpointError( String::compose( "Model %1 does not support checkpoints.", get_name() ) );
+}
+
+/**
+ * Default implementation of take_events() just
+ * throws RecorderExpected
+ */
+void
+Node::take_events( DictionaryDatum& )
+{
+  throw RecorderExpected( get_name() );
+}
+
+void
+Node::get_values( const Name& name,
+  std::vector< Node* >::const_iterator first,
+  std::vector< Node* >::const_iterator last,
+  double* values ) const
+{
+  for ( ; first != last; ++first, ++values )
+  {
+    DictionaryDatum d = ( *first )->get_status_base();
+    *values = getValue< double >( d, name );
+  }
+}
+
+void
+Node::set_values( const Name& name,
+  std::vector< Node* >::const_iterator first,
+  std::vector< Node* >::const_iterator last,
+  const double* values )
+{
+  // one dictionary is reused for all nodes; set_status() clears its
+  // access flags for each node
+  DictionaryDatum d( new Dictionary );
+  for ( ; first != last; ++first, ++values )
+  {
+    ( *d )[ name ] = *values;
+    kernel().node_manager.set_status( ( *first )->get_gid(), d );
+  }
+}
+
+void
+Node::update_batch( std::vector< Node* >::const_iterator first,
+  std::vector< Node* >::const_iterator last,
+  Time const& origin,
+  const long from,
+  const long to )
+{
+  for ( ; first != last; ++first )
+  {
+    if ( not( *first )->is_frozen() )
+    {
+      ( *first )->update( origin, from, to );
+    }
+  }
+}
+
 /**
  * Default implementation of wfr_update just
  * throws UnexpectedEvent
@@ -230,6 +301,16 @@ Node::register_stdp_connection( double, double )
   throw IllegalConnection();
 }
 
+/**
+ * Default implementation of reregister_stdp_connection() just
+ * throws IllegalConnection
+ */
+void
+Node::reregister_stdp_connection( double, double, double )
+{
+  throw IllegalConnection();
+}
+
 /**
  * Default implementation of event handlers just throws
  * an UnexpectedEvent exception.
@@ -26,6 +26,7 @@
 // C++ includes:
 #include <bitset>
 #include <deque>
+#include <iosfwd>
 #include <sstream>
 #include <string>
 #include <utility>
@@ -159,6 +160,14 @@ public:
 
   virtual bool is_off_grid() const;
 
+  /**
+   * Returns true if copies of the node can be constructed concurrently
+   * by several threads. This is not the case if the copy constructor
+   * creates or shares Datums, whose memory pool and reference counts
+   * are not thread safe. Nodes of models without thread safe copies are
+   * created one at a time.
+   */
+  virtual bool has_thread_safe_copy() const;
 
   /**
    * Returns true if the node is a proxy node. This is implemented because
@@ -319,6 +328,29 @@ public:
    */
   virtual void update( Time const&, const long, const long ) = 0;
 
+  /**
+   * Bring a batch of nodes from state $t$ to $t+n*dt$.
+   *
+   * Called on the first node of a batch instead of update() if the kernel
+   * property batch_node_update is set. The nodes in [first, last) are
+   * local to the calling thread, have the same model as this node, and
+   * must be updated as if update() was called on each node that is not
+   * frozen, in this order. The default implementation does exactly this.
+   * Models can override it to update a batch in a single pass over
+   * contiguous state arrays.
+   *
+   * @param first  first node of the batch
+   * @param last   end of the batch
+   * @param Time   network time at beginning of time slice.
+   * @param long initial step inside time slice
+   * @param long post-final step inside time slice
+   */
+  virtual void update_batch( std::vector< Node* >::const_iterator first,
+    std::vector< Node* >::const_iterator last,
+    Time const&,
+    const long,
+    const long );
+
   /**
    * Bring the node from state $t$ to $t+n*dt$, sends SecondaryEvents
    * (e.g. GapJunctionEvent) and resets state variables to values at $t$.
@@ -369,6 +401,78 @@ public:
    */
   virtual void get_status( DictionaryDatum& ) const = 0;
 
+  /**
+   * Store a numeric state variable or parameter of a batch of nodes.
+   *
+   * Called on the first node of a batch by NodeManager::get_values(). The
+   * nodes in [first, last) have the same model as this node. Their values
+   * are stored in this order. The default implementation reads each value
+   * from the status dictionary of the node. Models can override it to read
+   * recordables directly through RecordablesMap::get_values().
+   *
+   * @param name   name of the state variable or parameter
+   * @param first  first node of the batch
+   * @param last   end of the batch
+   * @param values array with one element per node
+   * @throws UndefinedName if the model has no such property
+   * @throws TypeMismatch if the property is not of type double
+   * @ingroup status_interface
+   */
+  virtual void get_values( const Name& name,
+    std::vector< Node* >::const_iterator first,
+    std::vector< Node* >::const_iterator last,
+    double* values ) const;
+
+  /**
+   * Set a numeric state variable or parameter of a batch of nodes.
+   *
+   * Called on the first node of a batch by NodeManager::set_values(). The
+   * nodes in [first, last) have the same model as this node and are set
+   * to the values in this order. The default implementation sets each
+   * node through a status dictionary holding only the given property.
+   * Models can override it to set state variables directly that are not
+   * subject to constraints.
+   *
+   * @param name   name of the state variable or parameter
+   * @param first  first node of the batch
+   * @param last   end of the batch
+   * @param values array with one element per node
+   * @throws UnaccessedDictionaryEntry if the model has no such property
+   * @ingroup status_interface
+   */
+  virtual void set_values( const Name& name,
+    std::vector< Node* >::const_iterator first,
+    std::vector< Node* >::const_iterator last,
+    const double* values );
+
+  /**
+   * Write the dynamic state of the node to a checkpoint.
+   * Models supporting checkpoints write their parameters, state
+   * variables and input buffers, so that a node in the same network
+   * continues bitwise identically after load_state(). Internal variables
+   * are recomputed by calibrate() and need not be written.
+   * @throws CheckpointError if the model does not support checkpoints
+   * @see KernelManager::save_checkpoint()
+   */
+  virtual void save_state( std::ostream& ) const;
+
+  /**
+   * Restore the dynamic state written by save_state().
+   * @throws CheckpointError if the model does not support checkpoints
+   */
+  virtual void load_state( std::istream& );
+
+  /**
+   * Hand the events recorded by the node over to the caller.
+   * Recording devices add their events to the given dictionary, moving
+   * them without copying where possible, and erase them, so that each
+   * event is returned only once. The device on thread 0 also takes the
+   * events of its siblings on other threads.
+   * @throws RecorderExpected if the model does not record events
+   * @see RecordingDevice::take_events()
+   */
+  virtual void take_events( DictionaryDatum& );
+
 public:
   /**
    * @defgroup event_interface Communication.
@@ -474,6 +578,15 @@ public:
    */
   virtual void register_stdp_connection( double, double );
 
+  /**
+   * Move a registered STDP connection whose delay has changed in the
+   * spike history
+   *
+   * @throws IllegalConnection
+   *
+   */
+  virtual void reregister_stdp_connection( double, double, double );
+
   /**
    * Handle incoming spike events.
    * @param thrd Id of the calling thread.
@@ -983,6 +1096,12 @@ Node::is_off_grid() const
   return false;
 }
 
+inline bool
+Node::has_thread_safe_copy() const
+{
+  return true;
+}
+
 inline bool
 Node::is_proxy() const
 {
@@ -23,9 +23,11 @@
 #include "node_manager.h"
 
 // C++ includes:
+#include <limits>
 #include <set>
 
 // Includes from libnestutil:
+#include "binary_io.h"
 #include "compose.hpp"
 #include "logging.h"
 
@@ -55,6 +57,8 @@ NodeManager::NodeManager()
   , nodes_vec_()
   , wfr_nodes_vec_()
   , wfr_is_used_( false )
+  , node_batches_vec_()
+  , batch_buffers_vec_()
   , nodes_vec_network_size_( 0 ) // zero to force update
   , have_nodes_changed_( true )
 {
@@ -180,6 +184,19 @@ NodeManager::get_status( index idx )
   return d;
 }
 
+DictionaryDatum
+NodeManager::take_events( index idx )
+{
+  assert( idx != 0 );
+  Node* target = get_node( idx );
+  assert( target != 0 );
+
+  DictionaryDatum events( new Dictionary );
+  target->take_events( events );
+
+  return events;
+}
+
 index NodeManager::add_node( index mod, long n ) // no_p
 {
   have_nodes_changed_ = true;
@@ -241,61 +258,123 @@ index NodeManager::add_node( index mod, long n ) // no_p
     //       are for subnets and devices.
     local_nodes_.reserve(
       std::ceil( static_cast< double >( max_gid ) / kernel().mpi_manager.get_num_processes() ) + 50 );
-    for ( thread tid = 0; tid < n_threads; ++tid )
-    {
-      // Model::reserve() reserves memory for n ADDITIONAL nodes on thread t
-      // reserves at least one entry on each thread, nobody knows why
-      model->reserve_additional( tid, n_per_thread );
-    }
 
-    size_t gid;
+    // min_gid is first valid gid i should create, hence ask for the first local
+    // gid after min_gid-1
+    index first_local_gid;
     if ( kernel().vp_manager.is_local_vp( kernel().vp_manager.suggest_vp_for_gid( min_gid ) ) )
     {
-      gid = min_gid;
+      first_local_gid = min_gid;
     }
     else
     {
-      gid = next_local_gid_( min_gid );
+      first_local_gid = next_local_gid_( min_gid );
     }
-    size_t next_lid = current_->global_size() + gid - min_gid;
-    // The next loop will not visit every node, if more than one rank is
-    // present.
+    const size_t first_lid = current_->global_size() + first_local_gid - min_gid;
+
+    // Local gids are num_processes apart. Among them, gids are assigned
+    // round-robin to threads, so that the local gids of one thread are
+    // n_threads local gids apart.
+    const size_t num_processes = kernel().mpi_manager.get_num_processes();
+    const size_t num_local_nodes =
+      first_local_gid < max_gid ? ( max_gid - 1 - first_local_gid ) / num_processes + 1 : 0;
+    std::vector< Node* > new_nodes( num_local_nodes, 0 );
+
+    std::vector< lockPTR< WrappedThreadException > > exceptions_raised( n_threads );
+
+    // Each thread creates its own nodes from its own memory pool, so that
+    // the memory of a node is first touched by the thread updating it.
+    // Nodes whose copy constructor is not thread safe are still created
+    // by their own thread, but one at a time.
+    const bool thread_safe_copy = model->has_thread_safe_copy();
+#ifdef _OPENMP
+#pragma omp parallel
+    {
+      const thread tid = kernel().vp_manager.get_thread_id();
+#else
+    for ( thread tid = 0; tid < n_threads; ++tid )
+    {
+#endif
+      // We create nodes in a parallel region. Therefore, we need to catch
+      // exceptions here and then handle them after the parallel region.
+      try
+      {
+        // Model::reserve() reserves memory for n ADDITIONAL nodes on thread t
+        // reserves at least one entry on each thread, nobody knows why
+        model->reserve_additional( tid, n_per_thread );
+
+        // find the first local gid of this thread
+        size_t i = 0;
+        while ( i < num_local_nodes
+          and kernel().vp_manager.vp_to_thread(
+                kernel().vp_manager.suggest_vp_for_gid( first_local_gid + i * num_processes ) ) != tid )
+        {
+          ++i;
+        }
+        assert( i == num_local_nodes or i < static_cast< size_t >( n_threads ) );
+
+        for ( ; i < num_local_nodes; i += n_threads )
+        {
+          const index node_gid = first_local_gid + i * num_processes;
+          const thread vp = kernel().vp_manager.suggest_vp_for_gid( node_gid );
+          assert( kernel().vp_manager.vp_to_thread( vp ) == tid );
+
+          Node* newnode;
+          if ( thread_safe_copy )
+          {
+            newnode = model->allocate( tid );
+          }
+          else
+          {
+#pragma omp critical( add_node )
+            {
+              newnode = model->allocate( tid );
+            }
+          }
+          newnode->set_gid_( node_gid );
+          newnode->set_model_id( mod );
+          newnode->set_thread( tid );
+          newnode->set_vp( vp );
+
+          new_nodes[ i ] = newnode;
+        }
+      }
+      catch ( std::exception& e )
+      {
+        // so throw the exception after parallel region
+        exceptions_raised.at( tid ) = lockPTR< WrappedThreadException >( new WrappedThreadException( e ) );
+      }
+    } // end of parallel section / end of for threads
+
+    // check if any exceptions have been raised
+    for ( thread tid = 0; tid < n_threads; ++tid )
+    {
+      if ( exceptions_raised.at( tid ).valid() )
+      {
+        throw WrappedThreadException( *( exceptions_raised.at( tid ) ) );
+      }
+    }
+
     // Since we already know what range of gids will be created, we can tell the
     // current subnet the range and subsequent calls to
     // `current_->add_remote_node()`
     // become irrelevant.
     current_->add_gid_range( min_gid, max_gid - 1 );
 
-    // min_gid is first valid gid i should create, hence ask for the first local
-    // gid after min_gid-1
-    while ( gid < max_gid )
+    // Register the new nodes in order of increasing gid, as required by
+    // local_nodes_.
+    for ( size_t i = 0; i < num_local_nodes; ++i )
     {
-      const thread vp = kernel().vp_manager.suggest_vp_for_gid( gid );
-      const thread t = kernel().vp_manager.vp_to_thread( vp );
+      Node* newnode = new_nodes[ i ];
+      assert( newnode != 0 );
 
-      if ( kernel().vp_manager.is_local_vp( vp ) )
-      {
-        Node* newnode = model->allocate( t );
-        newnode->set_gid_( gid );
-        newnode->set_model_id( mod );
-        newnode->set_thread( t );
-        newnode->set_vp( vp );
-
-        local_nodes_.add_local_node( *newnode ); // put into local nodes list
-        current_->add_node( newnode );           // and into current subnet, thread 0.
-
-        // lid setting is wrong, if a range is set, as the subnet already
-        // assumes,
-        // the nodes are available.
-        newnode->set_lid_( next_lid );
-        const size_t next_gid = next_local_gid_( gid );
-        next_lid += next_gid - gid;
-        gid = next_gid;
-      }
-      else
-      {
-        ++gid; // brutal fix, next_lid has been set in if-branch
-      }
+      local_nodes_.add_local_node( *newnode ); // put into local nodes list
+      current_->add_node( newnode );           // and into current subnet, thread 0.
+
+      // lid setting is wrong, if a range is set, as the subnet already
+      // assumes,
+      // the nodes are available.
+      newnode->set_lid_( first_lid + i * num_processes );
     }
     // if last gid is not on this process, we need to add it as a remote node
     if ( not kernel().vp_manager.is_local_vp( kernel().vp_manager.suggest_vp_for_gid( max_gid - 1 ) ) )
@@ -598,6 +677,9 @@ NodeManager::ensure_valid_thread_local_ids()
       nodes_vec_.resize( kernel().vp_manager.get_num_threads() );
       wfr_nodes_vec_.clear();
       wfr_nodes_vec_.resize( kernel().vp_manager.get_num_threads() );
+      node_batches_vec_.clear();
+      node_batches_vec_.resize( kernel().vp_manager.get_num_threads() );
+      batch_buffers_vec_.resize( kernel().vp_manager.get_num_threads() );
 
       for ( thread tid = 0; tid < kernel().vp_manager.get_num_threads(); ++tid )
       {
@@ -653,6 +735,19 @@ NodeManager::ensure_valid_thread_local_ids()
             }
           }
         }
+
+        // Consecutive nodes of the same model form a batch. Keeping the
+        // order of nodes_vec_ ensures that batched updates emit spikes in
+        // the same order as individual updates.
+        const std::vector< Node* >& nodes = nodes_vec_[ tid ];
+        for ( size_t i = 0; i < nodes.size(); ++i )
+        {
+          if ( i == 0 or nodes[ i ]->get_model_id() != nodes[ i - 1 ]->get_model_id() )
+          {
+            node_batches_vec_[ tid ].push_back( i );
+          }
+        }
+        node_batches_vec_[ tid ].push_back( nodes.size() );
       } // end of for threads
 
       nodes_vec_network_size_ = size();
@@ -919,6 +1014,90 @@ NodeManager::set_status( index gid, const DictionaryDatum& d )
   }
 }
 
+void
+NodeManager::group_local_nodes_by_model_( const GIDCollection& gids,
+  std::vector< std::vector< Node* > >& nodes,
+  std::vector< std::vector< size_t > >& positions )
+{
+  const size_t num_models = kernel().model_manager.get_num_node_models();
+  nodes.assign( num_models, std::vector< Node* >() );
+  positions.assign( num_models, std::vector< size_t >() );
+
+  size_t pos = 0;
+  for ( GIDCollection::const_iterator gid = gids.begin(); gid != gids.end(); ++gid, ++pos )
+  {
+    Node* node = get_node( *gid );
+    if ( not node->is_proxy() )
+    {
+      nodes[ node->get_model_id() ].push_back( node );
+      positions[ node->get_model_id() ].push_back( pos );
+    }
+  }
+}
+
+std::vector< double >
+NodeManager::get_values( const GIDCollection& gids, const Name& name )
+{
+  std::vector< double > values( gids.size(), std::numeric_limits< double >::quiet_NaN() );
+
+  // Gather local nodes by model, so that the value can be read in one
+  // batch per model. Positions map nodes back to the collection.
+  std::vector< std::vector< Node* > > nodes;
+  std::vector< std::vector< size_t > > positions;
+  group_local_nodes_by_model_( gids, nodes, positions );
+
+  std::vector< double > batch_values;
+  for ( size_t model_id = 0; model_id < nodes.size(); ++model_id )
+  {
+    const std::vector< Node* >& batch = nodes[ model_id ];
+    if ( batch.empty() )
+    {
+      continue;
+    }
+
+    batch_values.resize( batch.size() );
+    batch[ 0 ]->get_values( name, batch.begin(), batch.end(), &batch_values[ 0 ] );
+    for ( size_t i = 0; i < batch.size(); ++i )
+    {
+      values[ positions[ model_id ][ i ] ] = batch_values[ i ];
+    }
+  }
+
+  return values;
+}
+
+void
+NodeManager::set_values( const GIDCollection& gids, const Name& name, const std::vector< double >& values )
+{
+  if ( values.size() != gids.size() )
+  {
+    throw DimensionMismatch( gids.size(), values.size() );
+  }
+
+  // Gather local nodes by model, so that the value can be set in one
+  // batch per model.
+  std::vector< std::vector< Node* > > nodes;
+  std::vector< std::vector< size_t > > positions;
+  group_local_nodes_by_model_( gids, nodes, positions );
+
+  std::vector< double > batch_values;
+  for ( size_t model_id = 0; model_id < nodes.size(); ++model_id )
+  {
+    const std::vector< Node* >& batch = nodes[ model_id ];
+    if ( batch.empty() )
+    {
+      continue;
+    }
+
+    batch_values.resize( batch.size() );
+    for ( size_t i = 0; i < batch.size(); ++i )
+    {
+      batch_values[ i ] = values[ positions[ model_id ][ i ] ];
+    }
+    batch[ 0 ]->set_values( name, batch.begin(), batch.end(), &batch_values[ 0 ] );
+  }
+}
+
 void
 NodeManager::get_status( DictionaryDatum& d )
 {
@@ -958,6 +1137,59 @@ NodeManager::set_status( const DictionaryDatum& d )
   }
 }
 
+void
+NodeManager::save_checkpoint( std::ostream& os )
+{
+  ensure_valid_thread_local_ids();
+
+  for ( thread tid = 0; tid < kernel().vp_manager.get_num_threads(); ++tid )
+  {
+    const std::vector< Node* >& nodes = nodes_vec_[ tid ];
+    write_binary( os, nodes.size() );
+    for ( std::vector< Node* >::const_iterator it = nodes.begin(); it != nodes.end(); ++it )
+    {
+      write_binary( os, ( *it )->get_gid() );
+      write_binary( os, ( *it )->get_model_id() );
+      write_binary( os, ( *it )->buffers_initialized() );
+      ( *it )->save_state( os );
+    }
+  }
+}
+
+void
+NodeManager::load_checkpoint( std::istream& is )
+{
+  ensure_valid_thread_local_ids();
+
+  for ( thread tid = 0; tid < kernel().vp_manager.get_num_threads(); ++tid )
+  {
+    const std::vector< Node* >& nodes = nodes_vec_[ tid ];
+    size_t num_nodes = 0;
+    read_binary( is, num_nodes );
+    if ( num_nodes != nodes.size() )
+    {
+      throw CheckpointError( "Number of nodes differs from checkpoint." );
+    }
+    for ( std::vector< Node* >::const_iterator it = nodes.begin(); it != nodes.end(); ++it )
+    {
+      index gid = 0;
+      int model_id = 0;
+      bool buffers_initialized = false;
+      read_binary( is, gid );
+      read_binary( is, model_id );
+      read_binary( is, buffers_initialized );
+      if ( gid != ( *it )->get_gid() or model_id != ( *it )->get_model_id() )
+      {
+        throw CheckpointError( String::compose( "Node %1 differs from checkpoint.", ( *it )->get_gid() ) );
+      }
+      ( *it )->load_state( is );
+
+      // restored buffers must not be initialized again by prepare()
+      ( *it )->set_buffers_initialized( buffers_initialized );
+    }
+  }
+}
+
 void
 NodeManager::reset_nodes_state()
 {
@@ -31,6 +31,7 @@
 
 // Includes from nestkernel:
 #include "conn_builder.h"
+#include "gid_collection.h"
 #include "nest_types.h"
 #include "sparse_node_array.h"
 
@@ -58,6 +59,9 @@ public:
   virtual void set_status( const DictionaryDatum& );
   virtual void get_status( DictionaryDatum& );
 
+  virtual void save_checkpoint( std::ostream& );
+  virtual void load_checkpoint( std::istream& );
+
   void reinit_nodes();
   /**
    * Get properties of a node. The specified node must exist.
@@ -65,6 +69,13 @@ public:
    */
   DictionaryDatum get_status( index );
 
+  /**
+   * Take the events recorded by a node, see Node::take_events().
+   * @throws nest::UnknownNode       Target does not exist in the network.
+   * @throws nest::RecorderExpected  Target does not record events.
+   */
+  DictionaryDatum take_events( index );
+
   /**
    * Set properties of a Node. The specified node must exist.
    * @throws nest::UnknownNode Target does not exist in the network.
@@ -74,6 +85,27 @@ public:
    */
   void set_status( index, const DictionaryDatum& );
 
+  /**
+   * Get a numeric state variable or parameter of nodes.
+   * The local nodes are read in one batch per model, see
+   * Node::get_values(). The values of nodes that are not local to this
+   * process are NaN.
+   * @returns vector with one value per node in the collection
+   * @throws nest::UnknownNode  A node does not exist in the network.
+   */
+  std::vector< double > get_values( const GIDCollection&, const Name& );
+
+  /**
+   * Set a numeric state variable or parameter of nodes, one value per
+   * node in the collection. The local nodes are set in one batch per
+   * model, see Node::set_values(). Nodes that are not local to this
+   * process are skipped.
+   * @throws DimensionMismatch  The number of values differs from the
+   *                            number of nodes.
+   * @throws nest::UnaccessedDictionaryEntry  A node has no such property.
+   */
+  void set_values( const GIDCollection&, const Name&, const std::vector< double >& );
+
   /**
    * Add a number of nodes to the network.
    * This function creates n Node objects of Model m and adds them
@@ -191,6 +223,21 @@ public:
    */
   const std::vector< Node* >& get_wfr_nodes_on_thread( thread ) const;
 
+  /**
+   * Get the boundaries of the batches of nodes on given thread.
+   * Batch i consists of the nodes get_nodes_on_thread( t )[ b[ i ] ]
+   * up to, but excluding, get_nodes_on_thread( t )[ b[ i + 1 ] ], which
+   * all have the same model. The last entry is the number of nodes.
+   */
+  const std::vector< size_t >& get_node_batches_on_thread( thread ) const;
+
+  /**
+   * Get a buffer for the batched update of nodes on given thread, see
+   * Node::update_batch(). The buffer is kept across updates, so that
+   * batched updates do not need to allocate memory in every time slice.
+   */
+  std::vector< double >& get_batch_buffer( thread );
+
   /**
    * Prepare nodes for simulation and register nodes in node_list.
    * Calls prepare_node_() for each pertaining Node.
@@ -265,6 +312,15 @@ private:
    */
   void set_status_single_node_( Node&, const DictionaryDatum&, bool clear_flags = true );
 
+  /**
+   * Sort the local nodes of a collection by model id. Nodes of model m
+   * are stored in nodes[ m ], their positions in the collection in
+   * positions[ m ].
+   */
+  void group_local_nodes_by_model_( const GIDCollection&,
+    std::vector< std::vector< Node* > >& nodes,
+    std::vector< std::vector< size_t > >& positions );
+
   /**
    * Initialized buffers, register in list of nodes to update/finalize.
    * @see prepare_nodes_()
@@ -301,6 +357,13 @@ private:
                                                       //!< use the waveform relaxation method
   bool wfr_is_used_;                                  //!< there is at least one node that uses
                                                       //!< waveform relaxation
+
+  //! Batch boundaries in nodes_vec_, see get_node_batches_on_thread()
+  std::vector< std::vector< size_t > > node_batches_vec_;
+
+  //! Buffers for batched updates, see get_batch_buffer()
+  std::vector< std::vector< double > > batch_buffers_vec_;
+
   //! Network size when nodes_vec_ was last updated
   index nodes_vec_network_size_;
   size_t num_active_nodes_; //!< number of nodes created by prepare_nodes
@@ -353,6 +416,18 @@ NodeManager::get_wfr_nodes_on_thread( thread t ) const
   return wfr_nodes_vec_.at( t );
 }
 
+inline const std::vector< size_t >&
+NodeManager::get_node_batches_on_thread( thread t ) const
+{
+  return node_batches_vec_.at( t );
+}
+
+inline std::vector< double >&
+NodeManager::get_batch_buffer( thread t )
+{
+  return batch_buffers_vec_.at( t );
+}
+
 inline bool
 NodeManager::wfr_is_used() const
 {
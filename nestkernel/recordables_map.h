@@ -28,6 +28,7 @@
 #include <map>
 #include <string>
 #include <utility>
+#include <vector>
 
 // Includes from nestkernel:
 #include "nest_types.h"
@@ -38,6 +39,8 @@
 
 namespace nest
 {
+class Node;
+
 /**
  * Map names of recordables to data access functions.
  *
@@ -101,6 +104,36 @@ public:
     // return recordables_;
   }
 
+  /**
+   * Store the value of a recordable for a batch of nodes.
+   * The access function is looked up once for the batch.
+   * @param n name of the recordable
+   * @param first first node of the batch, must be of type HostNode
+   * @param last end of the batch
+   * @param values array with one element per node
+   * @returns false if there is no recordable n, true otherwise
+   * @see Node::get_values()
+   */
+  bool
+  get_values( const Name& n,
+    std::vector< Node* >::const_iterator first,
+    std::vector< Node* >::const_iterator last,
+    double* values ) const
+  {
+    typename Base_::const_iterator it = this->find( n );
+    if ( it == this->end() )
+    {
+      return false;
+    }
+
+    const DataAccessFct f = it->second;
+    for ( ; first != last; ++first, ++values )
+    {
+      *values = ( static_cast< const HostNode* >( *first )->*f )();
+    }
+    return true;
+  }
+
 private:
   //! Insertion functions to be used in create(), adds entry to map and list
   void
@@ -45,6 +45,26 @@
 #include "iostreamdatum.h"
 #include "sliexceptions.h"
 
+namespace
+{
+// Append events kept by the device to a property of the events dictionary.
+template < typename T >
+void
+add_events( DictionaryDatum& d, Name propname, const std::vector< T >& events )
+{
+  append_property( d, propname, events );
+}
+
+// Move events taken from the device to a property of the events dictionary,
+// which saves copying them for the first thread.
+template < typename T >
+void
+add_events( DictionaryDatum& d, Name propname, std::vector< T >& events )
+{
+  move_property( d, propname, events );
+}
+}
+
 /* ----------------------------------------------------------------
  * Default constructors defining default parameters and state
  * ---------------------------------------------------------------- */
@@ -60,6 +80,7 @@ nest::RecordingDevice::Parameters_::Parameters_( const std::string& file_ext,
   , to_screen_( false )
   , to_memory_( true )
   , to_accumulator_( false )
+  , to_binary_file_( false )
   , time_in_steps_( false )
   , precise_times_( false )
   , withgid_( withgid )
@@ -82,6 +103,7 @@ nest::RecordingDevice::Parameters_::Parameters_( const std::string& file_ext,
   , flush_records_( false )
   , close_on_reset_( true )
   , use_gid_in_filename_( true )
+  , binary_filename_()
 {
 }
 
@@ -124,6 +146,7 @@ nest::RecordingDevice::Parameters_::get( const RecordingDevice& rd, DictionaryDa
   ( *d )[ names::to_screen ] = to_screen_;
   ( *d )[ names::to_memory ] = to_memory_;
   ( *d )[ names::to_file ] = to_file_;
+  ( *d )[ names::to_binary_file ] = to_binary_file_;
   if ( rd.mode_ == RecordingDevice::MULTIMETER )
   {
     ( *d )[ names::to_accumulator ] = to_accumulator_;
@@ -133,6 +156,10 @@ nest::RecordingDevice::Parameters_::get( const RecordingDevice& rd, DictionaryDa
   {
     ad.push_back( LiteralDatum( names::file ) );
   }
+  if ( to_binary_file_ )
+  {
+    ad.push_back( LiteralDatum( names::binary_file ) );
+  }
   if ( to_memory_ )
   {
     ad.push_back( LiteralDatum( names::memory ) );
@@ -169,6 +196,11 @@ nest::RecordingDevice::Parameters_::get( const RecordingDevice& rd, DictionaryDa
     initialize_property_array( d, names::filenames );
     append_property( d, names::filenames, filename_ );
   }
+  if ( to_binary_file_ and not binary_filename_.empty() )
+  {
+    initialize_property_array( d, names::filenames );
+    append_property( d, names::filenames, binary_filename_ );
+  }
 }
 
 void
@@ -233,6 +265,7 @@ nest::RecordingDevice::Parameters_::set( const RecordingDevice& rd, Buffers_& B,
   rec_change = updateValue< bool >( d, names::to_screen, to_screen_ ) or rec_change;
   rec_change = updateValue< bool >( d, names::to_memory, to_memory_ ) or rec_change;
   rec_change = updateValue< bool >( d, names::to_file, to_file_ ) or rec_change;
+  rec_change = updateValue< bool >( d, names::to_binary_file, to_binary_file_ ) or rec_change;
   if ( rd.mode_ == RecordingDevice::MULTIMETER )
   {
     rec_change = updateValue< bool >( d, names::to_accumulator, to_accumulator_ ) or rec_change;
@@ -242,7 +275,7 @@ nest::RecordingDevice::Parameters_::set( const RecordingDevice& rd, Buffers_& B,
   if ( have_record_to )
   {
     // clear all flags
-    to_file_ = to_screen_ = to_memory_ = to_accumulator_ = false;
+    to_file_ = to_binary_file_ = to_screen_ = to_memory_ = to_accumulator_ = false;
 
     // check for flags present in array, could be far more elegant ...
     ArrayDatum ad = getValue< ArrayDatum >( d, names::record_to );
@@ -252,6 +285,10 @@ nest::RecordingDevice::Parameters_::set( const RecordingDevice& rd, Buffers_& B,
       {
         to_file_ = true;
       }
+      else if ( *t == LiteralDatum( names::binary_file ) or *t == Token( names::binary_file.toString() ) )
+      {
+        to_binary_file_ = true;
+      }
       else if ( *t == LiteralDatum( names::memory ) or *t == Token( names::memory.toString() ) )
       {
         to_memory_ = true;
@@ -270,14 +307,14 @@ nest::RecordingDevice::Parameters_::set( const RecordingDevice& rd, Buffers_& B,
         if ( rd.mode_ == RecordingDevice::MULTIMETER )
         {
           throw BadProperty(
-            "/to_record must be array, allowed entries: /file, /memory, "
-            "/screen, /accumulator." );
+            "/to_record must be array, allowed entries: /file, /binary_file, "
+            "/memory, /screen, /accumulator." );
         }
         else
         {
           throw BadProperty(
-            "/to_record must be array, allowed entries: /file, /memory, "
-            "/screen." );
+            "/to_record must be array, allowed entries: /file, /binary_file, "
+            "/memory, /screen." );
         }
       }
     }
@@ -288,13 +325,13 @@ nest::RecordingDevice::Parameters_::set( const RecordingDevice& rd, Buffers_& B,
     LOG( M_INFO, "RecordingDevice::set_status", "Data will be recorded to file and to memory." );
   }
 
-  if ( to_accumulator_ and ( to_file_ or to_screen_ or to_memory_ or withgid_ or withweight_ ) )
+  if ( to_accumulator_ and ( to_file_ or to_binary_file_ or to_screen_ or to_memory_ or withgid_ or withweight_ ) )
   {
-    to_file_ = to_screen_ = to_memory_ = withgid_ = withweight_ = false;
+    to_file_ = to_binary_file_ = to_screen_ = to_memory_ = withgid_ = withweight_ = false;
     LOG( M_WARNING,
       "RecordingDevice::set_status()",
       "Accumulator mode selected. All incompatible properties "
-      "(to_file, to_screen, to_memory, withgid, withweight) "
+      "(to_file, to_binary_file, to_screen, to_memory, withgid, withweight) "
       "have been set to false." );
   }
 
@@ -308,113 +345,127 @@ nest::RecordingDevice::Parameters_::set( const RecordingDevice& rd, Buffers_& B,
   }
 }
 
+template < typename StateT >
 void
-nest::RecordingDevice::State_::get( DictionaryDatum& d, const Parameters_& p ) const
+nest::RecordingDevice::State_::get_events_( StateT& s, DictionaryDatum& events, const Parameters_& p )
 {
-  // if we already have the n_events entry, we add to it, otherwise we create it
-  if ( d->known( names::n_events ) )
-  {
-    ( *d )[ names::n_events ] = getValue< long >( d, names::n_events ) + events_;
-  }
-  else
-  {
-    ( *d )[ names::n_events ] = events_;
-  }
-
-  DictionaryDatum dict;
-
-  // if we already have the events dict, we use it, otherwise we create it
-  if ( not d->known( names::events ) )
-  {
-    dict = DictionaryDatum( new Dictionary );
-  }
-  else
-  {
-    dict = getValue< DictionaryDatum >( d, names::events );
-  }
-
   if ( p.withgid_ )
   {
     assert( not p.to_accumulator_ );
-    initialize_property_intvector( dict, names::senders );
-    append_property( dict, names::senders, std::vector< long >( event_senders_ ) );
+    initialize_property_intvector( events, names::senders );
+    add_events( events, names::senders, s.event_senders_ );
   }
 
   if ( p.withweight_ )
   {
     assert( not p.to_accumulator_ );
-    initialize_property_doublevector( dict, names::weights );
-    append_property( dict, names::weights, std::vector< double >( event_weights_ ) );
+    initialize_property_doublevector( events, names::weights );
+    add_events( events, names::weights, s.event_weights_ );
   }
 
   if ( p.withtargetgid_ )
   {
     assert( not p.to_accumulator_ );
-    initialize_property_intvector( dict, names::targets );
-    append_property( dict, names::targets, std::vector< long >( event_targets_ ) );
+    initialize_property_intvector( events, names::targets );
+    add_events( events, names::targets, s.event_targets_ );
   }
 
   if ( p.withport_ )
   {
     assert( not p.to_accumulator_ );
-    initialize_property_intvector( dict, names::ports );
-    append_property( dict, names::ports, std::vector< long >( event_ports_ ) );
+    initialize_property_intvector( events, names::ports );
+    add_events( events, names::ports, s.event_ports_ );
   }
 
   if ( p.withrport_ )
   {
     assert( not p.to_accumulator_ );
-    initialize_property_intvector( dict, names::rports );
-    append_property( dict, names::rports, std::vector< long >( event_rports_ ) );
+    initialize_property_intvector( events, names::rports );
+    add_events( events, names::rports, s.event_rports_ );
   }
 
   if ( p.withtime_ )
   {
     if ( p.time_in_steps_ )
     {
-      initialize_property_intvector( dict, names::times );
+      initialize_property_intvector( events, names::times );
       // When not accumulating, we just add time data. When accumulating, we
       // must add time data only from one thread and ensure that time data from
       // other threads is either empty of identical to what is present.
       if ( not p.to_accumulator_ )
       {
-        append_property( dict, names::times, std::vector< long >( event_times_steps_ ) );
+        add_events( events, names::times, s.event_times_steps_ );
       }
       else
       {
-        provide_property( dict, names::times, std::vector< long >( event_times_steps_ ) );
+        provide_property( events, names::times, s.event_times_steps_ );
       }
 
       if ( p.precise_times_ )
       {
-        initialize_property_doublevector( dict, names::offsets );
+        initialize_property_doublevector( events, names::offsets );
         if ( not p.to_accumulator_ )
         {
-          append_property( dict, names::offsets, std::vector< double >( event_times_offsets_ ) );
+          add_events( events, names::offsets, s.event_times_offsets_ );
         }
         else
         {
-          provide_property( dict, names::offsets, std::vector< double >( event_times_offsets_ ) );
+          provide_property( events, names::offsets, s.event_times_offsets_ );
         }
       }
     }
     else
     {
-      initialize_property_doublevector( dict, names::times );
+      initialize_property_doublevector( events, names::times );
       if ( not p.to_accumulator_ )
       {
-        append_property( dict, names::times, std::vector< double >( event_times_ms_ ) );
+        add_events( events, names::times, s.event_times_ms_ );
       }
       else
       {
-        provide_property( dict, names::times, std::vector< double >( event_times_ms_ ) );
+        provide_property( events, names::times, s.event_times_ms_ );
       }
     }
   }
+}
+
+void
+nest::RecordingDevice::State_::get( DictionaryDatum& d, const Parameters_& p ) const
+{
+  // if we already have the n_events entry, we add to it, otherwise we create it
+  if ( d->known( names::n_events ) )
+  {
+    ( *d )[ names::n_events ] = getValue< long >( d, names::n_events ) + events_;
+  }
+  else
+  {
+    ( *d )[ names::n_events ] = events_;
+  }
+
+  DictionaryDatum dict;
+
+  // if we already have the events dict, we use it, otherwise we create it
+  if ( not d->known( names::events ) )
+  {
+    dict = DictionaryDatum( new Dictionary );
+  }
+  else
+  {
+    dict = getValue< DictionaryDatum >( d, names::events );
+  }
+
+  get_events_( *this, dict, p );
 
   ( *d )[ names::events ] = dict;
 }
 
+void
+nest::RecordingDevice::State_::take( DictionaryDatum& events, const Parameters_& p )
+{
+  get_events_( *this, events, p );
+  clear_events();
+}
+
 void
 nest::RecordingDevice::State_::set( const DictionaryDatum& d )
 {
@@ -436,6 +487,13 @@ nest::RecordingDevice::Buffers_::Buffers_()
   : fs_()
   , fbuffer_( 0 )
   , fbuffer_size_( -1 )
+  , bfs_()
+  , brecord_()
+  , bfs_columns_()
+  , value_names_()
+  , async_( false )
+  , fs_pending_()
+  , bfs_pending_()
 {
 }
 
@@ -513,6 +571,11 @@ nest::RecordingDevice::init_buffers()
     B_.fs_.close();
     P_.filename_.clear(); // filename_ only visible while file open
   }
+  if ( P_.close_on_reset_ and B_.bfs_.is_open() )
+  {
+    B_.bfs_.close();
+    P_.binary_filename_.clear();
+  }
 }
 
 void
@@ -520,6 +583,21 @@ nest::RecordingDevice::calibrate()
 {
   Device::calibrate();
 
+  // output for the asynchronous writer is handed over in post_run_cleanup(),
+  // anything left here stems from an interrupted simulation; the IOManager
+  // has drained the writer, so we can write it directly
+  if ( B_.fs_.is_open() )
+  {
+    B_.fs_ << B_.fs_pending_.str();
+  }
+  B_.fs_pending_.str( std::string() );
+  if ( B_.bfs_.is_open() )
+  {
+    B_.bfs_.write( B_.bfs_pending_.data(), B_.bfs_pending_.size() );
+  }
+  B_.bfs_pending_.clear();
+  B_.async_ = kernel().io_manager.async_recording();
+
   if ( P_.to_file_ )
   {
     // do we need to (re-)open the file
@@ -579,63 +657,7 @@ nest::RecordingDevice::calibrate()
         }
       }
 
-      if ( kernel().io_manager.overwrite_files() )
-      {
-        if ( P_.binary_ )
-        {
-          B_.fs_.open( P_.filename_.c_str(), std::ios::out | std::ios::binary );
-        }
-        else
-        {
-          B_.fs_.open( P_.filename_.c_str() );
-        }
-      }
-      else
-      {
-        // try opening for reading
-        std::ifstream test( P_.filename_.c_str() );
-        if ( test.good() )
-        {
-          std::string msg = String::compose(
-            "The device file '%1' exists already and will not be overwritten. "
-            "Please change data_path, data_prefix or label, or set "
-            "/overwrite_files to true in the root node.",
-            P_.filename_ );
-          LOG( M_ERROR, "RecordingDevice::calibrate()", msg );
-          throw IOError();
-        }
-        else
-        {
-          test.close();
-        }
-
-        // file does not exist, so we can open
-        if ( P_.binary_ )
-        {
-          B_.fs_.open( P_.filename_.c_str(), std::ios::out | std::ios::binary );
-        }
-        else
-        {
-          B_.fs_.open( P_.filename_.c_str() );
-        }
-      }
-    }
-
-    if ( not B_.fs_.good() )
-    {
-      std::string msg = String::compose(
-        "I/O error while opening file '%1'. "
-        "This may be caused by too many open files in networks "
-        "with many recording devices and threads.",
-        P_.filename_ );
-      LOG( M_ERROR, "RecordingDevice::calibrate()", msg );
-
-      if ( B_.fs_.is_open() )
-      {
-        B_.fs_.close();
-      }
-      P_.filename_.clear();
-      throw IOError();
+      open_file_( B_.fs_, P_.filename_, P_.binary_ ? std::ios::out | std::ios::binary : std::ios::out );
     }
 
     /* Set formatting
@@ -646,33 +668,126 @@ nest::RecordingDevice::calibrate()
     if ( P_.scientific_ )
     {
       B_.fs_ << std::scientific;
+      B_.fs_pending_ << std::scientific;
     }
     else
     {
       B_.fs_ << std::fixed;
+      B_.fs_pending_ << std::fixed;
     }
 
     B_.fs_ << std::setprecision( P_.precision_ );
+    B_.fs_pending_ << std::setprecision( P_.precision_ );
+  }
+
+  if ( P_.to_binary_file_ )
+  {
+    const std::string newname = build_filename_() + ".bin";
+    if ( B_.bfs_.is_open() and ( newname != P_.binary_filename_ or binary_columns_( P_ ) != B_.bfs_columns_ ) )
+    {
+      std::string msg = String::compose( "Closing file '%1', opening file '%2'", P_.binary_filename_, newname );
+      LOG( M_INFO, "RecordingDevice::calibrate()", msg );
+
+      B_.bfs_.close();
+    }
+
+    if ( not B_.bfs_.is_open() )
+    {
+      P_.binary_filename_ = newname;
+      open_file_( B_.bfs_, P_.binary_filename_, std::ios::out | std::ios::binary );
+      B_.bfs_columns_ = binary_columns_( P_ );
+      write_binary_header_();
+    }
   }
 }
 
 void
-nest::RecordingDevice::post_run_cleanup()
+nest::RecordingDevice::open_file_( std::ofstream& fs, std::string& filename, std::ios::openmode mode )
 {
-  if ( B_.fs_.is_open() )
+  assert( not fs.is_open() );
+
+  if ( not kernel().io_manager.overwrite_files() )
   {
-    if ( P_.flush_after_simulate_ )
+    // try opening for reading
+    std::ifstream test( filename.c_str() );
+    if ( test.good() )
     {
-      B_.fs_.flush();
+      std::string msg = String::compose(
+        "The device file '%1' exists already and will not be overwritten. "
+        "Please change data_path, data_prefix or label, or set "
+        "/overwrite_files to true in the root node.",
+        filename );
+      LOG( M_ERROR, "RecordingDevice::calibrate()", msg );
+      throw IOError();
+    }
+    else
+    {
+      test.close();
     }
+  }
+
+  // file does not exist or may be overwritten, so we can open
+  fs.open( filename.c_str(), mode );
 
-    if ( not B_.fs_.good() )
+  if ( not fs.good() )
+  {
+    std::string msg = String::compose(
+      "I/O error while opening file '%1'. "
+      "This may be caused by too many open files in networks "
+      "with many recording devices and threads.",
+      filename );
+    LOG( M_ERROR, "RecordingDevice::calibrate()", msg );
+
+    if ( fs.is_open() )
     {
-      std::string msg = String::compose( "I/O error while opening file '%1'", P_.filename_ );
-      LOG( M_ERROR, "RecordingDevice::post_run_cleanup()", msg );
+      fs.close();
+    }
+    filename.clear();
+    throw IOError();
+  }
+}
 
-      throw IOError();
+void
+nest::RecordingDevice::flush_file_( std::ofstream& fs, const std::string& filename, const std::string& caller )
+{
+  if ( P_.flush_after_simulate_ )
+  {
+    fs.flush();
+  }
+
+  if ( not fs.good() )
+  {
+    std::string msg = String::compose( "I/O error while opening file '%1'", filename );
+    LOG( M_ERROR, caller, msg );
+
+    throw IOError();
+  }
+}
+
+void
+nest::RecordingDevice::post_run_cleanup()
+{
+  if ( B_.async_ )
+  {
+    // the IOManager waits for the writer and checks for errors
+    if ( B_.fs_.is_open() )
+    {
+      submit_file_output_( P_.flush_after_simulate_ );
+    }
+    if ( B_.bfs_.is_open() )
+    {
+      submit_binary_file_output_( P_.flush_after_simulate_ );
     }
+    return;
+  }
+
+  if ( B_.fs_.is_open() )
+  {
+    flush_file_( B_.fs_, P_.filename_, "RecordingDevice::post_run_cleanup()" );
+  }
+  if ( B_.bfs_.is_open() )
+  {
+    flush_file_( B_.bfs_, P_.binary_filename_, "RecordingDevice::post_run_cleanup()" );
   }
 }
 
@@ -684,19 +799,21 @@ nest::RecordingDevice::finalize()
     if ( P_.close_after_simulate_ )
     {
       B_.fs_.close();
-      return;
     }
-
-    if ( P_.flush_after_simulate_ )
+    else
     {
-      B_.fs_.flush();
+      flush_file_( B_.fs_, P_.filename_, "RecordingDevice::finalize()" );
     }
-    if ( not B_.fs_.good() )
+  }
+  if ( B_.bfs_.is_open() )
+  {
+    if ( P_.close_after_simulate_ )
     {
-      std::string msg = String::compose( "I/O error while opening file '%1'", P_.filename_ );
-      LOG( M_ERROR, "RecordingDevice::finalize()", msg );
-
-      throw IOError();
+      B_.bfs_.close();
+    }
+    else
+    {
+      flush_file_( B_.bfs_, P_.binary_filename_, "RecordingDevice::finalize()" );
     }
   }
 }
@@ -710,6 +827,12 @@ nest::RecordingDevice::set_status( const DictionaryDatum& d )
 {
   Parameters_ ptmp = P_;    // temporary copy in case of errors
   ptmp.set( *this, B_, d ); // throws if BadProperty
+  if ( B_.bfs_.is_open() and ptmp.to_binary_file_ and binary_columns_( ptmp ) != B_.bfs_columns_ )
+  {
+    throw BadProperty(
+      "The columns of an open binary file cannot be changed. "
+      "Turn off recording to binary file first." );
+  }
   State_ stmp = S_;
   stmp.set( d );
 
@@ -729,6 +852,12 @@ nest::RecordingDevice::set_status( const DictionaryDatum& d )
     P_.filename_.clear();
   }
 
+  if ( not P_.to_binary_file_ and B_.bfs_.is_open() )
+  {
+    B_.bfs_.close();
+    P_.binary_filename_.clear();
+  }
+
   if ( S_.events_ == 0 )
   {
     S_.clear_events();
@@ -777,20 +906,55 @@ nest::RecordingDevice::record_event( const Event& event, bool endrecord )
 
   if ( P_.to_file_ )
   {
-    print_id_( B_.fs_, sender );
-    print_target_( B_.fs_, target );
-    print_port_( B_.fs_, port );
-    print_rport_( B_.fs_, rport );
-    print_time_( B_.fs_, stamp, offset );
-    print_weight_( B_.fs_, weight );
+    std::ostream& fs = file_stream_();
+    print_id_( fs, sender );
+    print_target_( fs, target );
+    print_port_( fs, port );
+    print_rport_( fs, rport );
+    print_time_( fs, stamp, offset );
+    print_weight_( fs, weight );
     if ( endrecord )
     {
-      B_.fs_ << '\n';
-      if ( P_.flush_records_ )
+      end_file_record_();
+    }
+  }
+
+  if ( P_.to_binary_file_ )
+  {
+    // the column order must match binary_columns_()
+    B_.brecord_.clear();
+    if ( P_.withgid_ )
+    {
+      pack_binary_( static_cast< int64_t >( sender ) );
+    }
+    if ( P_.withtargetgid_ )
+    {
+      pack_binary_( static_cast< int64_t >( target ) );
+    }
+    if ( P_.withport_ )
+    {
+      pack_binary_( static_cast< int64_t >( port ) );
+    }
+    if ( P_.withrport_ )
+    {
+      pack_binary_( static_cast< int64_t >( rport ) );
+    }
+    if ( P_.withtime_ )
+    {
+      pack_binary_( static_cast< int64_t >( stamp.get_steps() ) );
+      if ( P_.precise_times_ )
       {
-        B_.fs_.flush();
+        pack_binary_( offset );
       }
     }
+    if ( P_.withweight_ )
+    {
+      pack_binary_( weight );
+    }
+    if ( endrecord )
+    {
+      write_binary_record_();
+    }
   }
 
   // storing data when recording to accumulator relies on the fact
@@ -801,6 +965,147 @@ nest::RecordingDevice::record_event( const Event& event, bool endrecord )
   }
 }
 
+void
+nest::RecordingDevice::set_value_names( const std::vector< Name >& value_names )
+{
+  B_.value_names_ = value_names;
+}
+
+std::vector< std::string >
+nest::RecordingDevice::binary_columns_( const Parameters_& p ) const
+{
+  std::vector< std::string > columns;
+  if ( p.withgid_ )
+  {
+    columns.push_back( names::senders.toString() + ":i8" );
+  }
+  if ( p.withtargetgid_ )
+  {
+    columns.push_back( names::targets.toString() + ":i8" );
+  }
+  if ( p.withport_ )
+  {
+    columns.push_back( names::ports.toString() + ":i8" );
+  }
+  if ( p.withrport_ )
+  {
+    columns.push_back( names::rports.toString() + ":i8" );
+  }
+  if ( p.withtime_ )
+  {
+    columns.push_back( "steps:i8" );
+    if ( p.precise_times_ )
+    {
+      columns.push_back( names::offsets.toString() + ":f8" );
+    }
+  }
+  if ( p.withweight_ )
+  {
+    columns.push_back( names::weights.toString() + ":f8" );
+  }
+  for ( size_t i = 0; i < B_.value_names_.size(); ++i )
+  {
+    columns.push_back( B_.value_names_[ i ].toString() + ":f8" );
+  }
+  return columns;
+}
+
+void
+nest::RecordingDevice::write_binary_header_()
+{
+  std::string columns;
+  for ( size_t i = 0; i < B_.bfs_columns_.size(); ++i )
+  {
+    columns += ( i == 0 ? "" : " " ) + B_.bfs_columns_[ i ];
+  }
+
+  // all columns are 8 bytes wide; the header is padded to a multiple of 8
+  // bytes, so that the records are aligned if the file is mapped to memory
+  const uint64_t fixed_size = 56;
+  const uint64_t header_size = ( fixed_size + columns.size() + 1 + 7 ) / 8 * 8;
+  const uint64_t record_size = 8 * B_.bfs_columns_.size();
+
+  B_.brecord_.clear();
+  const char magic[ 8 ] = { 'N', 'E', 'S', 'T', 'B', 'I', 'N', '\0' };
+  B_.brecord_.insert( B_.brecord_.end(), magic, magic + 8 );
+  pack_binary_( static_cast< uint32_t >( 0x01020304 ) );
+  pack_binary_( static_cast< uint32_t >( 1 ) );
+  pack_binary_( header_size );
+  pack_binary_( record_size );
+  pack_binary_( Time::get_resolution().get_ms() );
+  pack_binary_( static_cast< uint64_t >( node_.get_gid() ) );
+  pack_binary_( static_cast< uint64_t >( node_.get_vp() ) );
+  assert( B_.brecord_.size() == fixed_size );
+  B_.brecord_.insert( B_.brecord_.end(), columns.begin(), columns.end() );
+  B_.brecord_.resize( header_size, '\0' );
+
+  B_.bfs_.write( &B_.brecord_[ 0 ], B_.brecord_.size() );
+  B_.brecord_.clear();
+}
+
+void
+nest::RecordingDevice::write_binary_record_()
+{
+  if ( B_.brecord_.empty() )
+  {
+    return;
+  }
+
+  if ( B_.async_ )
+  {
+    B_.bfs_pending_.append( &B_.brecord_[ 0 ], B_.brecord_.size() );
+    if ( P_.flush_records_ or B_.bfs_pending_.size() >= AsyncWriter::batch_size )
+    {
+      submit_binary_file_output_( P_.flush_records_ );
+    }
+  }
+  else
+  {
+    B_.bfs_.write( &B_.brecord_[ 0 ], B_.brecord_.size() );
+    if ( P_.flush_records_ )
+    {
+      B_.bfs_.flush();
+    }
+  }
+  B_.brecord_.clear();
+}
+
+void
+nest::RecordingDevice::end_file_record_()
+{
+  if ( B_.async_ )
+  {
+    B_.fs_pending_ << '\n';
+    if ( P_.flush_records_ or B_.fs_pending_.tellp() >= static_cast< std::streamoff >( AsyncWriter::batch_size ) )
+    {
+      submit_file_output_( P_.flush_records_ );
+    }
+  }
+  else
+  {
+    B_.fs_ << '\n';
+    if ( P_.flush_records_ )
+    {
+      B_.fs_.flush();
+    }
+  }
+}
+
+void
+nest::RecordingDevice::submit_file_output_( bool flush )
+{
+  std::string data = B_.fs_pending_.str();
+  B_.fs_pending_.str( std::string() );
+  kernel().io_manager.get_async_writer().write( node_.get_thread(), B_.fs_, P_.filename_, data, flush );
+}
+
+void
+nest::RecordingDevice::submit_binary_file_output_( bool flush )
+{
+  kernel().io_manager.get_async_writer().write(
+    node_.get_thread(), B_.bfs_, P_.binary_filename_, B_.bfs_pending_, flush );
+}
+
 void
 nest::RecordingDevice::print_id_( std::ostream& os, index gid )
 {
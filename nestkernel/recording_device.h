@@ -25,6 +25,8 @@
 
 // C++ includes:
 #include <fstream>
+#include <sstream>
+#include <string>
 #include <vector>
 
 // Includes from libnestutil:
@@ -37,6 +39,7 @@
 // Includes from sli:
 #include "dictdatum.h"
 #include "dictutils.h"
+#include "name.h"
 
 namespace nest
 {
@@ -87,6 +90,9 @@ namespace nest
   - The device will not open an existing file, since that would erase the
     existing data in the file. If you want existing files to be overwritten
     automatically, you must set /overwrite_files in the root node.
+  - If /async_recording is set in the root node, file output is written by a
+    background thread, so that slow file systems do not stall the simulation.
+    All output is written before Simulate returns.
 
   Parameters:
   The following parameters are shared with all devices:
@@ -98,12 +104,13 @@ namespace nest
   /interval - Sampling interval in ms (default: 1ms).
 
   The following parameters control where output is sent/data collected:
-  /record_to - An array containing any combination of /file, /memory, /screen,
-               indicating whether to write to file, record in memory or write
-               to the console window. An empty array turns all recording of
-               individual events off, only an event count is kept. You can also
-               pass strings (file), (memory), (screen), mainly for compatibility
-               with Python.
+  /record_to - An array containing any combination of /file, /binary_file,
+               /memory, /screen, indicating whether to write to a text file,
+               write to a binary file, record in memory or write to the console
+               window. An empty array turns all recording of individual events
+               off, only an event count is kept. You can also pass strings
+               (file), (binary_file), (memory), (screen), mainly for
+               compatibility with Python.
 
                The name of the output file is
                  data_path/data_prefix(label|model_name)-gid-vp.file_extension
@@ -126,10 +133,13 @@ namespace nest
   /to_memory - If true, turn on recording to memory Similar to /record_to
                [/memory], but does not affect settings for recording to file and
                screen.
+  /to_binary_file - If true, turn on recording to binary file. Similar to
+               /record_to [/binary_file], but does not affect the other
+               settings.
 
   /filenames - Array containing the filenames where data is recorded to. This
-               array has one entry per local thread and is only available if
-               /to_file is set to true, or if /record_to contains /to_file.
+               array has one entry per local thread and file type and is only
+               available if /to_file or /to_binary_file is set to true.
 
   /label     - String specifying an arbitrary label for the device. It is used
                instead of model_name in the output file name.
@@ -151,6 +161,35 @@ namespace nest
   /use_gid_in_filename - Determines if the GID is used in the file name of the
   recording device. Setting this to false can lead to conflicting file names.
 
+  Binary files:
+  When recording to /binary_file, each thread of the device writes records of
+  fixed width without any formatting to the file
+    data_path/data_prefix(label|model_name)-gid-vp.file_extension.bin
+  The file starts with a header of the following fields in native byte order:
+    char[8]  magic string "NESTBIN" terminated by 0
+    uint32   byte order mark 0x01020304
+    uint32   format version, currently 1
+    uint64   header size in bytes, i.e., the offset of the first record
+    uint64   record size in bytes
+    double   simulation resolution in ms
+    uint64   GID of the device
+    uint64   virtual process of the device
+    char[]   0-terminated list of columns, e.g. (senders:i8 steps:i8), padded
+             with zeros to the header size
+  Columns are senders, targets, ports, rports, steps, offsets and weights, as
+  selected by /withgid, /withtargetgid, /withport, /withrport, /withtime,
+  /precise_times and /withweight, followed by one column per recorded quantity
+  for the multimeter. Times are always stored as step and offset, independent
+  of /time_in_steps, such that the spike time is steps * resolution - offsets.
+  Integer columns (i8) are 64-bit signed integers, float columns (f8) doubles.
+  Records are stored one after the other, each holding all columns of one
+  event, rather than as one block of values per column. Records can thus be
+  written as events arrive, without buffering the data of a simulation, and
+  files remain readable if a simulation is interrupted. PyNEST presents the
+  columns as fields of a structured array.
+  The settings that determine the columns cannot be changed while the file is
+  open. PyNEST reads the files with nest.binary_recording.
+
   The following parameters control how output is formatted:
   /withtime      - boolean value which specifies whether the network time should
                    be recorded (default: true).
@@ -174,9 +213,9 @@ namespace nest
                    screen output (default: false)
   /precision     - number of digits to use in output of doubles to file
                    (default: 3)
-  /binary        - if set to true, data is written in binary mode to files
-                   instead of ASCII. This setting affects file output only, not
-                   screen output (default: false)
+  /binary        - if set to true, text files are opened in binary mode. Use
+                   /binary_file in /record_to to write binary data instead of
+                   ASCII (default: false)
   /fbuffer_size  - the size of the buffer to use for writing to files. Setting
                    this value to 0 will reduce buffering to a system-dependent
                    minimum. Set /flush_after_simulate to true to ensure that all
@@ -194,7 +233,10 @@ namespace nest
                    steps, depending on /time_in_steps; only if /withtime is
                    true) and /offsets (only if /time_in_steps, /precise_times
                    and /withtime are true). All data stored in memory is erased
-                   when /n_events is set to 0.
+                   when /n_events is set to 0. The function TakeEvents returns
+                   the events stored in memory and erases them, such that each
+                   event is returned only once and the data is not held twice
+                   when reading large recordings.
 
   SeeAlso: Device, StimulatingDevice
 */
@@ -345,6 +387,14 @@ public:
 
   void get_status( DictionaryDatum& ) const;
 
+  /**
+   * Hand the events stored in memory over to the caller.
+   * The events are added to the given events dictionary as by get_status()
+   * and erased from the device, as if /n_events were set to 0. The data of
+   * the first device added to an empty dictionary is moved without copying.
+   */
+  void take_events( DictionaryDatum& );
+
   /**
    * Set properties of recording device.
    * Setting properties of recording devices is special:
@@ -393,6 +443,18 @@ public:
   {
     return P_.to_accumulator_;
   }
+  bool
+  to_binary_file() const
+  {
+    return P_.to_binary_file_;
+  }
+
+  /**
+   * Set the names of the values passed to print_value() for each record.
+   * They name the value columns of binary files and must be set before
+   * calibrate().
+   */
+  void set_value_names( const std::vector< Name >& );
 
   inline void set_precise_times( bool precise_times );
 
@@ -406,6 +468,8 @@ public:
 
 
 private:
+  struct Parameters_;
+
   /**
    * Print the time-stamp according to the recorder's flags.
    *
@@ -442,6 +506,60 @@ private:
    */
   void print_rport_( std::ostream&, long );
 
+  /**
+   * Return the stream to format text file output into.
+   * @note This is the file itself, or a buffer for the asynchronous writer.
+   */
+  std::ostream& file_stream_();
+
+  /**
+   * Terminate record in text file and hand over output if required.
+   */
+  void end_file_record_();
+
+  /**
+   * Hand over buffered text file output to asynchronous writer.
+   */
+  void submit_file_output_( bool flush );
+
+  /**
+   * Hand over buffered binary file output to asynchronous writer.
+   */
+  void submit_binary_file_output_( bool flush );
+
+  /**
+   * Append a value to the binary record under construction.
+   */
+  template < typename T >
+  void pack_binary_( T );
+
+  /**
+   * Write the binary record under construction to file.
+   */
+  void write_binary_record_();
+
+  /**
+   * Write the header of a newly opened binary file.
+   */
+  void write_binary_header_();
+
+  /**
+   * Return the columns of binary files for the given parameters.
+   * @note Each column is given as name:type, with type i8 or f8.
+   */
+  std::vector< std::string > binary_columns_( const Parameters_& ) const;
+
+  /**
+   * Open file for writing, respecting /overwrite_files.
+   * @note Clears filename and throws IOError if the file cannot be opened.
+   */
+  void open_file_( std::ofstream&, std::string& filename, std::ios::openmode );
+
+  /**
+   * Flush file if requested and check its state.
+   */
+  void flush_file_( std::ofstream&, const std::string& filename, const std::string& caller );
+
   /**
    * Store data in internal structure.
    * @param store sender gid of event
@@ -487,6 +605,20 @@ private:
     char* fbuffer_;
     long fbuffer_size_; //!< size of fbuffer_; -1: not yet set
 
+    std::ofstream bfs_;                      //!< the binary file to write to
+    std::vector< char > brecord_;            //!< binary record under construction
+    std::vector< std::string > bfs_columns_; //!< columns of the open binary file
+    std::vector< Name > value_names_;        //!< names of values in each record
+
+    /**
+     * If true, file output is collected in fs_pending_ and bfs_pending_ and
+     * handed over to the asynchronous writer of the IOManager in batches.
+     * The writer then owns fs_ and bfs_ until the end of the simulation.
+     */
+    bool async_;
+    std::ostringstream fs_pending_; //!< text output not yet handed over
+    std::string bfs_pending_;       //!< binary output not yet handed over
+
     Buffers_();
     ~Buffers_();
   };
@@ -500,6 +632,7 @@ private:
     bool to_memory_;      //!< true if data should be recorded in memory, default
     bool to_accumulator_; //!< true if data is to be accumulated; exclusive to
                           //!< all other to_*
+    bool to_binary_file_; //!< true if recorder writes to a binary file
     bool time_in_steps_;  //!< true if time is printed in steps, not ms.
     bool precise_times_;  //!< true if time is computed including offset
     bool withgid_;        //!< true if element GID is to be printed, default
@@ -528,6 +661,9 @@ private:
 
     bool use_gid_in_filename_;
 
+    //! the filename, if recording to a binary file (read-only)
+    std::string binary_filename_;
+
     /**
      * Set default parameter values.
      * @param Default file name extension, excluding ".".
@@ -573,6 +709,17 @@ private:
     //! Store current values in dictionary
     void get( DictionaryDatum&, const Parameters_& ) const;
     void set( const DictionaryDatum& ); //!< Get values from dictionary
+
+    //! Move events to the events dictionary and clear them
+    void take( DictionaryDatum&, const Parameters_& );
+
+  private:
+    /**
+     * Add the events of s to the events dictionary, copying them if s is
+     * const and moving them otherwise.
+     */
+    template < typename StateT >
+    static void get_events_( StateT& s, DictionaryDatum&, const Parameters_& );
   };
 
   // ------------------------------------------------------------------
@@ -620,6 +767,12 @@ RecordingDevice::get_status( DictionaryDatum& d ) const
   ( *d )[ names::element_type ] = LiteralDatum( names::recorder );
 }
 
+inline void
+RecordingDevice::take_events( DictionaryDatum& events )
+{
+  S_.take( events, P_ );
+}
+
 inline void
 RecordingDevice::set_precise_times( bool use_precise )
 {
@@ -648,12 +801,39 @@ RecordingDevice::print_value( const ValueT& value, bool endrecord )
 
   if ( P_.to_file_ )
   {
-    B_.fs_ << value << '\t';
+    file_stream_() << value << '\t';
     if ( endrecord )
     {
-      B_.fs_ << '\n';
+      end_file_record_();
     }
   }
+
+  if ( P_.to_binary_file_ )
+  {
+    pack_binary_( static_cast< double >( value ) );
+    if ( endrecord )
+    {
+      write_binary_record_();
+    }
+  }
+}
+
+inline std::ostream&
+RecordingDevice::file_stream_()
+{
+  if ( B_.async_ )
+  {
+    return B_.fs_pending_;
+  }
+  return B_.fs_;
+}
+
+template < typename T >
+inline void
+RecordingDevice::pack_binary_( T value )
+{
+  const char* const bytes = reinterpret_cast< const char* >( &value );
+  B_.brecord_.insert( B_.brecord_.end(), bytes, bytes + sizeof( T ) );
 }
 
 template < typename DataT >
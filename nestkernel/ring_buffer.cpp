@@ -22,6 +22,9 @@
 
 #include "ring_buffer.h"
 
+// Includes from libnestutil:
+#include "binary_io.h"
+
 nest::RingBuffer::RingBuffer()
   : buffer_( kernel().connection_manager.get_min_delay() + kernel().connection_manager.get_max_delay(), 0.0 )
 {
@@ -45,6 +48,18 @@ nest::RingBuffer::clear()
   buffer_.assign( buffer_.size(), 0.0 );
 }
 
+void
+nest::RingBuffer::save_state( std::ostream& os ) const
+{
+  write_binary( os, buffer_ );
+}
+
+void
+nest::RingBuffer::load_state( std::istream& is )
+{
+  read_binary( is, buffer_ );
+}
+
 
 nest::MultRBuffer::MultRBuffer()
   : buffer_( kernel().connection_manager.get_min_delay() + kernel().connection_manager.get_max_delay(), 0.0 )
@@ -24,6 +24,7 @@
 #define RING_BUFFER_H
 
 // C++ includes:
+#include <iosfwd>
 #include <list>
 #include <vector>
 
@@ -104,6 +105,17 @@ public:
    */
   double get_value( const long offs );
 
+  /**
+   * Read the values at offsets from to to-1 from ring buffer.
+   * Equivalent to calling get_value() for each offset, but computes the
+   * buffer index only once.
+   * @param  from    Offset of first element to read within slice.
+   * @param  to      Offset after last element to read.
+   * @param  values  Receives the value at offset from+k in values[k*stride].
+   * @param  stride  Distance between consecutive values in values.
+   */
+  void get_values( const long from, const long to, double* values, const size_t stride );
+
   /**
    * Read one value from ring buffer without deleting it afterwards.
    * @param  offs  Offset of element to read within slice.
@@ -133,6 +145,16 @@ public:
     return buffer_.size();
   }
 
+  /**
+   * Write the buffered values to a checkpoint.
+   * The buffer is indexed relative to the simulation clock, so it must
+   * be restored in a kernel with the same clock and delays.
+   */
+  void save_state( std::ostream& ) const;
+
+  //! Restore the values written by save_state()
+  void load_state( std::istream& );
+
 private:
   //! Buffered data
   std::vector< double > buffer_;
@@ -172,6 +194,24 @@ RingBuffer::get_value( const long offs )
   return val;
 }
 
+inline void
+RingBuffer::get_values( const long from, const long to, double* values, const size_t stride )
+{
+  assert( 0 <= from and from < to );
+  assert( ( delay ) to <= kernel().connection_manager.get_min_delay() );
+
+  // indices of consecutive offsets are consecutive modulo the buffer size
+  const size_t size = buffer_.size();
+  size_t idx = get_index_( from );
+  for ( long offs = from; offs < to; ++offs )
+  {
+    *values = buffer_[ idx ];
+    buffer_[ idx ] = 0.0; // clear buffer after reading
+    values += stride;
+    idx = idx + 1 == size ? 0 : idx + 1;
+  }
+}
+
 inline double
 RingBuffer::get_value_wfr_update( const long offs )
 {
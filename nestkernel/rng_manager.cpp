@@ -24,8 +24,10 @@
 
 // C++ includes:
 #include <set>
+#include <typeinfo>
 
 // Includes from libnestutil:
+#include "binary_io.h"
 #include "logging.h"
 
 // Includes from librandom:
@@ -43,6 +45,9 @@
 
 nest::RNGManager::RNGManager()
   : rng_()
+  , keyed_rng_()
+  , keyed_connection_rngs_( false )
+  , connection_purpose_( 0 )
 {
 }
 
@@ -51,11 +56,14 @@ nest::RNGManager::initialize()
 {
   create_rngs_();
   create_grng_();
+  create_keyed_rngs_();
+  connection_purpose_ = 0;
 }
 
 void
 nest::RNGManager::finalize()
 {
+  keyed_connection_rngs_ = false;
 }
 
 void
@@ -192,6 +200,8 @@ nest::RNGManager::set_status( const DictionaryDatum& d )
     grng_->seed( gseed );
 
   } // if grng_seed
+
+  updateValue< bool >( d, names::keyed_connection_rngs, keyed_connection_rngs_ );
 }
 
 void
@@ -199,8 +209,49 @@ nest::RNGManager::get_status( DictionaryDatum& d )
 {
   ( *d )[ names::rng_seeds ] = Token( rng_seeds_ );
   def< long >( d, names::grng_seed, grng_seed_ );
+  def< bool >( d, names::keyed_connection_rngs, keyed_connection_rngs_ );
+}
+
+void
+nest::RNGManager::save_checkpoint( std::ostream& os )
+{
+  // the keyed generators are reset to the start of a stream before each
+  // use and need not be saved
+  for ( size_t t = 0; t < rng_.size(); ++t )
+  {
+    save_rng_( os, rng_[ t ] );
+  }
+  save_rng_( os, grng_ );
+}
+
+void
+nest::RNGManager::load_checkpoint( std::istream& is )
+{
+  for ( size_t t = 0; t < rng_.size(); ++t )
+  {
+    load_rng_( is, rng_[ t ] );
+  }
+  load_rng_( is, grng_ );
+}
+
+void
+nest::RNGManager::save_rng_( std::ostream& os, const librandom::RngPtr& rng ) const
+{
+  write_binary( os, std::string( typeid( *rng ).name() ) );
+  rng->save_state( os );
 }
 
+void
+nest::RNGManager::load_rng_( std::istream& is, librandom::RngPtr& rng )
+{
+  std::string type_name;
+  read_binary( is, type_name );
+  if ( type_name != typeid( *rng ).name() )
+  {
+    throw CheckpointError( "Random number generators differ from checkpoint." );
+  }
+  rng->load_state( is );
+}
 
 void
 nest::RNGManager::create_rngs_()
@@ -281,3 +332,14 @@ nest::RNGManager::create_grng_()
   grng_seed_ = s;
   grng_->seed( s );
 }
+
+void
+nest::RNGManager::create_keyed_rngs_()
+{
+  // the generators are seeded with grng_seed_ whenever they are used
+  keyed_rng_.clear();
+  for ( thread t = 0; t < kernel().vp_manager.get_num_threads(); ++t )
+  {
+    keyed_rng_.push_back( librandom::RngPtr( new librandom::Philox( librandom::RandomGen::DefaultSeed ) ) );
+  }
+}
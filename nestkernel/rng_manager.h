@@ -30,6 +30,7 @@
 #include "manager_interface.h"
 
 // Includes from librandom:
+#include "philox.h"
 #include "randomgen.h"
 
 // Includes from nestkernel:
@@ -56,6 +57,9 @@ public:
   virtual void set_status( const DictionaryDatum& );
   virtual void get_status( DictionaryDatum& );
 
+  virtual void save_checkpoint( std::ostream& );
+  virtual void load_checkpoint( std::istream& );
+
   /**
    * Get random number client of a thread.
    * Defaults to thread 0 to allow use in non-threaded
@@ -70,9 +74,39 @@ public:
    */
   librandom::RngPtr get_grng() const;
 
+  /**
+   * Return true if connection rules shall draw from keyed streams.
+   * This is the case if the kernel property keyed_connection_rngs is set.
+   */
+  bool keyed_connection_rngs() const;
+
+  /**
+   * Get the keyed random number client of a thread, set to the start of
+   * the stream identified by purpose, stream and substream.
+   *
+   * The numbers drawn depend only on the low 32 bits of grng_seed, on
+   * purpose, stream and substream, and not on the thread or process
+   * drawing them. Connection rules use the number of the connection call
+   * as purpose and a GID as stream.
+   */
+  librandom::RngPtr get_keyed_rng( thread thrd, unsigned long purpose, index stream, unsigned long substream );
+
+  /**
+   * Return a new purpose for the keyed streams of one connection
+   * call. Must be called in the same order on all processes.
+   */
+  unsigned long next_connection_purpose();
+
 private:
   void create_rngs_();
   void create_grng_();
+  void create_keyed_rngs_();
+
+  //! write type and state of rng to a checkpoint
+  void save_rng_( std::ostream&, const librandom::RngPtr& ) const;
+
+  //! restore state of rng, which must be of the type in the checkpoint
+  void load_rng_( std::istream&, librandom::RngPtr& );
 
   /**
    * Vector of random number generators for threads.
@@ -94,6 +128,18 @@ private:
   //! state of the GRNG.
   long grng_seed_;
 
+  /**
+   * Counter-based generators for threads, one per thread. They are
+   * switched to the stream of each target by get_keyed_rng().
+   */
+  std::vector< librandom::RngPtr > keyed_rng_;
+
+  //! If true, connection rules draw from keyed_rng_ instead of rng_
+  bool keyed_connection_rngs_;
+
+  //! Next purpose to hand out by next_connection_purpose()
+  unsigned long connection_purpose_;
+
 }; // class RNGManager
 } // namespace nest
 
@@ -110,4 +156,32 @@ nest::RNGManager::get_grng() const
   return grng_;
 }
 
+inline bool
+nest::RNGManager::keyed_connection_rngs() const
+{
+  return keyed_connection_rngs_;
+}
+
+inline librandom::RngPtr
+nest::RNGManager::get_keyed_rng( nest::thread t,
+  unsigned long purpose,
+  nest::index stream,
+  unsigned long substream )
+{
+  assert( t < static_cast< nest::thread >( keyed_rng_.size() ) );
+  librandom::Philox& rng = static_cast< librandom::Philox& >( *keyed_rng_[ t ] );
+
+  // the 64-bit key of Philox holds seed and purpose
+  const unsigned long seed = grng_seed_;
+  rng.seed( ( seed & 0xffffffffUL ) | ( ( purpose & 0xffffffffUL ) << 32 ) );
+  rng.set_stream( stream, substream );
+  return keyed_rng_[ t ];
+}
+
+inline unsigned long
+nest::RNGManager::next_connection_purpose()
+{
+  return connection_purpose_++;
+}
+
 #endif /* RNG_MANAGER_H */
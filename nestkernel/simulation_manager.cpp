@@ -29,6 +29,7 @@
 #include <vector>
 
 // Includes from libnestutil:
+#include "binary_io.h"
 #include "compose.hpp"
 #include "numerics.h"
 
@@ -60,6 +61,7 @@ nest::SimulationManager::SimulationManager()
   , wfr_tol_( 0.0001 )
   , wfr_max_iterations_( 15 )
   , wfr_interpolation_order_( 3 )
+  , batch_node_update_( false )
 {
 }
 
@@ -75,6 +77,7 @@ nest::SimulationManager::initialize()
   simulated_ = false;
   exit_on_user_signal_ = false;
   inconsistent_state_ = false;
+  batch_node_update_ = false;
 }
 
 void
@@ -129,6 +132,7 @@ nest::SimulationManager::set_status( const DictionaryDatum& d )
   }
 
   updateValue< bool >( d, names::print_time, print_time_ );
+  updateValue< bool >( d, names::batch_node_update, batch_node_update_ );
 
   // tics_per_ms and resolution must come after local_num_thread /
   // total_num_threads because they might reset the network and the time
@@ -371,6 +375,7 @@ nest::SimulationManager::get_status( DictionaryDatum& d )
   def< double >( d, names::time, get_time().get_ms() );
   def< long >( d, names::to_do, to_do_ );
   def< bool >( d, names::print_time, print_time_ );
+  def< bool >( d, names::batch_node_update, batch_node_update_ );
 
   def< bool >( d, names::use_wfr, use_wfr_ );
   def< double >( d, names::wfr_comm_interval, wfr_comm_interval_ );
@@ -379,6 +384,34 @@ nest::SimulationManager::get_status( DictionaryDatum& d )
   def< long >( d, names::wfr_interpolation_order, wfr_interpolation_order_ );
 }
 
+void
+nest::SimulationManager::save_checkpoint( std::ostream& os )
+{
+  if ( to_do_ != 0 )
+  {
+    throw CheckpointError( "Checkpoints cannot be written after an interrupted simulation." );
+  }
+
+  write_binary( os, clock_.get_tics() );
+  write_binary( os, slice_ );
+  write_binary( os, from_step_ );
+}
+
+void
+nest::SimulationManager::load_checkpoint( std::istream& is )
+{
+  tic_t clock = 0;
+  read_binary( is, clock );
+  read_binary( is, slice_ );
+  read_binary( is, from_step_ );
+
+  // simulated_ remains false, so that prepare() sets up the spike
+  // buffers; the moduli are computed from the restored clock
+  clock_ = Time::tic( clock );
+  to_do_ = 0;
+  to_step_ = 0;
+}
+
 void
 nest::SimulationManager::prepare()
 {
@@ -405,6 +438,17 @@ nest::SimulationManager::prepare()
   // find shortest and longest delay across all MPI processes
   // this call sets the member variables
   kernel().connection_manager.update_delay_extrema_();
+
+  if ( kernel().event_delivery_manager.get_pipeline_spike_communication()
+    and kernel().connection_manager.get_min_connection_delay() < 2 )
+  {
+    LOG( M_ERROR,
+      "SimulationManager::prepare",
+      "Pipelined spike communication requires all delays to be at least "
+      "two simulation steps." );
+    throw KernelException();
+  }
+
   kernel().event_delivery_manager.init_moduli();
 
   // Check for synchronicity of global rngs over processes.
@@ -428,6 +472,8 @@ nest::SimulationManager::prepare()
     kernel().event_delivery_manager.configure_spike_data_buffers();
   }
 
+  kernel().io_manager.prepare();
+
   kernel().node_manager.ensure_valid_thread_local_ids();
   kernel().node_manager.prepare_nodes();
 
@@ -564,6 +610,7 @@ nest::SimulationManager::run( Time const& t )
   call_update_();
 
   kernel().node_manager.post_run_cleanup();
+  kernel().io_manager.post_run_cleanup();
 }
 
 void
@@ -666,7 +713,17 @@ nest::SimulationManager::call_update_()
 void
 nest::SimulationManager::update_connection_infrastructure( const thread tid )
 {
-  kernel().connection_manager.restructure_connection_tables( tid );
+#pragma omp single
+  {
+    kernel().connection_manager.check_incremental_update();
+  }
+
+  // an incremental update keeps the connections communicated
+  // previously and only adds connections created since then
+  if ( not kernel().connection_manager.is_incremental_update() )
+  {
+    kernel().connection_manager.restructure_connection_tables( tid );
+  }
   kernel().connection_manager.sort_connections( tid );
 
 #pragma omp barrier // wait for all threads to finish sorting
@@ -701,6 +758,8 @@ nest::SimulationManager::update_connection_infrastructure( const thread tid )
     kernel().connection_manager.compress_secondary_send_buffer_pos( tid );
   }
 
+  kernel().connection_manager.set_connections_processed( tid );
+
 #pragma omp single
   {
     kernel().node_manager.set_have_nodes_changed( false );
@@ -747,6 +806,12 @@ nest::SimulationManager::update_()
           ( *i )->update_synaptic_elements( Time( Time::step( clock_.get_steps() + from_step_ ) ).get_ms() );
         }
 #pragma omp barrier
+        // connections may be deleted, so spikes that are still being
+        // communicated need to be delivered first
+        if ( kernel().event_delivery_manager.get_pipeline_spike_communication() )
+        {
+          kernel().event_delivery_manager.complete_pending_spike_data( tid );
+        }
 #pragma omp single
         {
           kernel().sp_manager.update_structural_plasticity();
@@ -885,22 +950,44 @@ nest::SimulationManager::update_()
       // end of preliminary update
 
       const std::vector< Node* >& thread_local_nodes = kernel().node_manager.get_nodes_on_thread( tid );
-      for ( std::vector< Node* >::const_iterator node = thread_local_nodes.begin(); node != thread_local_nodes.end();
-            ++node )
+      if ( batch_node_update_ )
       {
-        // We update in a parallel region. Therefore, we need to catch
-        // exceptions here and then handle them after the parallel region.
-        try
+        const std::vector< size_t >& batches = kernel().node_manager.get_node_batches_on_thread( tid );
+        for ( size_t b = 0; b + 1 < batches.size(); ++b )
         {
-          if ( not( *node )->is_frozen() )
+          const std::vector< Node* >::const_iterator first = thread_local_nodes.begin() + batches[ b ];
+          const std::vector< Node* >::const_iterator last = thread_local_nodes.begin() + batches[ b + 1 ];
+          try
+          {
+            ( *first )->update_batch( first, last, clock_, from_step_, to_step_ );
+          }
+          catch ( std::exception& e )
           {
-            ( *node )->update( clock_, from_step_, to_step_ );
+            // so throw the exception after parallel region
+            exceptions_raised.at( tid ) = lockPTR< WrappedThreadException >( new WrappedThreadException( e ) );
           }
         }
-        catch ( std::exception& e )
+      }
+      else
+      {
+        for ( std::vector< Node* >::const_iterator node = thread_local_nodes.begin();
+              node != thread_local_nodes.end();
+              ++node )
         {
-          // so throw the exception after parallel region
-          exceptions_raised.at( tid ) = lockPTR< WrappedThreadException >( new WrappedThreadException( e ) );
+          // We update in a parallel region. Therefore, we need to catch
+          // exceptions here and then handle them after the parallel region.
+          try
+          {
+            if ( not( *node )->is_frozen() )
+            {
+              ( *node )->update( clock_, from_step_, to_step_ );
+            }
+          }
+          catch ( std::exception& e )
+          {
+            // so throw the exception after parallel region
+            exceptions_raised.at( tid ) = lockPTR< WrappedThreadException >( new WrappedThreadException( e ) );
+          }
         }
       }
 
@@ -948,6 +1035,12 @@ nest::SimulationManager::update_()
 
     } while ( to_do_ > 0 and not exit_on_user_signal_ and not exceptions_raised.at( tid ) );
 
+    // deliver spikes of the last slice that are still being communicated
+    if ( kernel().event_delivery_manager.get_pipeline_spike_communication() )
+    {
+      kernel().event_delivery_manager.complete_pending_spike_data( tid );
+    }
+
     // End of the slice, we update the number of synaptic elements
     for ( std::vector< Node* >::const_iterator i = kernel().node_manager.get_nodes_on_thread( tid ).begin();
           i != kernel().node_manager.get_nodes_on_thread( tid ).end();
@@ -54,6 +54,9 @@ public:
   virtual void set_status( const DictionaryDatum& );
   virtual void get_status( DictionaryDatum& );
 
+  virtual void save_checkpoint( std::ostream& );
+  virtual void load_checkpoint( std::istream& );
+
   /**
       check for errors in time before run
       @throws KernelException if illegal time passed
@@ -134,6 +137,11 @@ public:
    */
   bool has_been_simulated() const;
 
+  /**
+   * Return true between calls to prepare() and cleanup().
+   */
+  bool has_been_prepared() const;
+
   /**
    * Reset the SimulationManager to the state at T = 0.
    */
@@ -157,7 +165,8 @@ public:
   // TODO: rename / precisely how defined?
   delay get_to_step() const;
 
-  //! Sorts source table and connections and create new target table.
+  //! Sorts source table and connections and create new target table, or,
+  //! if the update is incremental, extend the existing target table.
   void update_connection_infrastructure( const thread tid );
 
 private:
@@ -195,6 +204,8 @@ private:
                                    //!< relaxation
   size_t wfr_interpolation_order_; //!< interpolation order for waveform
                                    //!< relaxation method
+  bool batch_node_update_;         //!< update nodes in batches of the same
+                                   //!< model, see Node::update_batch()
 };
 
 inline Time const&
@@ -216,6 +227,12 @@ SimulationManager::has_been_simulated() const
   return simulated_;
 }
 
+inline bool
+SimulationManager::has_been_prepared() const
+{
+  return prepared_;
+}
+
 inline size_t
 SimulationManager::get_slice() const
 {
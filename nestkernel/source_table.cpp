@@ -21,6 +21,7 @@
  */
 
 // C++ includes:
+#include <algorithm>
 #include <iostream>
 
 // Includes from nestkernel:
@@ -46,6 +47,8 @@ nest::SourceTable::initialize()
   const thread num_threads = kernel().vp_manager.get_num_threads();
   sources_.resize( num_threads );
   is_cleared_.resize( num_threads );
+  num_processed_.resize( num_threads );
+  segment_starts_.resize( num_threads );
   saved_entry_point_.resize( num_threads );
   current_positions_.resize( num_threads );
   saved_positions_.resize( num_threads );
@@ -54,6 +57,8 @@ nest::SourceTable::initialize()
   {
     const thread tid = kernel().vp_manager.get_thread_id();
     sources_[ tid ].resize( 0 );
+    num_processed_[ tid ].clear();
+    segment_starts_[ tid ].clear();
     resize_sources( tid );
     is_cleared_[ tid ] = false;
     saved_entry_point_[ tid ] = false;
@@ -71,6 +76,8 @@ nest::SourceTable::finalize()
     }
   }
   sources_.clear();
+  num_processed_.clear();
+  segment_starts_.clear();
   current_positions_.clear();
   saved_positions_.clear();
 }
@@ -87,6 +94,20 @@ nest::SourceTable::is_cleared() const
   return all_cleared;
 }
 
+size_t
+nest::SourceTable::max_num_segments() const
+{
+  size_t max_num = 1;
+  for ( thread tid = 0; tid < static_cast< thread >( segment_starts_.size() ); ++tid )
+  {
+    for ( synindex syn_id = 0; syn_id < segment_starts_[ tid ].size(); ++syn_id )
+    {
+      max_num = std::max( max_num, num_segments( tid, syn_id ) );
+    }
+  }
+  return max_num;
+}
+
 std::vector< BlockVector< nest::Source > >&
 nest::SourceTable::get_thread_local_sources( const thread tid )
 {
@@ -269,6 +290,7 @@ void
 nest::SourceTable::resize_sources( const thread tid )
 {
   sources_[ tid ].resize( kernel().model_manager.get_num_synapse_prototypes() );
+  segment_starts_[ tid ].resize( kernel().model_manager.get_num_synapse_prototypes() );
 }
 
 bool
@@ -290,6 +312,15 @@ nest::SourceTable::get_next_target_data( const thread tid,
       return false; // reached the end of the sources table
     }
 
+    if ( current_position.lcid
+      < static_cast< long >( get_num_processed( current_position.tid, current_position.syn_id ) ) )
+    {
+      // all remaining entries of this synapse type have been processed
+      // in an earlier update, so we continue with the next one
+      current_position.lcid = -1;
+      continue;
+    }
+
     // the current position contains an entry, so we retrieve it
     const Source& const_current_source =
       sources_[ current_position.tid ][ current_position.syn_id ][ current_position.lcid ];
@@ -72,6 +72,24 @@ private:
    */
   std::vector< bool > is_cleared_;
 
+  /**
+   * Number of entries at the beginning of each sources_ vector that
+   * have been processed in an earlier update of the connection
+   * infrastructure. Sources created later are appended after these
+   * entries and are the only ones considered by an incremental
+   * update.
+   */
+  std::vector< std::vector< index > > num_processed_;
+
+  /**
+   * Start positions of the sorted segments of each sources_ vector,
+   * except the first one, which starts at zero. Sources are sorted
+   * within each segment; each incremental update appends a segment
+   * containing the sources created since the previous update. A full
+   * update sorts all sources into a single segment.
+   */
+  std::vector< std::vector< std::vector< index > > > segment_starts_;
+
   //! Needed during readout of sources_.
   std::vector< SourceTablePosition > current_positions_;
   //! Needed during readout of sources_.
@@ -182,6 +200,37 @@ public:
    */
   void reset_processed_flags( const thread tid );
 
+  /**
+   * Marks all current entries as processed in an earlier update, so
+   * that an incremental update only considers entries added later.
+   */
+  void set_all_processed( const thread tid );
+
+  /**
+   * Returns the number of entries at the given thread id and synapse
+   * type that have been processed in an earlier update.
+   */
+  index get_num_processed( const thread tid, const synindex syn_id ) const;
+
+  /**
+   * Records that the entries from position first onwards form a
+   * sorted segment. If first is zero, all entries form a single
+   * segment.
+   */
+  void set_sorted_from( const thread tid, const synindex syn_id, const index first );
+
+  /**
+   * Returns the number of sorted segments at the given thread id and
+   * synapse type.
+   */
+  size_t num_segments( const thread tid, const synindex syn_id ) const;
+
+  /**
+   * Returns the largest number of sorted segments over all thread ids
+   * and synapse types.
+   */
+  size_t max_num_segments() const;
+
   /**
    * Removes all entries marked as processed.
    */
@@ -202,10 +251,10 @@ public:
     std::map< index, size_t >& buffer_pos_of_source_gid_syn_id_ );
 
   /**
-   * Finds the first entry in sources_ at the given thread id and
-   * synapse type that is equal to sgid.
+   * Finds the first entry in the given sorted segment of sources_ at
+   * the given thread id and synapse type that is equal to sgid.
    */
-  index find_first_source( const thread tid, const synindex syn_id, const index sgid ) const;
+  index find_first_source( const thread tid, const synindex syn_id, const index sgid, const size_t segment ) const;
 
   /**
    * Marks entry in sources_ at given position as disabled.
@@ -228,9 +277,10 @@ public:
 
   /**
    * Returns the number of unique global ids for given thread id and
-   * synapse type in sources_. This number corresponds to the number
-   * of targets that need to be communicated during construction of
-   * the presynaptic connection infrastructure.
+   * synapse type in sources_, not counting processed entries. This
+   * number corresponds to the number of targets that need to be
+   * communicated during construction of the presynaptic connection
+   * infrastructure.
    */
   size_t num_unique_sources( const thread tid, const synindex syn_id ) const;
 
@@ -262,6 +312,8 @@ SourceTable::clear( const thread tid )
     it->clear();
   }
   sources_[ tid ].clear();
+  num_processed_[ tid ].clear();
+  segment_starts_[ tid ].clear();
   is_cleared_[ tid ] = true;
 }
 
@@ -343,6 +395,7 @@ SourceTable::reset_entry_point( const thread tid )
 inline void
 SourceTable::reset_processed_flags( const thread tid )
 {
+  num_processed_[ tid ].assign( sources_[ tid ].size(), 0 );
   for ( std::vector< BlockVector< Source > >::iterator it = sources_[ tid ].begin(); it != sources_[ tid ].end(); ++it )
   {
     for ( BlockVector< Source >::iterator iit = it->begin(); iit != it->end(); ++iit )
@@ -352,6 +405,42 @@ SourceTable::reset_processed_flags( const thread tid )
   }
 }
 
+inline void
+SourceTable::set_all_processed( const thread tid )
+{
+  num_processed_[ tid ].resize( sources_[ tid ].size() );
+  for ( synindex syn_id = 0; syn_id < sources_[ tid ].size(); ++syn_id )
+  {
+    num_processed_[ tid ][ syn_id ] = sources_[ tid ][ syn_id ].size();
+  }
+}
+
+inline index
+SourceTable::get_num_processed( const thread tid, const synindex syn_id ) const
+{
+  return syn_id < num_processed_[ tid ].size() ? num_processed_[ tid ][ syn_id ] : 0;
+}
+
+inline void
+SourceTable::set_sorted_from( const thread tid, const synindex syn_id, const index first )
+{
+  std::vector< index >& segment_starts = segment_starts_[ tid ][ syn_id ];
+  if ( first == 0 )
+  {
+    segment_starts.clear();
+  }
+  else if ( first < sources_[ tid ][ syn_id ].size() )
+  {
+    segment_starts.push_back( first );
+  }
+}
+
+inline size_t
+SourceTable::num_segments( const thread tid, const synindex syn_id ) const
+{
+  return segment_starts_[ tid ][ syn_id ].size() + 1;
+}
+
 inline void
 SourceTable::no_targets_to_process( const thread tid )
 {
@@ -361,12 +450,18 @@ SourceTable::no_targets_to_process( const thread tid )
 }
 
 inline index
-SourceTable::find_first_source( const thread tid, const synindex syn_id, const index sgid ) const
+SourceTable::find_first_source( const thread tid, const synindex syn_id, const index sgid, const size_t segment ) const
 {
-  // binary search in sorted sources
-  const BlockVector< Source >::const_iterator begin = sources_[ tid ][ syn_id ].begin();
-  const BlockVector< Source >::const_iterator end = sources_[ tid ][ syn_id ].end();
-  BlockVector< Source >::const_iterator it = std::lower_bound( begin, end, Source( sgid, true ) );
+  const std::vector< index >& segment_starts = segment_starts_[ tid ][ syn_id ];
+  assert( segment <= segment_starts.size() );
+
+  // binary search in sorted sources of the segment
+  const BlockVector< Source >& sources = sources_[ tid ][ syn_id ];
+  const BlockVector< Source >::const_iterator begin = sources.begin();
+  const BlockVector< Source >::const_iterator end =
+    segment < segment_starts.size() ? sources.begin() + segment_starts[ segment ] : sources.end();
+  BlockVector< Source >::const_iterator it = std::lower_bound(
+    segment > 0 ? sources.begin() + segment_starts[ segment - 1 ] : begin, end, Source( sgid, true ) );
 
   // source found by binary search could be disabled, iterate through
   // sources until a valid one is found
@@ -410,8 +505,9 @@ SourceTable::num_unique_sources( const thread tid, const synindex syn_id ) const
 {
   size_t n = 0;
   index last_source = 0;
-  for ( BlockVector< Source >::const_iterator cit = sources_[ tid ][ syn_id ].begin();
-        cit != sources_[ tid ][ syn_id ].end();
+  const BlockVector< Source >& sources = sources_[ tid ][ syn_id ];
+  for ( BlockVector< Source >::const_iterator cit = sources.begin() + get_num_processed( tid, syn_id );
+        cit != sources.end();
         ++cit )
   {
     if ( last_source != ( *cit ).get_gid() )
@@ -31,6 +31,8 @@
 
 // C++ includes:
 #include <algorithm>
+#include <cmath>
+#include <numeric>
 
 // Includes from nestkernel:
 #include "conn_builder.h"
@@ -386,9 +388,7 @@ SPManager::update_structural_plasticity( SPBuilder* sp_builder )
   std::vector< index > pre_deleted_id, post_deleted_id;
   std::vector< int > pre_deleted_n, post_deleted_n;
 
-  // Global vector for vacant and deleted synaptic element
-  std::vector< index > pre_vacant_id_global, post_vacant_id_global;
-  std::vector< int > pre_vacant_n_global, post_vacant_n_global;
+  // Global vector for deleted synaptic element
   std::vector< index > pre_deleted_id_global, post_deleted_id_global;
   std::vector< int > pre_deleted_n_global, post_deleted_n_global;
 
@@ -434,24 +434,34 @@ SPManager::update_structural_plasticity( SPBuilder* sp_builder )
       sp_builder->get_post_synaptic_element_name(), post_vacant_id, post_vacant_n, post_deleted_id, post_deleted_n );
   }
 
-  // Communicate vacant elements
-  kernel().mpi_manager.communicate( pre_vacant_id, pre_vacant_id_global, displacements );
-  kernel().mpi_manager.communicate( pre_vacant_n, pre_vacant_n_global, displacements );
-  kernel().mpi_manager.communicate( post_vacant_id, post_vacant_id_global, displacements );
-  kernel().mpi_manager.communicate( post_vacant_n, post_vacant_n_global, displacements );
-
-  if ( pre_vacant_id_global.size() > 0 and post_vacant_id_global.size() > 0 )
-  {
-    create_synapses(
-      pre_vacant_id_global, pre_vacant_n_global, post_vacant_id_global, post_vacant_n_global, sp_builder );
-  }
+  // Match vacant elements across ranks, must be called on all ranks
+  create_synapses( pre_vacant_id, pre_vacant_n, post_vacant_id, post_vacant_n, sp_builder );
 }
 
 /**
- * Dynamic creation of synapses
- * @param pre_id source id
+ * Dynamic creation of synapses. Pairs vacant pre and post synaptic elements
+ * uniformly at random across all ranks, without communicating the lists of
+ * vacant elements:
+ *
+ * 1. The ranks exchange only their numbers of vacant pre and post synaptic
+ *    elements.
+ * 2. From these numbers, every rank draws the same table of how many
+ *    elements of rank r are paired with elements of rank s, using the
+ *    global random number generator. The table follows the distribution of
+ *    a uniformly random pairing, i.e., a multivariate hypergeometric one.
+ * 3. Each rank selects and orders its participating elements by a partial
+ *    shuffle with its own random number generator and sends the sources to
+ *    the ranks of their targets in a single all-to-all exchange.
+ * 4. The ranks of the targets create the synapses.
+ *
+ * Communication is thus proportional to the number of new synapses instead
+ * of the number of vacant elements in the network. The result is
+ * deterministic for given seeds and number of processes.
+ *
+ * Must be called on all ranks.
+ * @param pre_id local source ids
  * @param pre_n number of available synaptic elements in the pre node
- * @param post_id target id
+ * @param post_id local target ids
  * @param post_n number of available synaptic elements in the post node
  * @param sp_conn_builder structural plasticity connection builder to use
  */
@@ -462,35 +472,205 @@ SPManager::create_synapses( std::vector< index >& pre_id,
   std::vector< int >& post_n,
   SPBuilder* sp_conn_builder )
 {
+  const int num_processes = kernel().mpi_manager.get_num_processes();
+  const int rank = kernel().mpi_manager.get_rank();
+
   std::vector< index > pre_id_rnd;
   std::vector< index > post_id_rnd;
-  std::vector< index >::iterator pre_it, post_it;
-
-  // shuffle the vacant element
   serialize_id( pre_id, pre_n, pre_id_rnd );
   serialize_id( post_id, post_n, post_id_rnd );
 
-  // Shuffle only the largest vector
-  if ( pre_id_rnd.size() > post_id_rnd.size() )
+  // number of vacant elements on each rank
+  std::vector< long > pre_counts( num_processes, 0 );
+  std::vector< long > post_counts( num_processes, 0 );
+  pre_counts[ rank ] = pre_id_rnd.size();
+  post_counts[ rank ] = post_id_rnd.size();
+  kernel().mpi_manager.communicate( pre_counts );
+  kernel().mpi_manager.communicate( post_counts );
+
+  const long pre_total = std::accumulate( pre_counts.begin(), pre_counts.end(), 0L );
+  const long post_total = std::accumulate( post_counts.begin(), post_counts.end(), 0L );
+  const long n_synapses = std::min( pre_total, post_total );
+  if ( n_synapses == 0 )
   {
-    // we only shuffle the n first items,
-    // where n is the number of post synaptic elements
-    global_shuffle( pre_id_rnd, post_id_rnd.size() );
-    pre_id_rnd.resize( post_id_rnd.size() );
+    return;
   }
-  else
+
+  // number of elements of each rank that take part in the new synapses
+  std::vector< long > pre_used;
+  std::vector< long > post_used;
+  select_elements_( pre_counts, n_synapses, pre_used );
+  select_elements_( post_counts, n_synapses, post_used );
+
+  // pairs[ r ][ s ] is the number of sources on rank r paired with targets
+  // on rank s
+  librandom::RngPtr grng = kernel().rng_manager.get_grng();
+  std::vector< std::vector< long > > pairs( num_processes, std::vector< long >( num_processes, 0 ) );
+  std::vector< long > post_left( post_used );
+  long post_left_total = n_synapses;
+  for ( int r = 0; r < num_processes; ++r )
+  {
+    long row_left = pre_used[ r ];
+    long population = post_left_total;
+    for ( int s = 0; s < num_processes and row_left > 0; ++s )
+    {
+      const long k = draw_hypergeometric_( grng, row_left, post_left[ s ], population );
+      population -= post_left[ s ];
+      post_left[ s ] -= k;
+      row_left -= k;
+      pairs[ r ][ s ] = k;
+    }
+    post_left_total -= pre_used[ r ];
+  }
+
+  // the first elements after a partial shuffle form a random selection in
+  // random order
+  librandom::RngPtr rng = kernel().rng_manager.get_rng( 0 );
+  partial_shuffle_( rng, pre_id_rnd, pre_used[ rank ] );
+  partial_shuffle_( rng, post_id_rnd, post_used[ rank ] );
+  pre_id_rnd.resize( pre_used[ rank ] );
+  post_id_rnd.resize( post_used[ rank ] );
+
+  std::vector< int > send_counts( num_processes );
+  std::vector< int > recv_counts( num_processes );
+  for ( int r = 0; r < num_processes; ++r )
+  {
+    send_counts[ r ] = pairs[ rank ][ r ];
+    recv_counts[ r ] = pairs[ r ][ rank ];
+  }
+
+  // The connection builder updates the synaptic elements of local sources,
+  // those of sources sent away are updated here.
+  const std::string& pre_name = sp_conn_builder->get_pre_synaptic_element_name();
+  std::vector< index >::const_iterator it = pre_id_rnd.begin();
+  for ( int r = 0; r < num_processes; ++r )
+  {
+    for ( int i = 0; i < send_counts[ r ]; ++i, ++it )
+    {
+      if ( r != rank )
+      {
+        kernel().node_manager.get_node( *it )->connect_synaptic_element( pre_name, 1 );
+      }
+    }
+  }
+
+  std::vector< index > sources;
+  kernel().mpi_manager.communicate_Alltoallv( pre_id_rnd, send_counts, sources, recv_counts );
+  assert( sources.size() == post_id_rnd.size() );
+
+  sp_conn_builder->sp_connect( GIDCollection( sources ), GIDCollection( post_id_rnd ) );
+}
+
+/**
+ * Draws how many of the n elements to be used are taken from each rank, if
+ * the elements are chosen uniformly from all ranks without replacement.
+ * Uses the global random number generator, so that all ranks obtain the same
+ * result.
+ * @param counts number of elements on each rank
+ * @param n number of elements to be used
+ * @param used number of elements to be used on each rank
+ */
+void
+SPManager::select_elements_( const std::vector< long >& counts, const long n, std::vector< long >& used )
+{
+  long total = std::accumulate( counts.begin(), counts.end(), 0L );
+  assert( n <= total );
+
+  used.assign( counts.size(), 0 );
+  if ( n == total )
+  {
+    used = counts;
+    return;
+  }
+
+  librandom::RngPtr grng = kernel().rng_manager.get_grng();
+  long n_left = n;
+  for ( size_t r = 0; r < counts.size() and n_left > 0; ++r )
+  {
+    used[ r ] = draw_hypergeometric_( grng, n_left, counts[ r ], total );
+    n_left -= used[ r ];
+    total -= counts[ r ];
+  }
+}
+
+/**
+ * Draws from the hypergeometric distribution by inversion, searching
+ * outward from the mode. The expected cost grows with the standard deviation
+ * of the distribution, not with its support.
+ * @param rng random number generator to use
+ * @param n number of draws
+ * @param K number of successes in the population
+ * @param N size of the population
+ * @return number of successes among the draws
+ */
+long
+SPManager::draw_hypergeometric_( librandom::RngPtr rng, const long n, const long K, const long N )
+{
+  assert( 0 <= n and n <= N and 0 <= K and K <= N );
+
+  const long lo = std::max( 0L, n + K - N );
+  const long hi = std::min( n, K );
+  if ( lo == hi )
   {
-    // we only shuffle the n first items,
-    // where n is the number of pre synaptic elements
-    global_shuffle( post_id_rnd, pre_id_rnd.size() );
-    post_id_rnd.resize( pre_id_rnd.size() );
+    return lo;
+  }
+
+  const long mode =
+    std::max( lo, std::min( hi, static_cast< long >( ( n + 1.0 ) * ( K + 1.0 ) / ( N + 2.0 ) ) ) );
+  const double p_mode = std::exp( log_binomial_( K, mode ) + log_binomial_( N - K, n - mode ) - log_binomial_( N, n ) );
+
+  double u = rng->drand() - p_mode;
+  long up = mode;
+  long down = mode;
+  double p_up = p_mode;
+  double p_down = p_mode;
+  while ( u >= 0 and ( up < hi or down > lo ) )
+  {
+    if ( up < hi )
+    {
+      p_up *= static_cast< double >( K - up ) * ( n - up ) / ( static_cast< double >( up + 1 ) * ( N - K - n + up + 1 ) );
+      ++up;
+      u -= p_up;
+      if ( u < 0 )
+      {
+        return up;
+      }
+    }
+    if ( down > lo )
+    {
+      p_down *=
+        static_cast< double >( down ) * ( N - K - n + down ) / ( static_cast< double >( K - down + 1 ) * ( n - down + 1 ) );
+      --down;
+      u -= p_down;
+      if ( u < 0 )
+      {
+        return down;
+      }
+    }
   }
 
-  // create synapse
-  GIDCollection sources = GIDCollection( pre_id_rnd );
-  GIDCollection targets = GIDCollection( post_id_rnd );
+  // only reached if u < p_mode, or if rounding errors exhausted the support
+  return mode;
+}
+
+double
+SPManager::log_binomial_( const long n, const long k )
+{
+  return std::lgamma( n + 1.0 ) - std::lgamma( k + 1.0 ) - std::lgamma( n - k + 1.0 );
+}
 
-  sp_conn_builder->sp_connect( sources, targets );
+/**
+ * Moves a uniformly random selection of n items of v, in random order, to
+ * the front of v.
+ */
+void
+SPManager::partial_shuffle_( librandom::RngPtr rng, std::vector< index >& v, const size_t n )
+{
+  assert( n <= v.size() );
+  for ( size_t i = 0; i < n; ++i )
+  {
+    std::swap( v[ i ], v[ i + rng->ulrand( v.size() - i ) ] );
+  }
 }
 
 /**
@@ -738,29 +918,17 @@ nest::SPManager::global_shuffle( std::vector< index >& v )
 }
 
 /*
- * Shuffles the n first items of the vector v
+ * Replaces v by a random selection of n of its items, in random order.
+ * Partial Fisher-Yates shuffle, linear in n. Uses the global random number
+ * generator, so that all ranks obtain the same result.
  */
 void
 nest::SPManager::global_shuffle( std::vector< index >& v, size_t n )
 {
   assert( n <= v.size() );
 
-  // shuffle res using the global random number generator
-  unsigned int N = v.size();
-  std::vector< index > v2;
-  index tmp;
-  unsigned int rnd;
-  std::vector< index >::iterator rndi;
-  for ( unsigned int i = 0; i < n; i++ )
-  {
-    N = v.size();
-    rnd = kernel().rng_manager.get_grng()->ulrand( N );
-    tmp = v[ rnd ];
-    v2.push_back( tmp );
-    rndi = v.begin();
-    v.erase( rndi + rnd );
-  }
-  v = v2;
+  partial_shuffle_( kernel().rng_manager.get_grng(), v, n );
+  v.resize( n );
 }
 
 
@@ -36,6 +36,9 @@
 // Includes from libnestutil:
 #include "manager_interface.h"
 
+// Includes from librandom:
+#include "randomgen.h"
+
 // Includes from nestkernel:
 #include "gid_collection.h"
 #include "growth_curve_factory.h"
@@ -160,7 +163,8 @@ public:
    */
   delay builder_max_delay() const;
 
-  // Creation of synapses
+  // Creation of synapses from the local vacant elements, collective over
+  // all ranks
   void create_synapses( std::vector< index >& pre_vacant_id,
     std::vector< int >& pre_vacant_n,
     std::vector< index >& post_vacant_id,
@@ -192,6 +196,11 @@ public:
   void global_shuffle( std::vector< index >& v, size_t n );
 
 private:
+  void select_elements_( const std::vector< long >& counts, const long n, std::vector< long >& used );
+  long draw_hypergeometric_( librandom::RngPtr rng, const long n, const long K, const long N );
+  double log_binomial_( const long n, const long k );
+  void partial_shuffle_( librandom::RngPtr rng, std::vector< index >& v, const size_t n );
+
   /**
    * Time interval for structural plasticity update (creation/deletion of
    * synapses).
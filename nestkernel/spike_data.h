@@ -45,25 +45,41 @@ enum enum_status_spike_data_id
  * Used to communicate spikes. These are the elements of the MPI
  * buffers.
  *
+ * Each entry carries up to MAX_MULTIPLICITY spikes sent by the same
+ * source to the same target at the same lag, so that spikes with
+ * multiplicity, e.g., of parrot neurons or population models, do not
+ * require an entry per spike. The multiplicity is stored minus one in
+ * bits that are otherwise padding.
+ *
  * @see TargetData
  */
 class SpikeData
 {
+public:
+  //! largest number of spikes carried by one entry
+  static constexpr unsigned int MAX_MULTIPLICITY = generate_max_value( NUM_BITS_MULTIPLICITY ) + 1;
+
 protected:
   static constexpr int MAX_LAG = generate_max_value( NUM_BITS_LAG );
 
-  index lcid_ : NUM_BITS_LCID;                       //!< local connection index
-  unsigned int marker_ : NUM_BITS_MARKER_SPIKE_DATA; //!< status flag
-  unsigned int lag_ : NUM_BITS_LAG;                  //!< lag in this min-delay interval
-  unsigned int tid_ : NUM_BITS_TID;                  //!< thread index
-  synindex syn_id_ : NUM_BITS_SYN_ID;                //!< synapse-type index
+  index lcid_ : NUM_BITS_LCID;                        //!< local connection index
+  unsigned int marker_ : NUM_BITS_MARKER_SPIKE_DATA;  //!< status flag
+  unsigned int multiplicity_ : NUM_BITS_MULTIPLICITY; //!< number of spikes minus one
+  unsigned int lag_ : NUM_BITS_LAG;                   //!< lag in this min-delay interval
+  unsigned int tid_ : NUM_BITS_TID;                   //!< thread index
+  synindex syn_id_ : NUM_BITS_SYN_ID;                 //!< synapse-type index
 
 public:
   SpikeData();
   SpikeData( const SpikeData& rhs );
   SpikeData( const thread tid, const synindex syn_id, const index lcid, const unsigned int lag );
 
-  void set( const thread tid, const synindex syn_id, const index lcid, const unsigned int lag, const double offset );
+  void set( const thread tid,
+    const synindex syn_id,
+    const index lcid,
+    const unsigned int lag,
+    const double offset,
+    const unsigned int multiplicity = 1 );
 
   /**
    * Returns local connection ID.
@@ -85,6 +101,11 @@ public:
    */
   synindex get_syn_id() const;
 
+  /**
+   * Returns number of spikes carried by this entry.
+   */
+  unsigned int get_multiplicity() const;
+
   /**
    * Resets the status flag to default value.
    */
@@ -132,6 +153,7 @@ using success_spike_data_size = StaticAssert< sizeof( SpikeData ) == 8 >::succes
 inline SpikeData::SpikeData()
   : lcid_( 0 )
   , marker_( SPIKE_DATA_ID_DEFAULT )
+  , multiplicity_( 0 )
   , lag_( 0 )
   , tid_( 0 )
   , syn_id_( 0 )
@@ -141,6 +163,7 @@ inline SpikeData::SpikeData()
 inline SpikeData::SpikeData( const SpikeData& rhs )
   : lcid_( rhs.lcid_ )
   , marker_( SPIKE_DATA_ID_DEFAULT )
+  , multiplicity_( rhs.multiplicity_ )
   , lag_( rhs.lag_ )
   , tid_( rhs.tid_ )
   , syn_id_( rhs.syn_id_ )
@@ -150,6 +173,7 @@ inline SpikeData::SpikeData( const SpikeData& rhs )
 inline SpikeData::SpikeData( const thread tid, const synindex syn_id, const index lcid, const unsigned int lag )
   : lcid_( lcid )
   , marker_( SPIKE_DATA_ID_DEFAULT )
+  , multiplicity_( 0 )
   , lag_( lag )
   , tid_( tid )
   , syn_id_( syn_id )
@@ -157,16 +181,23 @@ inline SpikeData::SpikeData( const thread tid, const synindex syn_id, const inde
 }
 
 inline void
-SpikeData::set( const thread tid, const synindex syn_id, const index lcid, const unsigned int lag, const double )
+SpikeData::set( const thread tid,
+  const synindex syn_id,
+  const index lcid,
+  const unsigned int lag,
+  const double,
+  const unsigned int multiplicity )
 {
   assert( 0 <= tid );
   assert( tid <= MAX_TID );
   assert( syn_id <= MAX_SYN_ID );
   assert( lcid <= MAX_LCID );
   assert( lag < MAX_LAG );
+  assert( 0 < multiplicity and multiplicity <= MAX_MULTIPLICITY );
 
   lcid_ = lcid;
   marker_ = SPIKE_DATA_ID_DEFAULT;
+  multiplicity_ = multiplicity - 1;
   lag_ = lag;
   tid_ = tid;
   syn_id_ = syn_id;
@@ -196,6 +227,12 @@ SpikeData::get_syn_id() const
   return syn_id_;
 }
 
+inline unsigned int
+SpikeData::get_multiplicity() const
+{
+  return multiplicity_ + 1;
+}
+
 inline void
 SpikeData::reset_marker()
 {
@@ -256,7 +293,12 @@ public:
     const index lcid,
     const unsigned int lag,
     const double offset );
-  void set( const thread tid, const synindex syn_id, const index lcid, const unsigned int lag, const double offset );
+  void set( const thread tid,
+    const synindex syn_id,
+    const index lcid,
+    const unsigned int lag,
+    const double offset,
+    const unsigned int multiplicity = 1 );
   double get_offset() const;
 };
 
@@ -284,15 +326,18 @@ OffGridSpikeData::set( const thread tid,
   const synindex syn_id,
   const index lcid,
   const unsigned int lag,
-  const double offset )
+  const double offset,
+  const unsigned int multiplicity )
 {
   assert( tid <= MAX_TID );
   assert( syn_id <= MAX_SYN_ID );
   assert( lcid <= MAX_LCID );
   assert( lag < MAX_LAG );
+  assert( 0 < multiplicity and multiplicity <= MAX_MULTIPLICITY );
 
   lcid_ = lcid;
   marker_ = SPIKE_DATA_ID_DEFAULT;
+  multiplicity_ = multiplicity - 1;
   lag_ = lag;
   tid_ = tid;
   syn_id_ = syn_id;
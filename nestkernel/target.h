@@ -279,25 +279,74 @@ Target::get_offset() const
   return 0;
 }
 
-class OffGridTarget : public Target
+/**
+ * Entry of the spike register: a Target together with the number of
+ * spikes sent to it at once, which have not yet been moved to the MPI
+ * buffers.
+ */
+class SpikeTarget : public Target
+{
+private:
+  unsigned int multiplicity_;
+
+public:
+  SpikeTarget();
+  SpikeTarget( const Target& target, const unsigned int multiplicity );
+
+  /**
+   * Return number of spikes.
+   */
+  unsigned int get_multiplicity() const;
+
+  /**
+   * Set number of spikes.
+   */
+  void set_multiplicity( const unsigned int multiplicity );
+};
+
+inline SpikeTarget::SpikeTarget()
+  : Target()
+  , multiplicity_( 1 )
+{
+}
+
+inline SpikeTarget::SpikeTarget( const Target& target, const unsigned int multiplicity )
+  : Target( target )
+  , multiplicity_( multiplicity )
+{
+}
+
+inline unsigned int
+SpikeTarget::get_multiplicity() const
+{
+  return multiplicity_;
+}
+
+inline void
+SpikeTarget::set_multiplicity( const unsigned int multiplicity )
+{
+  multiplicity_ = multiplicity;
+}
+
+class OffGridTarget : public SpikeTarget
 {
 private:
   double offset_;
 
 public:
   OffGridTarget();
-  OffGridTarget( const Target& target, const double offset );
+  OffGridTarget( const Target& target, const unsigned int multiplicity, const double offset );
   double get_offset() const;
 };
 
 inline OffGridTarget::OffGridTarget()
-  : Target()
+  : SpikeTarget()
   , offset_( 0 )
 {
 }
 
-inline OffGridTarget::OffGridTarget( const Target& target, const double offset )
-  : Target( target )
+inline OffGridTarget::OffGridTarget( const Target& target, const unsigned int multiplicity, const double offset )
+  : SpikeTarget( target, multiplicity )
   , offset_( offset )
 {
 }
@@ -20,6 +20,10 @@
  *
  */
 
+// Includes from libnestutil:
+#include "binary_io.h"
+#include "compose.hpp"
+
 // Includes from nestkernel:
 #include "connector_base.h"
 #include "kernel_manager.h"
@@ -75,6 +79,83 @@ nest::TargetTableDevices::finalize()
   std::vector< std::vector< index > >().swap( sending_devices_gids_ );
 }
 
+namespace
+{
+// writes the shape of connectors, followed by the state of all connectors
+void
+save_connectors( const std::vector< std::vector< nest::ConnectorBase* > >& connectors, std::ostream& os )
+{
+  write_binary( os, connectors.size() );
+  for ( size_t i = 0; i < connectors.size(); ++i )
+  {
+    write_binary( os, connectors[ i ].size() );
+    for ( size_t syn_id = 0; syn_id < connectors[ i ].size(); ++syn_id )
+    {
+      const bool has_connector = connectors[ i ][ syn_id ] != NULL;
+      write_binary( os, has_connector );
+      if ( has_connector )
+      {
+        try
+        {
+          connectors[ i ][ syn_id ]->save_state( os );
+        }
+        catch ( nest::CheckpointError& )
+        {
+          throw nest::CheckpointError( String::compose( "Synapse model %1 does not support checkpoints.",
+            nest::kernel().model_manager.get_synapse_prototype( syn_id ).get_name() ) );
+        }
+      }
+    }
+  }
+}
+
+void
+load_connectors( std::vector< std::vector< nest::ConnectorBase* > >& connectors, std::istream& is )
+{
+  size_t size = 0;
+  read_binary( is, size );
+  if ( size != connectors.size() )
+  {
+    throw nest::CheckpointError( "Connections to or from devices differ from checkpoint." );
+  }
+  for ( size_t i = 0; i < connectors.size(); ++i )
+  {
+    read_binary( is, size );
+    if ( size != connectors[ i ].size() )
+    {
+      throw nest::CheckpointError( "Connections to or from devices differ from checkpoint." );
+    }
+    for ( size_t syn_id = 0; syn_id < connectors[ i ].size(); ++syn_id )
+    {
+      bool has_connector = false;
+      read_binary( is, has_connector );
+      if ( has_connector != ( connectors[ i ][ syn_id ] != NULL ) )
+      {
+        throw nest::CheckpointError( "Connections to or from devices differ from checkpoint." );
+      }
+      if ( has_connector )
+      {
+        connectors[ i ][ syn_id ]->load_state( is );
+      }
+    }
+  }
+}
+}
+
+void
+nest::TargetTableDevices::save_state( const thread tid, std::ostream& os ) const
+{
+  save_connectors( target_to_devices_[ tid ], os );
+  save_connectors( target_from_devices_[ tid ], os );
+}
+
+void
+nest::TargetTableDevices::load_state( const thread tid, std::istream& is )
+{
+  load_connectors( target_to_devices_[ tid ], is );
+  load_connectors( target_from_devices_[ tid ], is );
+}
+
 void
 nest::TargetTableDevices::resize_to_number_of_neurons()
 {
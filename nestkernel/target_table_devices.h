@@ -25,6 +25,7 @@
 
 // C++ includes:
 #include <cassert>
+#include <iosfwd>
 #include <map>
 #include <vector>
 
@@ -112,6 +113,11 @@ public:
    */
   void send_from_device( const thread tid, const index ldid, Event& e, const std::vector< ConnectorModel* >& cm );
 
+  /**
+   * Returns the number of targets of the source device.
+   */
+  size_t get_num_targets_from_device( const thread tid, const index ldid ) const;
+
   /**
    * Resizes vectors according to number of local nodes.
    */
@@ -199,6 +205,17 @@ public:
     ConnectorModel& cm,
     const DictionaryDatum& dict,
     const index lcid );
+
+  /**
+   * Writes the state of all connections between neurons and devices on
+   * thread tid to a binary stream.
+   */
+  void save_state( const thread tid, std::ostream& os ) const;
+
+  /**
+   * Reads the state written by save_state() from a binary stream.
+   */
+  void load_state( const thread tid, std::istream& is );
 };
 
 inline void
@@ -219,7 +236,7 @@ TargetTableDevices::set_synapse_status_from_device( const thread tid,
   const DictionaryDatum& dict,
   const index lcid )
 {
-  target_from_devices_[ tid ][ ldid ][ syn_id ]->set_synapse_status( lcid, dict, cm );
+  target_from_devices_[ tid ][ ldid ][ syn_id ]->set_synapse_status( tid, lcid, dict, cm );
 }
 
 inline void
@@ -239,6 +256,22 @@ TargetTableDevices::send_from_device( const thread tid,
   }
 }
 
+inline size_t
+TargetTableDevices::get_num_targets_from_device( const thread tid, const index ldid ) const
+{
+  size_t num_targets = 0;
+  for ( std::vector< ConnectorBase* >::const_iterator it = target_from_devices_[ tid ][ ldid ].begin();
+        it != target_from_devices_[ tid ][ ldid ].end();
+        ++it )
+  {
+    if ( *it != NULL )
+    {
+      num_targets += ( *it )->size();
+    }
+  }
+  return num_targets;
+}
+
 } // namespace nest
 
 #endif
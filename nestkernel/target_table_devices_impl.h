@@ -132,7 +132,7 @@ nest::TargetTableDevices::set_synapse_status_to_device( const thread tid,
   const index lid = kernel().vp_manager.gid_to_lid( source_gid );
   if ( target_to_devices_[ tid ][ lid ][ syn_id ] != NULL )
   {
-    target_to_devices_[ tid ][ lid ][ syn_id ]->set_synapse_status( lcid, dict, cm );
+    target_to_devices_[ tid ][ lid ][ syn_id ]->set_synapse_status( tid, lcid, dict, cm );
   }
 }
 
@@ -154,6 +154,9 @@ public:
    */
   void record_data( long );
 
+  //! True if at least one multimeter records from the node
+  bool has_data_loggers() const;
+
   //! Erase all existing data
   void reset();
 
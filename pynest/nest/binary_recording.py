@@ -0,0 +1,190 @@
+# -*- coding: utf-8 -*-
+#
+# binary_recording.py
+#
+# This file is part of NEST.
+#
+# Copyright (C) 2004 The NEST Initiative
+#
+# NEST is free software: you can redistribute it and/or modify
+# it under the terms of the GNU General Public License as published by
+# the Free Software Foundation, either version 2 of the License, or
+# (at your option) any later version.
+#
+# NEST is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+#
+# You should have received a copy of the GNU General Public License
+# along with NEST.  If not, see <http://www.gnu.org/licenses/>.
+
+"""Functions for reading files written by recording devices with
+record_to [/binary_file].
+
+The data is memory-mapped, not copied, so that files larger than the
+memory of the machine can be analyzed. See the documentation of
+RecordingDevice for the file format.
+
+Example
+-------
+>>> sd = nest.Create('spike_detector',
+...                  params={'to_binary_file': True, 'to_memory': False,
+...                          'withgid': True})
+>>> ...
+>>> for data in nest.binary_recording.from_device(sd):
+...     print(data['senders'], data['steps'])
+"""
+
+import os
+import struct
+
+import numpy
+
+import nest
+
+__all__ = [
+    'from_device',
+    'load',
+    'read_header',
+    'times',
+]
+
+_MAGIC = b'NESTBIN\x00'
+_BYTE_ORDER_MARK = 0x01020304
+_VERSION = 1
+
+# magic, byte order mark, version, header size, record size, resolution,
+# gid, vp
+_FIXED_FIELDS = '8sIIQQdQQ'
+
+
+def read_header(fname):
+    """Read the header of a binary recording file.
+
+    Parameters
+    ----------
+    fname : str
+        Name of the file
+
+    Returns
+    -------
+    dict
+        Header fields byte_order ('<' or '>'), version, header_size,
+        record_size, resolution, gid, vp and columns, a list of
+        (name, type) tuples with numpy type codes
+
+    Raises
+    ------
+    ValueError
+        If the file is not a binary recording file of a known version
+    """
+    with open(fname, 'rb') as f:
+        fixed_size = struct.calcsize('<' + _FIXED_FIELDS)
+        fixed = f.read(fixed_size)
+        if len(fixed) < fixed_size or fixed[:8] != _MAGIC:
+            raise ValueError("'%s' is not a binary recording file." % fname)
+
+        for byte_order in '<>':
+            fields = struct.unpack(byte_order + _FIXED_FIELDS, fixed)
+            if fields[1] == _BYTE_ORDER_MARK:
+                break
+        else:
+            raise ValueError("Unknown byte order in '%s'." % fname)
+
+        if fields[2] != _VERSION:
+            raise ValueError("Unsupported version %d of '%s'." %
+                             (fields[2], fname))
+
+        header_size = fields[3]
+        columns = f.read(header_size - fixed_size).split(b'\x00')[0]
+
+    return {
+        'byte_order': byte_order,
+        'version': fields[2],
+        'header_size': header_size,
+        'record_size': fields[4],
+        'resolution': fields[5],
+        'gid': fields[6],
+        'vp': fields[7],
+        'columns': [tuple(c.split(':')) for c in
+                    columns.decode('ascii').split()],
+    }
+
+
+def load(fname):
+    """Memory-map the records of a binary recording file.
+
+    Parameters
+    ----------
+    fname : str
+        Name of the file
+
+    Returns
+    -------
+    numpy.ndarray
+        Read-only structured array with one field per column. Records
+        truncated by an interrupted simulation are ignored.
+    """
+    header = read_header(fname)
+    dtype = numpy.dtype([(name, header['byte_order'] + code)
+                         for name, code in header['columns']])
+    if dtype.itemsize != header['record_size']:
+        raise ValueError("Inconsistent record size in '%s'." % fname)
+
+    n_records = 0
+    if dtype.itemsize > 0:
+        n_records = ((os.path.getsize(fname) - header['header_size']) //
+                     dtype.itemsize)
+    if n_records == 0:
+        # numpy cannot map an empty range
+        return numpy.zeros(0, dtype=dtype)
+
+    return numpy.memmap(fname, dtype=dtype, mode='r',
+                        offset=header['header_size'], shape=(n_records,))
+
+
+def times(data, resolution):
+    """Compute the times of records in ms.
+
+    Parameters
+    ----------
+    data : numpy.ndarray
+        Records as returned by load()
+    resolution : float
+        Simulation resolution in ms, see read_header()
+
+    Returns
+    -------
+    numpy.ndarray
+        Times in ms, taking offsets into account if they were recorded
+    """
+    t = data['steps'] * resolution
+    if 'offsets' in data.dtype.names:
+        t -= data['offsets']
+    return t
+
+
+def from_device(device):
+    """Memory-map the binary files of a recording device.
+
+    Parameters
+    ----------
+    device : list
+        GID of the recording device, as list with one element
+
+    Returns
+    -------
+    list(numpy.ndarray)
+        Records as returned by load(), one array per local thread
+    """
+    if len(device) != 1:
+        raise nest.kernel.NESTError("Please provide a single device.")
+
+    status = nest.GetStatus(device)[0]
+    if not status.get('to_binary_file', False):
+        raise nest.kernel.NESTError("The device does not record to binary "
+                                    "file.")
+
+    return [load(f) for f in status.get('filenames', [])
+            if f.endswith('.bin')]
@@ -26,6 +26,7 @@ Functions to get information on NEST.
 import sys
 import os
 import webbrowser
+import numpy
 
 from ..ll_api import *
 from .hl_api_helper import *
@@ -34,11 +35,14 @@ __all__ = [
     'authors',
     'get_argv',
     'GetStatus',
+    'GetValues',
     'help',
     'helpdesk',
     'message',
     'SetStatus',
+    'SetValues',
     'sysinfo',
+    'TakeEvents',
     'version',
 ]
 
@@ -334,3 +338,146 @@ def GetStatus(nodes, keys=None, output=''):
         result = to_json(result)
 
     return result
+
+
+@check_stack
+def GetValues(nodes, key):
+    """Return one numeric property of nodes as an array.
+
+    This is equivalent to ``GetStatus(nodes, key)``, but reads the values
+    of all nodes in one call into the kernel and returns them as one
+    array instead of creating a dictionary for each node.
+
+    Parameters
+    ----------
+    nodes : list or tuple
+        List of global ids of nodes
+    key : str
+        Name of a state variable or parameter of type float
+
+    Returns
+    -------
+    numpy.ndarray or array.array :
+        One value per node. Values of nodes that are not local to this
+        MPI process are NaN.
+
+    Raises
+    ------
+    TypeError
+        If `nodes` or `key` are on the wrong form.
+
+    See Also
+    --------
+    SetValues, GetStatus
+
+    """
+
+    if not is_coercible_to_sli_array(nodes):
+        raise TypeError("nodes must be a list of nodes")
+
+    if not is_literal(key):
+        raise TypeError("key must be a string")
+
+    if len(nodes) == 0:
+        return numpy.array([], dtype=float)
+
+    sps(nodes)
+    sr('cvgidcollection')
+    sr('/{0} GetValues'.format(key))
+
+    return spp()
+
+
+@check_stack
+def SetValues(nodes, key, values):
+    """Set one numeric property of nodes from an array.
+
+    This is equivalent to ``SetStatus(nodes, key, values)``, but sets the
+    values of all nodes in one call into the kernel instead of creating a
+    dictionary for each node.
+
+    Parameters
+    ----------
+    nodes : list or tuple
+        List of global ids of nodes
+    key : str
+        Name of a state variable or parameter of type float
+    values : float or list or numpy.ndarray
+        A single value for all nodes, or one value per node
+
+    Raises
+    ------
+    TypeError
+        If `nodes` or `key` are on the wrong form.
+    ValueError
+        If the number of values does not match the number of nodes.
+
+    See Also
+    --------
+    GetValues, SetStatus
+
+    """
+
+    if not is_coercible_to_sli_array(nodes):
+        raise TypeError("nodes must be a list of nodes")
+
+    if not is_literal(key):
+        raise TypeError("key must be a string")
+
+    if len(nodes) == 0:
+        return
+
+    if not is_iterable(values):
+        values = len(nodes) * (values, )
+    elif len(values) != len(nodes):
+        raise ValueError("values must be a single value or a list with "
+                         "one value per node")
+
+    sps(nodes)
+    sr('cvgidcollection')
+    sr('/{0}'.format(key))
+    sps(values)
+    sr('SetValues')
+
+
+@check_stack
+def TakeEvents(nodes):
+    """Take the events recorded by recording devices.
+
+    Unlike ``GetStatus(nodes, 'events')``, the events are removed from
+    the devices, which continue recording into empty buffers. As the
+    devices no longer refer to the events, the arrays of the events are
+    handed over without copying them.
+
+    Parameters
+    ----------
+    nodes : list or tuple
+        List of global ids of recording devices
+
+    Returns
+    -------
+    list of dicts :
+        The events of each device, with one writable array per recorded
+        quantity
+
+    Raises
+    ------
+    TypeError
+        If `nodes` is on the wrong form.
+
+    See Also
+    --------
+    GetStatus
+
+    """
+
+    if not is_coercible_to_sli_array(nodes):
+        raise TypeError("nodes must be a list of nodes")
+
+    events = []
+    for node in nodes:
+        sps(node)
+        sr('TakeEvents')
+        events.append(spp(view_vectors=True))
+
+    return events
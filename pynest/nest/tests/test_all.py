@@ -72,6 +72,7 @@ from . import test_status
 from . import test_stdp_multiplicity
 from . import test_stdp_nn_synapses
 from . import test_stdp_triplet_synapse
+from . import test_take_events
 from . import test_threads
 from . import test_use_gid_in_filename
 from . import test_vogels_sprekeler_synapse
@@ -130,6 +131,7 @@ def suite():
     suite.addTest(test_status.suite())
     suite.addTest(test_stdp_multiplicity.suite())
     suite.addTest(test_stdp_triplet_synapse.suite())
+    suite.addTest(test_take_events.suite())
     suite.addTest(test_threads.suite())
     suite.addTest(test_use_gid_in_filename.suite())
     suite.addTest(test_vogels_sprekeler_synapse.suite())
@@ -0,0 +1,146 @@
+# -*- coding: utf-8 -*-
+#
+# test_take_events.py
+#
+# This file is part of NEST.
+#
+# Copyright (C) 2004 The NEST Initiative
+#
+# NEST is free software: you can redistribute it and/or modify
+# it under the terms of the GNU General Public License as published by
+# the Free Software Foundation, either version 2 of the License, or
+# (at your option) any later version.
+#
+# NEST is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+#
+# You should have received a copy of the GNU General Public License
+# along with NEST.  If not, see <http://www.gnu.org/licenses/>.
+
+
+"""
+Tests of reading and taking events from recording devices
+"""
+
+import unittest
+import nest
+
+from . import compatibility
+
+try:
+    import numpy
+    HAVE_NUMPY = True
+except ImportError:
+    HAVE_NUMPY = False
+
+
+@nest.ll_api.check_stack
+class TakeEventsTestCase(unittest.TestCase):
+    """Tests of TakeEvents and of the arrays holding events"""
+
+    def setUp(self):
+
+        nest.ResetKernel()
+        nest.set_verbosity('M_ERROR')
+
+        self.neurons = nest.Create('iaf_psc_alpha', 4, {'I_e': 500.})
+        self.sd_ref = nest.Create('spike_detector')
+        self.sd = nest.Create('spike_detector')
+
+        nest.Connect(self.neurons, self.sd_ref)
+        nest.Connect(self.neurons, self.sd)
+
+    def events(self, sd):
+
+        return nest.GetStatus(sd, 'events')[0]
+
+    def test_GetStatusKeepsEvents(self):
+        """Reading the events with GetStatus does not remove them"""
+
+        nest.Simulate(100.)
+        times = list(self.events(self.sd)['times'])
+
+        self.assertTrue(len(times) > 0)
+        self.assertEqual(nest.GetStatus(self.sd, 'n_events')[0], len(times))
+        self.assertEqual(list(self.events(self.sd)['times']), times)
+
+    def test_TakeEvents(self):
+        """Events are returned only once by TakeEvents"""
+
+        nest.Simulate(100.)
+        times_1 = list(nest.TakeEvents(self.sd)[0]['times'])
+
+        self.assertTrue(len(times_1) > 0)
+        self.assertEqual(nest.GetStatus(self.sd, 'n_events')[0], 0)
+        self.assertEqual(len(nest.TakeEvents(self.sd)[0]['times']), 0)
+
+        nest.Simulate(100.)
+        times_2 = list(nest.TakeEvents(self.sd)[0]['times'])
+
+        self.assertTrue(len(times_2) > 0)
+        self.assertTrue(min(times_2) > max(times_1))
+
+        times_ref = list(self.events(self.sd_ref)['times'])
+        self.assertEqual(times_1 + times_2, times_ref)
+
+    def test_TakeEventsNoRecorder(self):
+        """TakeEvents fails for nodes that do not record events"""
+
+        self.assertRaisesRegex(nest.kernel.NESTError, "RecorderExpected",
+                               nest.TakeEvents, self.neurons[:1])
+
+    @unittest.skipIf(not HAVE_NUMPY, 'NumPy package is not available')
+    def test_EventsWritable(self):
+        """Events are returned as writable arrays owned by the caller"""
+
+        nest.Simulate(100.)
+        times_ref = list(self.events(self.sd_ref)['times'])
+
+        for events in (self.events(self.sd_ref),
+                       nest.TakeEvents(self.sd)[0]):
+            times = events['times']
+            self.assertTrue(isinstance(times, numpy.ndarray))
+            self.assertTrue(len(times) > 0)
+            self.assertTrue(times.flags.writeable)
+
+            times -= 100.
+            self.assertEqual(list(times), [t - 100. for t in times_ref])
+
+        # the events stored in the device are unchanged
+        self.assertEqual(list(self.events(self.sd_ref)['times']), times_ref)
+
+    @unittest.skipIf(not HAVE_NUMPY, 'NumPy package is not available')
+    def test_EventsOutliveDevice(self):
+        """Arrays of taken events remain valid after the device is reset"""
+
+        nest.Simulate(100.)
+        events = nest.TakeEvents(self.sd)[0]
+        expected = [list(events['times']), list(events['senders'])]
+
+        # destroy the device
+        nest.ResetKernel()
+
+        # build and simulate another network, which reuses the memory
+        # freed by ResetKernel
+        neurons = nest.Create('iaf_psc_alpha', 10, {'I_e': 1000.})
+        sd = nest.Create('spike_detector')
+        nest.Connect(neurons, sd)
+        nest.Simulate(100.)
+        self.assertTrue(len(self.events(sd)['times']) > 0)
+
+        self.assertEqual(list(events['times']), expected[0])
+        self.assertEqual(list(events['senders']), expected[1])
+
+
+def suite():
+
+    suite = unittest.makeSuite(TakeEventsTestCase, 'test')
+    return suite
+
+
+if __name__ == "__main__":
+
+    runner = unittest.TextTestRunner(verbosity=2)
+    runner.run(suite())
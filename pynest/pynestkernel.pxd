@@ -96,9 +96,11 @@ cdef extern from "arraydatum.h":
 
     cppclass IntVectorDatum:
         IntVectorDatum(vector[long]*) except +
+        IntVectorDatum(const IntVectorDatum&) except +
 
     cppclass DoubleVectorDatum:
         DoubleVectorDatum(vector[double]*) except +
+        DoubleVectorDatum(const DoubleVectorDatum&) except +
 
 cdef extern from "dict.h":
     cppclass Dictionary:
@@ -106,6 +106,67 @@ cdef class SLIDatum(object):
         self.thisptr = dat
 
 
+cdef class SLIVectorBuffer(object):
+    """Buffer exporting the data of an IntVectorDatum or DoubleVectorDatum.
+
+    The buffer holds a copy of the datum, which shares the underlying
+    vector with the original datum, such that NumPy arrays created from
+    the buffer view the data of the vector without copying it.
+
+    The buffer is only created for vectors that are owned by the result
+    of the popped datum alone, such as the events handed over by
+    TakeEvents. Once the datum is popped, no other datum refers to the
+    vector, so the buffer and the arrays viewing it are writable.
+    """
+
+    cdef Datum* thisptr
+    cdef void* data
+    cdef const char* format
+    cdef Py_ssize_t itemsize
+    cdef Py_ssize_t shape[1]
+    cdef Py_ssize_t strides[1]
+
+    def __cinit__(self):
+
+        self.thisptr = NULL
+        self.data = NULL
+        self.format = NULL
+        self.itemsize = 0
+        self.shape[0] = 0
+        self.strides[0] = 0
+
+    def __dealloc__(self):
+
+        if self.thisptr is not NULL:
+            del self.thisptr
+
+    def __getbuffer__(self, Py_buffer* buffer, int flags):
+
+        buffer.buf = self.data
+        buffer.obj = self
+        buffer.len = self.shape[0] * self.itemsize
+        buffer.readonly = 0
+        buffer.itemsize = self.itemsize
+        buffer.format = <char*> self.format
+        buffer.ndim = 1
+        buffer.shape = self.shape
+        buffer.strides = self.strides
+        buffer.suboffsets = NULL
+        buffer.internal = NULL
+
+    def __releasebuffer__(self, Py_buffer* buffer):
+        pass
+
+    cdef _set_datum(self, Datum* dat, void* data, size_t size, Py_ssize_t itemsize, const char* format):
+
+        self.thisptr = dat
+        self.data = data
+        self.format = format
+        self.itemsize = itemsize
+        self.shape[0] = size
+        self.strides[0] = itemsize
+
+
 cdef class SLILiteral(object):
 
     cdef readonly object name
@@ -220,7 +281,14 @@ cdef class NESTEngine(object):
             raise NESTErrors.PyNESTError("engine uninitialized")
         self.pEngine.OStack.push(python_object_to_datum(obj))
 
-    def pop(self):
+    def pop(self, view_vectors=False):
+        """Pop the top of the interpreter stack and convert it.
+
+        If `view_vectors` is true, NumPy arrays view the data of integer
+        and double vectors instead of copying them. This must only be
+        requested if the vectors are not referred to from anywhere but
+        the popped datum, e.g. for the result of TakeEvents.
+        """
 
         if self.pEngine is NULL:
             raise NESTErrors.PyNESTError("engine uninitialized")
@@ -230,7 +298,7 @@ cdef class NESTEngine(object):
 
         cdef Datum* dat = (addr_tok(self.pEngine.OStack.top())).datum()
 
-        ret = sli_datum_to_object(dat)
+        ret = sli_datum_to_object(dat, view_vectors)
 
         self.pEngine.OStack.pop()
 
@@ -378,7 +446,7 @@ cdef inline Datum* python_buffer_to_datum(numeric_buffer_t buff, vector_value_t
     return <Datum*> dat
 
 
-cdef inline object sli_datum_to_object(Datum* dat):
+cdef inline object sli_datum_to_object(Datum* dat, bint view_vectors=False):
 
     if dat is NULL:
         raise NESTErrors.PyNESTError("datum is a null pointer")
@@ -400,15 +468,15 @@ cdef inline object sli_datum_to_object(Datum* dat):
         obj_str = (<LiteralDatum*> dat).toString()
         ret = SLILiteral(obj_str.decode())
     elif datum_type == SLI_TYPE_ARRAY:
-        ret = sli_array_to_object(<ArrayDatum*> dat)
+        ret = sli_array_to_object(<ArrayDatum*> dat, view_vectors)
     elif datum_type == SLI_TYPE_DICTIONARY:
-        ret = sli_dict_to_object(<DictionaryDatum*> dat)
+        ret = sli_dict_to_object(<DictionaryDatum*> dat, view_vectors)
     elif datum_type == SLI_TYPE_CONNECTION:
         ret = sli_connection_to_object(<ConnectionDatum*> dat)
     elif datum_type == SLI_TYPE_VECTOR_INT:
-        ret = sli_vector_to_object[sli_vector_int_ptr_t, long](<IntVectorDatum*> dat)
+        ret = sli_vector_to_object[sli_vector_int_ptr_t, long](<IntVectorDatum*> dat, view_vectors)
     elif datum_type == SLI_TYPE_VECTOR_DOUBLE:
-        ret = sli_vector_to_object[sli_vector_double_ptr_t, double](<DoubleVectorDatum*> dat)
+        ret = sli_vector_to_object[sli_vector_double_ptr_t, double](<DoubleVectorDatum*> dat, view_vectors)
     elif datum_type == SLI_TYPE_MASK:
         ret = SLIDatum()
         (<SLIDatum> ret)._set_datum(<Datum*> new MaskDatum(deref(<MaskDatum*> dat)), SLI_TYPE_MASK.decode())
@@ -423,7 +491,7 @@ cdef inline object sli_datum_to_object(Datum* dat):
 
     return ret
 
-cdef inline object sli_array_to_object(ArrayDatum* dat):
+cdef inline object sli_array_to_object(ArrayDatum* dat, bint view_vectors):
 
     # the size of dat has to be explicitly cast to int to avoid
     # compiler warnings (#1318) during cythonization
@@ -437,12 +505,12 @@ cdef inline object sli_array_to_object(ArrayDatum* dat):
     n = len(tmp)
 
     for i in range(n):
-        tmp[i] = sli_datum_to_object(tok.datum())
+        tmp[i] = sli_datum_to_object(tok.datum(), view_vectors)
         inc(tok)
 
     return tuple(tmp)
 
-cdef inline object sli_dict_to_object(DictionaryDatum* dat):
+cdef inline object sli_dict_to_object(DictionaryDatum* dat, bint view_vectors):
 
     cdef tmp = {}
 
@@ -454,7 +522,7 @@ cdef inline object sli_dict_to_object(DictionaryDatum* dat):
     while dt != deref_dict(dat).end():
         key_str = deref_tmap(dt).first.toString()
         tok = &deref_tmap(dt).second
-        tmp[key_str.decode()] = sli_datum_to_object(tok.datum())
+        tmp[key_str.decode()] = sli_datum_to_object(tok.datum(), view_vectors)
         inc(dt)
 
     return tmp
@@ -474,26 +542,46 @@ cdef inline object sli_connection_to_object(ConnectionDatum* dat):
 
     return arr
 
-cdef inline object sli_vector_to_object(sli_vector_ptr_t dat, vector_value_t _ = 0):
+cdef inline object sli_vector_to_object(sli_vector_ptr_t dat, bint view_vectors, vector_value_t _ = 0):
 
     cdef vector_value_t* array_data = NULL
     cdef vector[vector_value_t]* vector_ptr = NULL
+    cdef SLIVectorBuffer buf
 
     if sli_vector_ptr_t is sli_vector_int_ptr_t and vector_value_t is long:
         vector_ptr = deref_ivector(dat)
-        arr = array.clone(ARRAY_LONG, vector_ptr.size(), False)
-        array_data = arr.data.as_longs
         if HAVE_NUMPY:
             ret_dtype = numpy.int_
     elif sli_vector_ptr_t is sli_vector_double_ptr_t and vector_value_t is double:
         vector_ptr = deref_dvector(dat)
-        arr = array.clone(ARRAY_DOUBLE, vector_ptr.size(), False)
-        array_data = arr.data.as_doubles
         if HAVE_NUMPY:
             ret_dtype = numpy.float_
     else:
         raise NESTErrors.PyNESTError("unsupported specialization")
 
+    if HAVE_NUMPY and view_vectors:
+        if vector_ptr.size() > 0:
+            # view the data of the vector through a buffer holding a
+            # reference to it, instead of copying the data
+            buf = SLIVectorBuffer()
+            if sli_vector_ptr_t is sli_vector_int_ptr_t:
+                buf._set_datum(<Datum*> new IntVectorDatum(deref(dat)), &vector_ptr.front(),
+                               vector_ptr.size(), sizeof(long), "l")
+            else:
+                buf._set_datum(<Datum*> new DoubleVectorDatum(deref(dat)), &vector_ptr.front(),
+                               vector_ptr.size(), sizeof(double), "d")
+            return numpy.frombuffer(buf, dtype=ret_dtype)
+        else:
+            # Compatibility with NumPy < 1.7.0
+            return numpy.array([], dtype=ret_dtype)
+
+    if sli_vector_ptr_t is sli_vector_int_ptr_t:
+        arr = array.clone(ARRAY_LONG, vector_ptr.size(), False)
+        array_data = <vector_value_t*> arr.data.as_longs
+    else:
+        arr = array.clone(ARRAY_DOUBLE, vector_ptr.size(), False)
+        array_data = <vector_value_t*> arr.data.as_doubles
+
     memcpy(array_data, &vector_ptr.front(), vector_ptr.size() * sizeof(vector_value_t))
 
     if HAVE_NUMPY:
@@ -35,6 +35,7 @@
 #include "sliexceptions.h"
 
 const Token Dictionary::VoidToken;
+unsigned long Dictionary::num_dictstack_changes_ = 0;
 
 Dictionary::~Dictionary()
 {
@@ -53,8 +54,9 @@ Token& Dictionary::operator[]( const char* n )
 void
 Dictionary::clear()
 {
-  TokenMap cp( *this );
-  TokenMap::clear();
+  entries_changed_();
+  TokenMap cp;
+  TokenMap::swap( cp );
 
   for ( TokenMap::iterator i = cp.begin(); i != cp.end(); ++i )
   {
@@ -79,9 +81,8 @@ Dictionary::info( std::ostream& out ) const
   if ( size() > 0 )
   {
     // copy to vector and sort
-    typedef std::vector< std::pair< Name, Token > > DataVec;
-    DataVec data;
-    std::copy( begin(), end(), std::inserter( data, data.begin() ) );
+    typedef std::vector< TokenMap::value_type > DataVec;
+    DataVec data( begin(), end() );
     std::sort( data.begin(), data.end(), DictItemLexicalOrder() );
 
     out << "--------------------------------------------------" << std::endl;
@@ -26,7 +26,8 @@
     SLI's dictionary class
 */
 // C++ includes:
-#include <map>
+#include <algorithm>
+#include <vector>
 
 // Includes from sli:
 #include "name.h"
@@ -34,7 +35,275 @@
 #include "token.h"
 
 
-typedef std::map< Name, Token, std::less< Name > > TokenMap;
+/**
+ * Flat map associating names with tokens.
+ *
+ * Entries are stored in a vector sorted by the handles of their names.
+ * Lookups thus do not chase pointers and inserting an entry does not
+ * allocate memory unless the vector grows. Iteration visits the entries
+ * in the same order as a std::map< Name, Token > would. Small maps, such
+ * as most parameter dictionaries, are searched linearly, larger ones by
+ * bisection.
+ *
+ * @note Inserting and erasing entries invalidates iterators and references
+ * to entries behind the position of the change, and to all entries if the
+ * vector grows.
+ * @ingroup TokenHandling
+ */
+class TokenMap
+{
+public:
+  /**
+   * Entry of a TokenMap.
+   * Moving an entry hands over the datum and the access flag of its token,
+   * while copying the entry copies both. Tokens themselves do not preserve
+   * the access flag, and copying a token clones datums that are not
+   * reference counted.
+   */
+  struct value_type
+  {
+    Name first;
+    Token second;
+
+    explicit value_type( const Name& n )
+      : first( n )
+      , second()
+    {
+      second.clear_access_flag();
+    }
+
+    value_type( const Name& n, const Token& t )
+      : first( n )
+      , second( t )
+    {
+      second.clear_access_flag();
+    }
+
+    value_type( const value_type& e )
+      : first( e.first )
+      , second( e.second )
+    {
+      copy_access_flag_( e );
+    }
+
+    value_type( value_type&& e ) noexcept
+      : first( e.first )
+      , second()
+    {
+      second.swap( e.second );
+      copy_access_flag_( e );
+    }
+
+    value_type& operator=( const value_type& e )
+    {
+      first = e.first;
+      second = e.second;
+      copy_access_flag_( e );
+      return *this;
+    }
+
+    value_type& operator=( value_type&& e ) noexcept
+    {
+      first = e.first;
+      second.swap( e.second );
+      copy_access_flag_( e );
+      return *this;
+    }
+
+    bool operator==( const value_type& e ) const
+    {
+      return first == e.first and second == e.second;
+    }
+
+  private:
+    void
+    copy_access_flag_( const value_type& e )
+    {
+      if ( e.second.accessed() )
+      {
+        second.set_access_flag();
+      }
+      else
+      {
+        second.clear_access_flag();
+      }
+    }
+  };
+
+  typedef std::vector< value_type >::iterator iterator;
+  typedef std::vector< value_type >::const_iterator const_iterator;
+
+  iterator
+  begin()
+  {
+    return entries_.begin();
+  }
+
+  iterator
+  end()
+  {
+    return entries_.end();
+  }
+
+  const_iterator
+  begin() const
+  {
+    return entries_.begin();
+  }
+
+  const_iterator
+  end() const
+  {
+    return entries_.end();
+  }
+
+  size_t
+  size() const
+  {
+    return entries_.size();
+  }
+
+  bool
+  empty() const
+  {
+    return entries_.empty();
+  }
+
+  void
+  clear()
+  {
+    entries_.clear();
+  }
+
+  void
+  swap( TokenMap& m )
+  {
+    entries_.swap( m.entries_ );
+  }
+
+  /**
+   * Return iterator to the first entry whose name is not less than n.
+   */
+  iterator
+  lower_bound( const Name& n )
+  {
+    return lower_bound_( begin(), end(), n );
+  }
+
+  const_iterator
+  lower_bound( const Name& n ) const
+  {
+    return lower_bound_( begin(), end(), n );
+  }
+
+  iterator
+  find( const Name& n )
+  {
+    const iterator where = lower_bound( n );
+    return ( where != end() and where->first == n ) ? where : end();
+  }
+
+  const_iterator
+  find( const Name& n ) const
+  {
+    const const_iterator where = lower_bound( n );
+    return ( where != end() and where->first == n ) ? where : end();
+  }
+
+  /**
+   * Return token with given name, inserting an empty token if the name is
+   * not in the map.
+   */
+  Token& operator[]( const Name& n )
+  {
+    iterator where = lower_bound( n );
+    if ( where == end() or where->first != n )
+    {
+      where = insert( where, value_type( n ) );
+    }
+    return where->second;
+  }
+
+  /**
+   * Insert entry before the given position.
+   * The position must be lower_bound() of the name of the entry, and the
+   * name must not be in the map.
+   */
+  iterator
+  insert( iterator where, value_type&& e )
+  {
+    if ( entries_.capacity() == 0 )
+    {
+      // avoid growing the vector entry by entry in small maps
+      entries_.reserve( initial_capacity );
+      entries_.push_back( std::move( e ) );
+      return begin();
+    }
+    return entries_.insert( where, std::move( e ) );
+  }
+
+  /**
+   * Return true if inserting an entry before the given position moves
+   * other entries, i.e., invalidates references to them.
+   */
+  bool
+  insert_moves_entries( const_iterator where ) const
+  {
+    return not entries_.empty() and ( where != end() or entries_.size() == entries_.capacity() );
+  }
+
+  iterator
+  erase( iterator where )
+  {
+    return entries_.erase( where );
+  }
+
+  /**
+   * Erase entry with given name.
+   * @returns number of erased entries
+   */
+  size_t
+  erase( const Name& n )
+  {
+    const iterator where = find( n );
+    if ( where == end() )
+    {
+      return 0;
+    }
+    entries_.erase( where );
+    return 1;
+  }
+
+private:
+  //! Maps with at most this many entries are searched linearly.
+  static const size_t max_linear_search_size = 16;
+
+  //! Number of entries for which memory is reserved on the first insertion.
+  static const size_t initial_capacity = 8;
+
+  template < typename Iterator >
+  static Iterator
+  lower_bound_( Iterator first, Iterator last, const Name& n )
+  {
+    if ( static_cast< size_t >( last - first ) <= max_linear_search_size )
+    {
+      while ( first != last and first->first < n )
+      {
+        ++first;
+      }
+      return first;
+    }
+    return std::lower_bound( first, last, n, less_name_ );
+  }
+
+  static bool
+  less_name_( const value_type& e, const Name& n )
+  {
+    return e.first < n;
+  }
+
+  std::vector< value_type > entries_;
+};
 
 inline bool operator==( const TokenMap& x, const TokenMap& y )
 {
@@ -60,7 +329,7 @@ class Dictionary : private TokenMap
     static bool nocase_compare( char c1, char c2 );
 
   public:
-    bool operator()( const std::pair< Name, Token >& lhs, const std::pair< Name, Token >& rhs ) const
+    bool operator()( const TokenMap::value_type& lhs, const TokenMap::value_type& rhs ) const
     {
       const std::string& ls = lhs.first.toString();
       const std::string& rs = rhs.first.toString();
@@ -81,7 +350,6 @@ public:
   }
   ~Dictionary();
 
-  using TokenMap::erase;
   using TokenMap::size;
   using TokenMap::begin;
   using TokenMap::end;
@@ -90,6 +358,11 @@ public:
 
   void clear();
 
+  iterator erase( iterator );
+
+  //! Erase entry with given name and return the number of erased entries
+  size_t erase( const Name& );
+
   /**
    * Lookup and return Token with given name in dictionary.
    * If the name is not found, an empty token is returned.
@@ -184,7 +457,7 @@ public:
 
   /**
    * Constant iterator for dictionary.
-   * Dictionary inherits privately from std::map to hide implementation
+   * Dictionary inherits privately from TokenMap to hide implementation
    * details. To allow for inspection of all elements in a dictionary,
    * we export the constant iterator type and begin() and end() methods.
    */
@@ -192,7 +465,7 @@ public:
 
   /**
    * First element in dictionary.
-   * Dictionary inherits privately from std::map to hide implementation
+   * Dictionary inherits privately from TokenMap to hide implementation
    * details. To allow for inspection of all elements in a dictionary,
    * we export the constant iterator type and begin() and end() methods.
    */
@@ -200,7 +473,7 @@ public:
 
   /**
    * One-past-last element in dictionary.
-   * Dictionary inherits privately from std::map to hide implementation
+   * Dictionary inherits privately from TokenMap to hide implementation
    * details. To allow for inspection of all elements in a dictionary,
    * we export the constant iterator type and begin() and end() methods.
    */
@@ -243,6 +516,18 @@ public:
     return refs_on_dictstack_ > 0;
   }
 
+  /**
+   * Returns the number of changes to dictionaries on the dictionary stack
+   * that moved or removed entries. The dictionary stack caches pointers to
+   * tokens in these dictionaries and must discard them when this number
+   * changes.
+   */
+  static unsigned long
+  num_dictstack_changes()
+  {
+    return num_dictstack_changes_;
+  }
+
 
 private:
   /**
@@ -258,6 +543,18 @@ private:
 
   int refs_on_dictstack_;
   bool all_accessed_( std::string&, std::string prefix = std::string() ) const;
+
+  //! Called before entries of the dictionary are moved or removed.
+  void
+  entries_changed_()
+  {
+    if ( is_on_dictstack() )
+    {
+      ++num_dictstack_changes_;
+    }
+  }
+
+  static unsigned long num_dictstack_changes_;
   static const Token VoidToken;
 };
 
@@ -320,7 +617,20 @@ Dictionary::known_but_not_accessed( const Name& n ) const
 inline Token&
 Dictionary::insert( const Name& n, const Token& t )
 {
-  return TokenMap::operator[]( n ) = t;
+  TokenMap::iterator where = TokenMap::lower_bound( n );
+  if ( where != end() and where->first == n )
+  {
+    return where->second = t;
+  }
+
+  // t may refer to an entry of this dictionary, so we copy it before the
+  // insertion moves the entries
+  value_type entry( n, t );
+  if ( insert_moves_entries( where ) )
+  {
+    entries_changed_();
+  }
+  return TokenMap::insert( where, std::move( entry ) )->second;
 }
 
 
@@ -340,15 +650,54 @@ inline const Token& Dictionary::operator[]( const Name& n ) const
 
 inline Token& Dictionary::operator[]( const Name& n )
 {
-  return TokenMap::operator[]( n );
+  TokenMap::iterator where = TokenMap::lower_bound( n );
+  if ( where == end() or where->first != n )
+  {
+    if ( insert_moves_entries( where ) )
+    {
+      entries_changed_();
+    }
+    where = TokenMap::insert( where, value_type( n ) );
+  }
+  return where->second;
 }
 
 inline Token&
 Dictionary::insert_move( const Name& n, Token& t )
 {
-  Token& result = TokenMap::operator[]( n );
-  result.move( t );
-  return result;
+  TokenMap::iterator where = TokenMap::lower_bound( n );
+  if ( where != end() and where->first == n )
+  {
+    where->second.move( t );
+    return where->second;
+  }
+
+  value_type entry( n );
+  entry.second.move( t );
+  if ( insert_moves_entries( where ) )
+  {
+    entries_changed_();
+  }
+  return TokenMap::insert( where, std::move( entry ) )->second;
+}
+
+inline Dictionary::iterator
+Dictionary::erase( iterator where )
+{
+  entries_changed_();
+  return TokenMap::erase( where );
+}
+
+inline size_t
+Dictionary::erase( const Name& n )
+{
+  const TokenMap::iterator where = find( n );
+  if ( where == end() )
+  {
+    return 0;
+  }
+  erase( where );
+  return 1;
 }
 
 
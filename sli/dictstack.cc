@@ -24,12 +24,18 @@
 
 DictionaryStack::DictionaryStack( const Token& t )
   : VoidToken( t )
+#ifdef DICTSTACK_CACHE
+  , cached_dictstack_changes_( Dictionary::num_dictstack_changes() )
+#endif
 {
 }
 
 DictionaryStack::DictionaryStack( const DictionaryStack& ds )
   : VoidToken( ds.VoidToken )
   , d( ds.d )
+#ifdef DICTSTACK_CACHE
+  , cached_dictstack_changes_( Dictionary::num_dictstack_changes() )
+#endif
 {
 }
 
@@ -224,6 +230,7 @@ const DictionaryStack& DictionaryStack::operator=( const DictionaryStack& ds )
     d = ds.d;
 #ifdef DICTSTACK_CACHE
     cache_ = ds.cache_;
+    cached_dictstack_changes_ = ds.cached_dictstack_changes_;
 #endif
   }
   return *this;
@@ -27,6 +27,7 @@
 */
 
 // C++ includes:
+#include <algorithm>
 #include <list>
 #include <typeinfo>
 
@@ -77,6 +78,9 @@ private:
 #ifdef DICTSTACK_CACHE
   std::vector< const Token* > cache_;
   std::vector< const Token* > basecache_;
+
+  //! Value of Dictionary::num_dictstack_changes() when the caches were valid
+  unsigned long cached_dictstack_changes_;
 #endif
 
 public:
@@ -159,6 +163,23 @@ public:
     }
   }
 
+  /**
+   * Clear cache and basecache if entries of dictionaries on the stack have
+   * been moved or removed since they were filled, as the cached pointers
+   * may then be invalid.
+   * This must be called before the caches are read.
+   */
+  void
+  validate_caches()
+  {
+    if ( cached_dictstack_changes_ != Dictionary::num_dictstack_changes() )
+    {
+      clear_cache();
+      std::fill( basecache_.begin(), basecache_.end(), static_cast< const Token* >( 0 ) );
+      cached_dictstack_changes_ = Dictionary::num_dictstack_changes();
+    }
+  }
+
 #endif
 
   const Token&
@@ -178,6 +199,7 @@ public:
   lookup2( const Name& n )
   {
 #ifdef DICTSTACK_CACHE
+    validate_caches();
     Name::handle_t key = n.toIndex();
     if ( key < cache_.size() )
     {
@@ -213,6 +235,7 @@ public:
   const Token& baselookup( const Name& n ) // lookup in a specified
   {                                        // base dictionary
 #ifdef DICTSTACK_CACHE
+    validate_caches();
     Name::handle_t key = n.toIndex();
     if ( key < basecache_.size() )
     {
@@ -245,6 +268,7 @@ public:
   known( const Name& n )
   {
 #ifdef DICTSTACK_CACHE
+    validate_caches();
     Name::handle_t key = n.toIndex();
     if ( key < cache_.size() )
     {
@@ -277,6 +301,7 @@ public:
   bool baseknown( const Name& n ) // lookup in a specified
   {                               // base dictionary
 #ifdef DICTSTACK_CACHE
+    validate_caches();
     Name::handle_t key = n.toIndex();
     if ( key < basecache_.size() )
     {
@@ -90,6 +90,44 @@ provide_property( DictionaryDatum& d, Name propname, const std::vector< long >&
                                             // since that implies prop.empty()
 }
 
+void
+move_property( DictionaryDatum& d, Name propname, std::vector< double >& prop )
+{
+  Token t = d->lookup2( propname );
+
+  DoubleVectorDatum* arrd = dynamic_cast< DoubleVectorDatum* >( t.datum() );
+  assert( arrd != 0 );
+
+  if ( ( *arrd )->empty() ) // no data from before, take over storage
+  {
+    ( *arrd )->swap( prop );
+  }
+  else
+  {
+    ( *arrd )->insert( ( *arrd )->end(), prop.begin(), prop.end() );
+  }
+  std::vector< double >().swap( prop );
+}
+
+void
+move_property( DictionaryDatum& d, Name propname, std::vector< long >& prop )
+{
+  Token t = d->lookup2( propname );
+
+  IntVectorDatum* arrd = dynamic_cast< IntVectorDatum* >( t.datum() );
+  assert( arrd != 0 );
+
+  if ( ( *arrd )->empty() ) // no data from before, take over storage
+  {
+    ( *arrd )->swap( prop );
+  }
+  else
+  {
+    ( *arrd )->insert( ( *arrd )->end(), prop.begin(), prop.end() );
+  }
+  std::vector< long >().swap( prop );
+}
+
 void
 accumulate_property( DictionaryDatum& d, Name propname, const std::vector< double >& prop )
 {
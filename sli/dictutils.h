@@ -363,6 +363,23 @@ void provide_property( DictionaryDatum&, Name, const std::vector< double >& );
 void provide_property( DictionaryDatum&, Name, const std::vector< long >& );
 
 
+/** Move the values of a vector<double> to a property DoubleVectorDatum in the
+ * dictionary. If the property is empty, it takes over the storage of the
+ * vector without copying, otherwise the values are appended. The vector is
+ * left empty in either case.
+ * @ingroup DictUtils
+ */
+void move_property( DictionaryDatum&, Name, std::vector< double >& );
+
+/** Move the values of a vector<long> to a property IntVectorDatum in the
+ * dictionary. If the property is empty, it takes over the storage of the
+ * vector without copying, otherwise the values are appended. The vector is
+ * left empty in either case.
+ * @ingroup DictUtils
+ */
+void move_property( DictionaryDatum&, Name, std::vector< long >& );
+
+
 /** Add values of a vector<double> to a property DoubleVectorDatum in the
  * dictionary. This variant of append_property is for adding vector<double>s to
  * vector<double>s of the same size. It is required for collecting data across
@@ -32,6 +32,7 @@
 #include "binomial_randomdev.h"
 
 // Includes from nestkernel:
+#include "exceptions.h"
 #include "kernel_manager.h"
 #include "nest.h"
 
@@ -284,6 +285,11 @@ ConnectionCreator::source_driven_connect_( Layer< D >& source, Layer< D >& targe
     }
   }
 
+  // Targets are connected in parallel, each thread handling the targets
+  // on that thread; exceptions are collected and rethrown after the
+  // parallel region.
+  std::vector< lockPTR< WrappedThreadException > > exceptions_raised( kernel().vp_manager.get_num_threads() );
+
   if ( mask_.valid() )
   {
 
@@ -291,128 +297,177 @@ ConnectionCreator::source_driven_connect_( Layer< D >& source, Layer< D >& targe
     // mask is mirrored so it may be applied to the source layer instead
     MaskedLayer< D > masked_layer( source, source_filter_, mask_, true, allow_oversized_, target );
 
-    for ( std::vector< Node* >::const_iterator tgt_it = target_begin; tgt_it != target_end; ++tgt_it )
+#pragma omp parallel
     {
-
-      if ( target_filter_.select_model() && ( ( *tgt_it )->get_model_id() != target_filter_.model ) )
-      {
-        continue;
-      }
-
-      index target_id = ( *tgt_it )->get_gid();
-      thread target_thread = ( *tgt_it )->get_thread();
-      librandom::RngPtr rng = get_vp_rng( target_thread );
-      Position< D > target_pos = target.get_position( ( *tgt_it )->get_subnet_index() );
-
-      // If there is a kernel, we create connections conditionally,
-      // otherwise all sources within the mask are created. Test moved
-      // outside the loop for efficiency.
-      if ( kernel_.valid() )
+      const thread thread_id = kernel().vp_manager.get_thread_id();
+      try
       {
-
-        for ( typename Ntree< D, index >::masked_iterator iter = masked_layer.begin( target_pos );
-              iter != masked_layer.end();
-              ++iter )
+        for ( std::vector< Node* >::const_iterator tgt_it = target_begin; tgt_it != target_end; ++tgt_it )
         {
-
-          if ( ( not allow_autapses_ ) and ( iter->second == target_id ) )
+          // each thread connects only the targets it owns, so that each
+          // random number generator is used in the same order as in a
+          // serial run
+          if ( ( *tgt_it )->get_thread() != thread_id )
           {
             continue;
           }
 
-          if ( rng->drand() < kernel_->value( target.compute_displacement( iter->first, target_pos ), rng ) )
+          if ( target_filter_.select_model() && ( ( *tgt_it )->get_model_id() != target_filter_.model ) )
           {
-            double w, d;
-            get_parameters_( target.compute_displacement( iter->first, target_pos ), rng, w, d );
-            kernel().connection_manager.connect(
-              iter->second, *tgt_it, target_thread, synapse_model_, dummy_param_, d, w );
+            continue;
           }
-        }
-      }
-      else
-      {
 
-        // no kernel
+          index target_id = ( *tgt_it )->get_gid();
+          thread target_thread = ( *tgt_it )->get_thread();
+          librandom::RngPtr rng = get_vp_rng( target_thread );
+          Position< D > target_pos = target.get_position( ( *tgt_it )->get_subnet_index() );
 
-        for ( typename Ntree< D, index >::masked_iterator iter = masked_layer.begin( target_pos );
-              iter != masked_layer.end();
-              ++iter )
-        {
+          // If there is a kernel, we create connections conditionally,
+          // otherwise all sources within the mask are created. Test moved
+          // outside the loop for efficiency.
+          if ( kernel_.valid() )
+          {
 
-          if ( ( not allow_autapses_ ) and ( iter->second == target_id ) )
+            for ( typename Ntree< D, index >::masked_iterator iter = masked_layer.begin( target_pos );
+                  iter != masked_layer.end();
+                  ++iter )
+            {
+
+              if ( ( not allow_autapses_ ) and ( iter->second == target_id ) )
+              {
+                continue;
+              }
+
+              if ( rng->drand() < kernel_->value( target.compute_displacement( iter->first, target_pos ), rng ) )
+              {
+                double w, d;
+                get_parameters_( target.compute_displacement( iter->first, target_pos ), rng, w, d );
+                kernel().connection_manager.connect(
+                  iter->second, *tgt_it, target_thread, synapse_model_, dummy_param_, d, w );
+              }
+            }
+          }
+          else
           {
-            continue;
+
+            // no kernel
+
+            for ( typename Ntree< D, index >::masked_iterator iter = masked_layer.begin( target_pos );
+                  iter != masked_layer.end();
+                  ++iter )
+            {
+
+              if ( ( not allow_autapses_ ) and ( iter->second == target_id ) )
+              {
+                continue;
+              }
+              double w, d;
+              get_parameters_( target.compute_displacement( iter->first, target_pos ), rng, w, d );
+              kernel().connection_manager.connect(
+                iter->second, *tgt_it, target_thread, synapse_model_, dummy_param_, d, w );
+            }
           }
-          double w, d;
-          get_parameters_( target.compute_displacement( iter->first, target_pos ), rng, w, d );
-          kernel().connection_manager.connect(
-            iter->second, *tgt_it, target_thread, synapse_model_, dummy_param_, d, w );
         }
       }
-    }
+      catch ( std::exception& err )
+      {
+        // We must create a new exception here, err's lifetime ends at
+        // the end of the catch block.
+        exceptions_raised.at( thread_id ) = lockPTR< WrappedThreadException >( new WrappedThreadException( err ) );
+      }
+    } // omp parallel
   }
   else
   {
     // no mask
 
     std::vector< std::pair< Position< D >, index > >* positions = source.get_global_positions_vector( source_filter_ );
-    for ( std::vector< Node* >::const_iterator tgt_it = target_begin; tgt_it != target_end; ++tgt_it )
+#pragma omp parallel
     {
-
-      if ( target_filter_.select_model() && ( ( *tgt_it )->get_model_id() != target_filter_.model ) )
-      {
-        continue;
-      }
-
-      index target_id = ( *tgt_it )->get_gid();
-      thread target_thread = ( *tgt_it )->get_thread();
-      librandom::RngPtr rng = get_vp_rng( target_thread );
-      Position< D > target_pos = target.get_position( ( *tgt_it )->get_subnet_index() );
-
-      // If there is a kernel, we create connections conditionally,
-      // otherwise all sources within the mask are created. Test moved
-      // outside the loop for efficiency.
-      if ( kernel_.valid() )
+      const thread thread_id = kernel().vp_manager.get_thread_id();
+      try
       {
-
-        for ( typename std::vector< std::pair< Position< D >, index > >::iterator iter = positions->begin();
-              iter != positions->end();
-              ++iter )
+        for ( std::vector< Node* >::const_iterator tgt_it = target_begin; tgt_it != target_end; ++tgt_it )
         {
-
-          if ( ( not allow_autapses_ ) and ( iter->second == target_id ) )
+          // each thread connects only the targets it owns, so that each
+          // random number generator is used in the same order as in a
+          // serial run
+          if ( ( *tgt_it )->get_thread() != thread_id )
           {
             continue;
           }
 
-          if ( rng->drand() < kernel_->value( target.compute_displacement( iter->first, target_pos ), rng ) )
+          if ( target_filter_.select_model() && ( ( *tgt_it )->get_model_id() != target_filter_.model ) )
           {
-            double w, d;
-            get_parameters_( target.compute_displacement( iter->first, target_pos ), rng, w, d );
-            kernel().connection_manager.connect(
-              iter->second, *tgt_it, target_thread, synapse_model_, dummy_param_, d, w );
+            continue;
           }
-        }
-      }
-      else
-      {
 
-        for ( typename std::vector< std::pair< Position< D >, index > >::iterator iter = positions->begin();
-              iter != positions->end();
-              ++iter )
-        {
+          index target_id = ( *tgt_it )->get_gid();
+          thread target_thread = ( *tgt_it )->get_thread();
+          librandom::RngPtr rng = get_vp_rng( target_thread );
+          Position< D > target_pos = target.get_position( ( *tgt_it )->get_subnet_index() );
 
-          if ( ( not allow_autapses_ ) and ( iter->second == target_id ) )
+          // If there is a kernel, we create connections conditionally,
+          // otherwise all sources within the mask are created. Test moved
+          // outside the loop for efficiency.
+          if ( kernel_.valid() )
           {
-            continue;
+
+            for ( typename std::vector< std::pair< Position< D >, index > >::iterator iter = positions->begin();
+                  iter != positions->end();
+                  ++iter )
+            {
+
+              if ( ( not allow_autapses_ ) and ( iter->second == target_id ) )
+              {
+                continue;
+              }
+
+              if ( rng->drand() < kernel_->value( target.compute_displacement( iter->first, target_pos ), rng ) )
+              {
+                double w, d;
+                get_parameters_( target.compute_displacement( iter->first, target_pos ), rng, w, d );
+                kernel().connection_manager.connect(
+                  iter->second, *tgt_it, target_thread, synapse_model_, dummy_param_, d, w );
+              }
+            }
           }
+          else
+          {
 
-          double w, d;
-          get_parameters_( target.compute_displacement( iter->first, target_pos ), rng, w, d );
-          kernel().connection_manager.connect(
-            iter->second, *tgt_it, target_thread, synapse_model_, dummy_param_, d, w );
+            for ( typename std::vector< std::pair< Position< D >, index > >::iterator iter = positions->begin();
+                  iter != positions->end();
+                  ++iter )
+            {
+
+              if ( ( not allow_autapses_ ) and ( iter->second == target_id ) )
+              {
+                continue;
+              }
+
+              double w, d;
+              get_parameters_( target.compute_displacement( iter->first, target_pos ), rng, w, d );
+              kernel().connection_manager.connect(
+                iter->second, *tgt_it, target_thread, synapse_model_, dummy_param_, d, w );
+            }
+          }
         }
       }
+      catch ( std::exception& err )
+      {
+        // We must create a new exception here, err's lifetime ends at
+        // the end of the catch block.
+        exceptions_raised.at( thread_id ) = lockPTR< WrappedThreadException >( new WrappedThreadException( err ) );
+      }
+    } // omp parallel
+  }
+
+  // check if any exceptions have been raised
+  for ( thread tid = 0; tid < kernel().vp_manager.get_num_threads(); ++tid )
+  {
+    if ( exceptions_raised.at( tid ).valid() )
+    {
+      throw WrappedThreadException( *( exceptions_raised.at( tid ) ) );
     }
   }
 }
@@ -462,123 +517,171 @@ ConnectionCreator::convergent_connect_( Layer< D >& source, Layer< D >& target )
     }
   }
 
+  // Targets are connected in parallel, each thread handling the targets
+  // on that thread; exceptions are collected and rethrown after the
+  // parallel region.
+  std::vector< lockPTR< WrappedThreadException > > exceptions_raised( kernel().vp_manager.get_num_threads() );
+
   if ( mask_.valid() )
   {
     MaskedLayer< D > masked_source( source, source_filter_, mask_, true, allow_oversized_ );
 
-    for ( std::vector< Node* >::const_iterator tgt_it = target_begin; tgt_it != target_end; ++tgt_it )
+#pragma omp parallel
     {
-
-      if ( target_filter_.select_model() && ( ( *tgt_it )->get_model_id() != target_filter_.model ) )
+      const thread thread_id = kernel().vp_manager.get_thread_id();
+      try
       {
-        continue;
-      }
-
-      index target_id = ( *tgt_it )->get_gid();
-      thread target_thread = ( *tgt_it )->get_thread();
-      librandom::RngPtr rng = get_vp_rng( target_thread );
-      Position< D > target_pos = target.get_position( ( *tgt_it )->get_subnet_index() );
-
-      // Get (position,GID) pairs for sources inside mask
-      const Position< D > anchor = target.get_position( ( *tgt_it )->get_subnet_index() );
-      std::vector< std::pair< Position< D >, index > > positions;
-      for ( typename Ntree< D, index >::masked_iterator iter = masked_source.begin( anchor );
-            iter != masked_source.end();
-            ++iter )
-      {
-        positions.push_back( *iter );
-      }
-
-      // We will select `number_of_connections_` sources within the mask.
-      // If there is no kernel, we can just draw uniform random numbers,
-      // but with a kernel we have to set up a probability distribution
-      // function using the Vose class.
-      if ( kernel_.valid() )
-      {
-
-        std::vector< double > probabilities;
-
-        // Collect probabilities for the sources
-        for ( typename std::vector< std::pair< Position< D >, index > >::iterator iter = positions.begin();
-              iter != positions.end();
-              ++iter )
-        {
-
-          probabilities.push_back( kernel_->value( source.compute_displacement( target_pos, iter->first ), rng ) );
-        }
-
-        if ( positions.empty()
-          or ( ( not allow_autapses_ ) and ( positions.size() == 1 ) and ( positions[ 0 ].second == target_id ) )
-          or ( ( not allow_multapses_ ) and ( positions.size() < number_of_connections_ ) ) )
-        {
-          std::string msg = String::compose( "Global target ID %1: Not enough sources found inside mask", target_id );
-          throw KernelException( msg.c_str() );
-        }
-
-        // A Vose object draws random integers with a non-uniform
-        // distribution.
-        Vose lottery( probabilities );
-
-        // If multapses are not allowed, we must keep track of which
-        // sources have been selected already.
-        std::vector< bool > is_selected( positions.size() );
-
-        // Draw `number_of_connections_` sources
-        for ( int i = 0; i < ( int ) number_of_connections_; ++i )
+        // The sources inside the mask are found for batches of targets at
+        // once
+        const size_t batch_size = 64;
+        std::vector< Node* > targets;
+        std::vector< Position< D > > anchors;
+        std::vector< typename Ntree< D, index >::masked_iterator > sources;
+
+        std::vector< Node* >::const_iterator tgt_it = target_begin;
+        while ( tgt_it != target_end )
         {
-          index random_id = lottery.get_random_id( rng );
-          if ( ( not allow_multapses_ ) and ( is_selected[ random_id ] ) )
+          targets.clear();
+          anchors.clear();
+          for ( ; ( tgt_it != target_end ) and ( targets.size() < batch_size ); ++tgt_it )
           {
-            --i;
-            continue;
+            // each thread connects only the targets it owns, so that each
+            // random number generator is used in the same order as in a
+            // serial run
+            if ( ( *tgt_it )->get_thread() != thread_id )
+            {
+              continue;
+            }
+
+            if ( target_filter_.select_model() && ( ( *tgt_it )->get_model_id() != target_filter_.model ) )
+            {
+              continue;
+            }
+
+            targets.push_back( *tgt_it );
+            anchors.push_back( target.get_position( ( *tgt_it )->get_subnet_index() ) );
           }
+          sources = masked_source.begin( anchors );
 
-          index source_id = positions[ random_id ].second;
-          if ( ( not allow_autapses_ ) and ( source_id == target_id ) )
+          for ( size_t t = 0; t < targets.size(); ++t )
           {
-            --i;
-            continue;
+            Node* const tgt = targets[ t ];
+            index target_id = tgt->get_gid();
+            thread target_thread = tgt->get_thread();
+            librandom::RngPtr rng = get_vp_rng( target_thread );
+            const Position< D >& target_pos = anchors[ t ];
+
+            // Get (position,GID) pairs for sources inside mask
+            std::vector< std::pair< Position< D >, index > > positions;
+            for ( typename Ntree< D, index >::masked_iterator iter = sources[ t ]; iter != masked_source.end(); ++iter )
+            {
+              positions.push_back( *iter );
+            }
+
+            // We will select `number_of_connections_` sources within the mask.
+            // If there is no kernel, we can just draw uniform random numbers,
+            // but with a kernel we have to set up a probability distribution
+            // function using the Vose class.
+            if ( kernel_.valid() )
+            {
+
+              std::vector< double > probabilities;
+
+              // Collect probabilities for the sources
+              for ( typename std::vector< std::pair< Position< D >, index > >::iterator iter = positions.begin();
+                    iter != positions.end();
+                    ++iter )
+              {
+
+                probabilities.push_back(
+                  kernel_->value( source.compute_displacement( target_pos, iter->first ), rng ) );
+              }
+
+              if ( positions.empty()
+                or ( ( not allow_autapses_ ) and ( positions.size() == 1 ) and ( positions[ 0 ].second == target_id ) )
+                or ( ( not allow_multapses_ ) and ( positions.size() < number_of_connections_ ) ) )
+              {
+                std::string msg =
+                  String::compose( "Global target ID %1: Not enough sources found inside mask", target_id );
+                throw KernelException( msg.c_str() );
+              }
+
+              // A Vose object draws random integers with a non-uniform
+              // distribution.
+              Vose lottery( probabilities );
+
+              // If multapses are not allowed, we must keep track of which
+              // sources have been selected already.
+              std::vector< bool > is_selected( positions.size() );
+
+              // Draw `number_of_connections_` sources
+              for ( int i = 0; i < ( int ) number_of_connections_; ++i )
+              {
+                index random_id = lottery.get_random_id( rng );
+                if ( ( not allow_multapses_ ) and ( is_selected[ random_id ] ) )
+                {
+                  --i;
+                  continue;
+                }
+
+                index source_id = positions[ random_id ].second;
+                if ( ( not allow_autapses_ ) and ( source_id == target_id ) )
+                {
+                  --i;
+                  continue;
+                }
+                double w, d;
+                get_parameters_( source.compute_displacement( target_pos, positions[ random_id ].first ), rng, w, d );
+                kernel().connection_manager.connect(
+                  source_id, tgt, target_thread, synapse_model_, dummy_param_, d, w );
+                is_selected[ random_id ] = true;
+              }
+            }
+            else
+            {
+
+              // no kernel
+
+              if ( positions.empty()
+                or ( ( not allow_autapses_ ) and ( positions.size() == 1 ) and ( positions[ 0 ].second == target_id ) )
+                or ( ( not allow_multapses_ ) and ( positions.size() < number_of_connections_ ) ) )
+              {
+                std::string msg =
+                  String::compose( "Global target ID %1: Not enough sources found inside mask", target_id );
+                throw KernelException( msg.c_str() );
+              }
+
+              // If multapses are not allowed, we must keep track of which
+              // sources have been selected already.
+              std::vector< bool > is_selected( positions.size() );
+
+              // Draw `number_of_connections_` sources
+              for ( int i = 0; i < ( int ) number_of_connections_; ++i )
+              {
+                index random_id = rng->ulrand( positions.size() );
+                if ( ( not allow_multapses_ ) and ( is_selected[ random_id ] ) )
+                {
+                  --i;
+                  continue;
+                }
+                index source_id = positions[ random_id ].second;
+                double w, d;
+                get_parameters_( source.compute_displacement( target_pos, positions[ random_id ].first ), rng, w, d );
+                kernel().connection_manager.connect(
+                  source_id, tgt, target_thread, synapse_model_, dummy_param_, d, w );
+                is_selected[ random_id ] = true;
+              }
+            }
           }
-          double w, d;
-          get_parameters_( source.compute_displacement( target_pos, positions[ random_id ].first ), rng, w, d );
-          kernel().connection_manager.connect( source_id, *tgt_it, target_thread, synapse_model_, dummy_param_, d, w );
-          is_selected[ random_id ] = true;
         }
       }
-      else
+      catch ( std::exception& err )
       {
-
-        // no kernel
-
-        if ( positions.empty()
-          or ( ( not allow_autapses_ ) and ( positions.size() == 1 ) and ( positions[ 0 ].second == target_id ) )
-          or ( ( not allow_multapses_ ) and ( positions.size() < number_of_connections_ ) ) )
-        {
-          std::string msg = String::compose( "Global target ID %1: Not enough sources found inside mask", target_id );
-          throw KernelException( msg.c_str() );
-        }
-
-        // If multapses are not allowed, we must keep track of which
-        // sources have been selected already.
-        std::vector< bool > is_selected( positions.size() );
-
-        // Draw `number_of_connections_` sources
-        for ( int i = 0; i < ( int ) number_of_connections_; ++i )
-        {
-          index random_id = rng->ulrand( positions.size() );
-          if ( ( not allow_multapses_ ) and ( is_selected[ random_id ] ) )
-          {
-            --i;
-            continue;
-          }
-          index source_id = positions[ random_id ].second;
-          double w, d;
-          get_parameters_( source.compute_displacement( target_pos, positions[ random_id ].first ), rng, w, d );
-          kernel().connection_manager.connect( source_id, *tgt_it, target_thread, synapse_model_, dummy_param_, d, w );
-          is_selected[ random_id ] = true;
-        }
+        // We must create a new exception here, err's lifetime ends at
+        // the end of the catch block.
+        exceptions_raised.at( thread_id ) = lockPTR< WrappedThreadException >( new WrappedThreadException( err ) );
       }
-    }
+    } // omp parallel
   }
   else
   {
@@ -587,109 +690,141 @@ ConnectionCreator::convergent_connect_( Layer< D >& source, Layer< D >& target )
     // Get (position,GID) pairs for all nodes in source layer
     std::vector< std::pair< Position< D >, index > >* positions = source.get_global_positions_vector( source_filter_ );
 
-    for ( std::vector< Node* >::const_iterator tgt_it = target_begin; tgt_it != target_end; ++tgt_it )
+#pragma omp parallel
     {
-
-      if ( target_filter_.select_model() && ( ( *tgt_it )->get_model_id() != target_filter_.model ) )
+      const thread thread_id = kernel().vp_manager.get_thread_id();
+      try
       {
-        continue;
-      }
-
-      index target_id = ( *tgt_it )->get_gid();
-      thread target_thread = ( *tgt_it )->get_thread();
-      librandom::RngPtr rng = get_vp_rng( target_thread );
-      Position< D > target_pos = target.get_position( ( *tgt_it )->get_subnet_index() );
-
-      if ( ( positions->size() == 0 )
-        or ( ( not allow_autapses_ ) and ( positions->size() == 1 ) and ( ( *positions )[ 0 ].second == target_id ) )
-        or ( ( not allow_multapses_ ) and ( positions->size() < number_of_connections_ ) ) )
-      {
-        std::string msg = String::compose( "Global target ID %1: Not enough sources found", target_id );
-        throw KernelException( msg.c_str() );
-      }
-
-      // We will select `number_of_connections_` sources within the mask.
-      // If there is no kernel, we can just draw uniform random numbers,
-      // but with a kernel we have to set up a probability distribution
-      // function using the Vose class.
-      if ( kernel_.valid() )
-      {
-
-        std::vector< double > probabilities;
-
-        // Collect probabilities for the sources
-        for ( typename std::vector< std::pair< Position< D >, index > >::iterator iter = positions->begin();
-              iter != positions->end();
-              ++iter )
+        for ( std::vector< Node* >::const_iterator tgt_it = target_begin; tgt_it != target_end; ++tgt_it )
         {
-          probabilities.push_back( kernel_->value( source.compute_displacement( target_pos, iter->first ), rng ) );
-        }
-
-        // A Vose object draws random integers with a non-uniform
-        // distribution.
-        Vose lottery( probabilities );
-
-        // If multapses are not allowed, we must keep track of which
-        // sources have been selected already.
-        std::vector< bool > is_selected( positions->size() );
-
-        // Draw `number_of_connections_` sources
-        for ( int i = 0; i < ( int ) number_of_connections_; ++i )
-        {
-          index random_id = lottery.get_random_id( rng );
-          if ( ( not allow_multapses_ ) and ( is_selected[ random_id ] ) )
+          // each thread connects only the targets it owns, so that each
+          // random number generator is used in the same order as in a
+          // serial run
+          if ( ( *tgt_it )->get_thread() != thread_id )
           {
-            --i;
             continue;
           }
 
-          index source_id = ( *positions )[ random_id ].second;
-          if ( ( not allow_autapses_ ) and ( source_id == target_id ) )
+          if ( target_filter_.select_model() && ( ( *tgt_it )->get_model_id() != target_filter_.model ) )
           {
-            --i;
             continue;
           }
 
-          Position< D > source_pos = ( *positions )[ random_id ].first;
-          double w, d;
-          get_parameters_( source.compute_displacement( target_pos, source_pos ), rng, w, d );
-          kernel().connection_manager.connect( source_id, *tgt_it, target_thread, synapse_model_, dummy_param_, d, w );
-          is_selected[ random_id ] = true;
-        }
-      }
-      else
-      {
-
-        // no kernel
+          index target_id = ( *tgt_it )->get_gid();
+          thread target_thread = ( *tgt_it )->get_thread();
+          librandom::RngPtr rng = get_vp_rng( target_thread );
+          Position< D > target_pos = target.get_position( ( *tgt_it )->get_subnet_index() );
 
-        // If multapses are not allowed, we must keep track of which
-        // sources have been selected already.
-        std::vector< bool > is_selected( positions->size() );
-
-        // Draw `number_of_connections_` sources
-        for ( int i = 0; i < ( int ) number_of_connections_; ++i )
-        {
-          index random_id = rng->ulrand( positions->size() );
-          if ( ( not allow_multapses_ ) and ( is_selected[ random_id ] ) )
+          if ( ( positions->size() == 0 )
+            or ( ( not allow_autapses_ ) and ( positions->size() == 1 )
+                 and ( ( *positions )[ 0 ].second == target_id ) )
+            or ( ( not allow_multapses_ ) and ( positions->size() < number_of_connections_ ) ) )
           {
-            --i;
-            continue;
+            std::string msg = String::compose( "Global target ID %1: Not enough sources found", target_id );
+            throw KernelException( msg.c_str() );
           }
 
-          index source_id = ( *positions )[ random_id ].second;
-          if ( ( not allow_autapses_ ) and ( source_id == target_id ) )
+          // We will select `number_of_connections_` sources within the mask.
+          // If there is no kernel, we can just draw uniform random numbers,
+          // but with a kernel we have to set up a probability distribution
+          // function using the Vose class.
+          if ( kernel_.valid() )
           {
-            --i;
-            continue;
+
+            std::vector< double > probabilities;
+
+            // Collect probabilities for the sources
+            for ( typename std::vector< std::pair< Position< D >, index > >::iterator iter = positions->begin();
+                  iter != positions->end();
+                  ++iter )
+            {
+              probabilities.push_back( kernel_->value( source.compute_displacement( target_pos, iter->first ), rng ) );
+            }
+
+            // A Vose object draws random integers with a non-uniform
+            // distribution.
+            Vose lottery( probabilities );
+
+            // If multapses are not allowed, we must keep track of which
+            // sources have been selected already.
+            std::vector< bool > is_selected( positions->size() );
+
+            // Draw `number_of_connections_` sources
+            for ( int i = 0; i < ( int ) number_of_connections_; ++i )
+            {
+              index random_id = lottery.get_random_id( rng );
+              if ( ( not allow_multapses_ ) and ( is_selected[ random_id ] ) )
+              {
+                --i;
+                continue;
+              }
+
+              index source_id = ( *positions )[ random_id ].second;
+              if ( ( not allow_autapses_ ) and ( source_id == target_id ) )
+              {
+                --i;
+                continue;
+              }
+
+              Position< D > source_pos = ( *positions )[ random_id ].first;
+              double w, d;
+              get_parameters_( source.compute_displacement( target_pos, source_pos ), rng, w, d );
+              kernel().connection_manager.connect(
+                source_id, *tgt_it, target_thread, synapse_model_, dummy_param_, d, w );
+              is_selected[ random_id ] = true;
+            }
           }
+          else
+          {
 
-          Position< D > source_pos = ( *positions )[ random_id ].first;
-          double w, d;
-          get_parameters_( source.compute_displacement( target_pos, source_pos ), rng, w, d );
-          kernel().connection_manager.connect( source_id, *tgt_it, target_thread, synapse_model_, dummy_param_, d, w );
-          is_selected[ random_id ] = true;
+            // no kernel
+
+            // If multapses are not allowed, we must keep track of which
+            // sources have been selected already.
+            std::vector< bool > is_selected( positions->size() );
+
+            // Draw `number_of_connections_` sources
+            for ( int i = 0; i < ( int ) number_of_connections_; ++i )
+            {
+              index random_id = rng->ulrand( positions->size() );
+              if ( ( not allow_multapses_ ) and ( is_selected[ random_id ] ) )
+              {
+                --i;
+                continue;
+              }
+
+              index source_id = ( *positions )[ random_id ].second;
+              if ( ( not allow_autapses_ ) and ( source_id == target_id ) )
+              {
+                --i;
+                continue;
+              }
+
+              Position< D > source_pos = ( *positions )[ random_id ].first;
+              double w, d;
+              get_parameters_( source.compute_displacement( target_pos, source_pos ), rng, w, d );
+              kernel().connection_manager.connect(
+                source_id, *tgt_it, target_thread, synapse_model_, dummy_param_, d, w );
+              is_selected[ random_id ] = true;
+            }
+          }
         }
       }
+      catch ( std::exception& err )
+      {
+        // We must create a new exception here, err's lifetime ends at
+        // the end of the catch block.
+        exceptions_raised.at( thread_id ) = lockPTR< WrappedThreadException >( new WrappedThreadException( err ) );
+      }
+    } // omp parallel
+  }
+
+  // check if any exceptions have been raised
+  for ( thread tid = 0; tid < kernel().vp_manager.get_num_threads(); ++tid )
+  {
+    if ( exceptions_raised.at( tid ).valid() )
+    {
+      throw WrappedThreadException( *( exceptions_raised.at( tid ) ) );
     }
   }
 }
@@ -485,6 +485,15 @@ public:
    */
   typename Ntree< D, index >::masked_iterator begin( const Position< D >& anchor );
 
+  /**
+   * Iterate over nodes inside mask for several anchors at once. The
+   * positions are searched in a single pass for all anchors.
+   * @param anchors Positions to apply mask to
+   * @returns an iterator for the nodes inside the mask centered on each
+   * of the anchor positions
+   */
+  std::vector< typename Ntree< D, index >::masked_iterator > begin( const std::vector< Position< D > >& anchors );
+
   /**
    * @return end iterator
    */
@@ -569,6 +578,20 @@ MaskedLayer< D >::begin( const Position< D >& anchor )
   }
 }
 
+template < int D >
+inline std::vector< typename Ntree< D, index >::masked_iterator >
+MaskedLayer< D >::begin( const std::vector< Position< D > >& anchors )
+{
+  try
+  {
+    return ntree_->masked_begin( dynamic_cast< const Mask< D >& >( *mask_ ), anchors );
+  }
+  catch ( std::bad_cast& e )
+  {
+    throw BadProperty( "Mask is incompatible with layer." );
+  }
+}
+
 template < int D >
 inline typename Ntree< D, index >::masked_iterator
 MaskedLayer< D >::end()
@@ -134,6 +134,7 @@ Layer< D >::get_local_positions_ntree( Selector filter )
   lockPTR< Ntree< D, index > > ntree( new Ntree< D, index >( this->lower_left_, this->extent_, this->periodic_ ) );
 
   insert_local_positions_ntree_( *ntree, filter );
+  ntree->build();
 
   return ntree;
 }
@@ -209,6 +210,9 @@ Layer< D >::do_get_global_positions_ntree_( const Selector& filter )
     insert_global_positions_ntree_( *cached_ntree_, filter );
   }
 
+  // build before the tree is shared between threads
+  cached_ntree_->build();
+
   clear_vector_cache_();
 
   cached_ntree_layer_ = get_gid();
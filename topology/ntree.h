@@ -40,13 +40,23 @@ template < int D >
 class Mask;
 
 /**
- * A Ntree object represents a subtree or leaf in a Ntree structure. Any
- * ntree covers a specific region in space. A leaf ntree contains a list
- * of items and their corresponding positions. A branch ntree contains a
- * list of N=1<<D other ntrees, each covering a region corresponding to the
- * upper-left, lower-left, upper-right and lower-left corner of their
- * mother ntree.
+ * A Ntree is a quadtree (D=2) or octree (D=3) of items and their
+ * positions, used to find the items inside a mask. The region covered by
+ * the tree is split recursively into N=1<<D subregions, until a region
+ * contains at most max_capacity items or the depth of the region is
+ * max_depth.
  *
+ * The tree is stored in two flat arrays: the regions (cells), where the
+ * children of a cell are stored next to each other, and the items,
+ * ordered such that the items in each cell form a contiguous range.
+ * Subregions are numbered as in a Morton (Z-order) curve, bit i of the
+ * subregion number being set for the upper half of dimension i, and the
+ * items are ordered by the leaf they are in along this curve, and by
+ * the order of insertion within a leaf.
+ *
+ * Items are inserted into an unordered buffer. The tree is built when
+ * it is first iterated over after inserting, or by calling build(). A
+ * Ntree must be built before it is accessed by several threads at once.
  */
 template < int D, class T, int max_capacity = 100, int max_depth = 10 >
 class Ntree
@@ -60,6 +70,19 @@ public:
   typedef value_type& reference;
   typedef const value_type& const_reference;
 
+  /**
+   * A contiguous range of items found by a mask query. If the range is
+   * not known to be all inside the mask, each item must be tested
+   * against the mask centered on the given anchor.
+   */
+  struct masked_range
+  {
+    index first;
+    index last;
+    bool all_inside;
+    Position< D > anchor;
+  };
+
   /**
    * Iterator iterating the nodes in a Quadtree.
    */
@@ -71,23 +94,14 @@ public:
      */
     iterator()
       : ntree_( 0 )
-      , top_( 0 )
       , node_( 0 )
     {
     }
 
     /**
-     * Initialize an iterator to point to the first node in the first
-     * non-empty leaf within the tree below this Ntree.
-     */
-    iterator( Ntree& q );
-
-    /**
-     * Initialize an iterator to point to the nth node in this Ntree,
-     * which must be a leaf. The top of the tree is the first ancestor of
-     * the Ntree.
+     * Initialize an iterator to point to the nth node in the Ntree.
      */
-    iterator( Ntree& q, index n );
+    iterator( Ntree& q, index n = 0 );
 
     value_type& operator*()
     {
@@ -128,14 +142,7 @@ public:
     }
 
   protected:
-    /**
-     * Move to the next leaf quadrant, or set ntree_ to 0 if there are no
-     * more leaves.
-    */
-    void next_leaf_();
-
     Ntree* ntree_;
-    Ntree* top_;
     index node_;
   };
 
@@ -150,18 +157,18 @@ public:
      */
     masked_iterator()
       : ntree_( 0 )
-      , top_( 0 )
-      , allin_top_( 0 )
-      , node_( 0 )
       , mask_( 0 )
+      , ranges_()
+      , range_( 0 )
+      , node_( 0 )
     {
     }
 
     /**
-     * Initialize an iterator to point to the first leaf node inside the
-     * mask within the tree below this Ntree.
+     * Initialize an iterator to point to the first node inside the mask
+     * within the given ranges of the Ntree.
      */
-    masked_iterator( Ntree& q, const Mask< D >& mask, const Position< D >& anchor );
+    masked_iterator( Ntree& q, const Mask< D >& mask, const std::vector< masked_range >& ranges );
 
     value_type& operator*()
     {
@@ -204,40 +211,16 @@ public:
 
   protected:
     /**
-     * Initialize
-     */
-    void init_();
-
-    /**
-     * Find the next leaf which is not outside the mask.
-     */
-    void next_leaf_();
-
-    /**
-     * Find the first leaf which is not outside the mask. If no leaf is
-     * found below the current quadrant, will continue to next_leaf_().
-     */
-    void first_leaf_();
-
-    /**
-     * Set the allin_top_ to the current quadrant, and find the first
-     * leaf below the current quadrant.
+     * Move forward from the current node to the first node inside the
+     * mask, or mark the iterator as invalid if there is none.
      */
-    void first_leaf_inside_();
-
-    /**
-     * Go to the next anchor image.
-     */
-    void next_anchor_();
+    void skip_outside_();
 
     Ntree* ntree_;
-    Ntree* top_;
-    Ntree* allin_top_;
-    index node_;
     const Mask< D >* mask_;
-    Position< D > anchor_;
-    std::vector< Position< D > > anchors_;
-    index current_anchor_;
+    std::vector< masked_range > ranges_;
+    index range_;
+    index node_;
   };
 
   /**
@@ -246,20 +229,11 @@ public:
    * @param lower_left  Lower left corner of ntree.
    * @param extent      Size (width,height) of ntree.
    */
-  Ntree( const Position< D >& lower_left,
-    const Position< D >& extent,
-    std::bitset< D > periodic = 0,
-    Ntree* parent = 0,
-    int subquad = 0 );
-
-  /**
-   * Delete Ntree recursively.
-   */
-  ~Ntree();
+  Ntree( const Position< D >& lower_left, const Position< D >& extent, std::bitset< D > periodic = 0 );
 
   /**
-   * Traverse quadtree structure from current ntree.
-   * Inserts node in correct leaf in quadtree.
+   * Insert node into the ntree. The ntree must be built again before it
+   * is iterated over.
    * @returns iterator pointing to inserted node.
    */
   iterator insert( Position< D > pos, const T& node );
@@ -274,6 +248,11 @@ public:
    */
   iterator insert( iterator, const value_type& val );
 
+  /**
+   * Sort the nodes inserted so far into the tree.
+   */
+  void build();
+
   /**
    * @returns member nodes in ntree and their position.
    */
@@ -288,15 +267,11 @@ public:
   std::vector< value_type > get_nodes( const Mask< D >& mask, const Position< D >& anchor );
 
   /**
-   * This function returns a node iterator which will traverse the
-   * subtree below this Ntree.
+   * This function returns a node iterator which will traverse all nodes
+   * in the Ntree.
    * @returns iterator for nodes in quadtree.
    */
-  iterator
-  begin()
-  {
-    return iterator( *this );
-  }
+  iterator begin();
 
   iterator
   end()
@@ -306,14 +281,18 @@ public:
 
   /**
    * This function returns a masked node iterator which will traverse the
-   * subtree below this Ntree, skipping nodes outside the mask.
+   * Ntree, skipping nodes outside the mask.
    * @returns iterator for nodes in quadtree.
    */
-  masked_iterator
-  masked_begin( const Mask< D >& mask, const Position< D >& anchor )
-  {
-    return masked_iterator( *this, mask, anchor );
-  }
+  masked_iterator masked_begin( const Mask< D >& mask, const Position< D >& anchor );
+
+  /**
+   * Apply the mask centered on each of the given anchors. The tree is
+   * traversed once for all anchors, which is faster than separate
+   * traversals for each anchor if the anchors are close to each other.
+   * @returns one masked node iterator per anchor.
+   */
+  std::vector< masked_iterator > masked_begin( const Mask< D >& mask, const std::vector< Position< D > >& anchors );
 
   masked_iterator
   masked_end()
@@ -321,45 +300,69 @@ public:
     return masked_iterator();
   }
 
+protected:
   /**
-   * @returns true if ntree is a leaf.
+   * A region of the Ntree. The nodes in the region are the nodes with
+   * indices [first, last). The N subregions of a region which is not a
+   * leaf are stored at indices [children, children + N) in cells_.
    */
-  bool is_leaf() const;
+  struct Cell_
+  {
+    Position< D > lower_left;
+    Position< D > extent;
+    index first;
+    index last;
+    index children; //!< 0 for leaf cells
+  };
+
+  /**
+   * Split the cell if it contains too many nodes and sort its nodes into
+   * the subregions, recursively.
+   */
+  void build_cell_( const index cell, const int depth, std::vector< value_type >& buffer );
 
-protected:
   /**
-   * Change a leaf ntree to a regular ntree with four
-   * children regions.
+   * @returns the subquad number for this position within the cell
    */
-  void split_();
+  int subquad_( const Cell_& cell, const Position< D >& pos ) const;
 
   /**
-   * Append this ntree's nodes to the vector
+   * Compute the positions to which the mask is applied for the given
+   * anchor: one position if the ntree is not periodic, otherwise the
+   * anchor moved into the ntree and its images across the periodic
+   * boundaries that the mask overlaps.
    */
-  void append_nodes_( std::vector< value_type >& );
+  void add_anchor_images_( const Mask< D >& mask,
+    const Position< D >& anchor,
+    std::vector< Position< D > >& images ) const;
 
   /**
-   * Append this ntree's nodes inside the mask to the vector
+   * Append the ranges of nodes inside the cell which may be inside the
+   * mask to ranges[a] for each of the anchors[a] for which the cell is
+   * partially inside the mask, as listed in active[depth].
    */
-  void append_nodes_( std::vector< value_type >&, const Mask< D >&, const Position< D >& );
+  void find_ranges_( const index cell,
+    const int depth,
+    const Mask< D >& mask,
+    const std::vector< Position< D > >& anchors,
+    std::vector< std::vector< index > >& active,
+    std::vector< std::vector< masked_range > >& ranges ) const;
 
   /**
-   * @returns the subquad number for this position
+   * Append the range of all nodes in the cell to ranges, if not empty.
    */
-  int subquad_( const Position< D >& );
+  void add_range_( const Cell_& cell,
+    const bool all_inside,
+    const Position< D >& anchor,
+    std::vector< masked_range >& ranges ) const;
 
   Position< D > lower_left_;
   Position< D > extent_;
-
-  bool leaf_;
+  std::bitset< D > periodic_; ///< periodic b.c.
 
   std::vector< value_type > nodes_;
-
-  Ntree* parent_;
-  int my_subquad_; ///< This Ntree's subquad number within parent
-  int my_depth_;   ///< This Ntree's depth in the tree
-  Ntree* children_[ N ];
-  std::bitset< D > periodic_; ///< periodic b.c.
+  std::vector< Cell_ > cells_;
+  bool built_; ///< false if nodes have been inserted since the last build
 
   friend class iterator;
   friend class masked_iterator;
@@ -368,63 +371,55 @@ protected:
 template < int D, class T, int max_capacity, int max_depth >
 Ntree< D, T, max_capacity, max_depth >::Ntree( const Position< D >& lower_left,
   const Position< D >& extent,
-  std::bitset< D > periodic,
-  Ntree< D, T, max_capacity, max_depth >* parent,
-  int subquad )
+  std::bitset< D > periodic )
   : lower_left_( lower_left )
   , extent_( extent )
-  , leaf_( true )
-  , parent_( parent )
-  , my_subquad_( subquad )
-  , my_depth_( parent ? parent->my_depth_ + 1 : 0 )
   , periodic_( periodic )
+  , nodes_()
+  , cells_()
+  , built_( false )
 {
 }
 
 template < int D, class T, int max_capacity, int max_depth >
-Ntree< D, T, max_capacity, max_depth >::~Ntree()
+Ntree< D, T, max_capacity, max_depth >::iterator::iterator( Ntree& q, index n )
+  : ntree_( &q )
+  , node_( n )
 {
-  if ( leaf_ )
+  if ( node_ >= ntree_->nodes_.size() )
   {
-    return;
-  } // if T is a vector class, we do not delete the pointees
-
-  for ( size_t n = 0; n < static_cast< size_t >( N ); ++n )
-  {
-    delete children_[ n ]; // calls destructor in child, thus recursing
+    ntree_ = 0;
+    node_ = 0;
   }
 }
 
 template < int D, class T, int max_capacity, int max_depth >
-Ntree< D, T, max_capacity, max_depth >::iterator::iterator( Ntree& q, index n )
-  : ntree_( &q )
-  , top_( &q )
-  , node_( n )
+typename Ntree< D, T, max_capacity, max_depth >::iterator& Ntree< D, T, max_capacity, max_depth >::iterator::
+operator++()
 {
-  assert( ntree_->leaf_ );
-
-  // First ancestor
-  while ( top_->parent_ )
+  ++node_;
+  if ( node_ >= ntree_->nodes_.size() )
   {
-    top_ = top_->parent_;
+    ntree_ = 0;
+    node_ = 0;
   }
+  return *this;
 }
 
 template < int D, class T, int max_capacity, int max_depth >
-bool
-Ntree< D, T, max_capacity, max_depth >::is_leaf() const
+typename Ntree< D, T, max_capacity, max_depth >::iterator
+Ntree< D, T, max_capacity, max_depth >::begin()
 {
-  return leaf_;
+  build();
+  return iterator( *this );
 }
 
-
 template < int D, class T, int max_capacity, int max_depth >
 std::vector< std::pair< Position< D >, T > >
 Ntree< D, T, max_capacity, max_depth >::get_nodes()
 {
-  std::vector< std::pair< Position< D >, T > > result;
-  append_nodes_( result );
-  return result;
+  build();
+  return nodes_;
 }
 
 template < int D, class T, int max_capacity, int max_depth >
@@ -432,7 +427,10 @@ std::vector< std::pair< Position< D >, T > >
 Ntree< D, T, max_capacity, max_depth >::get_nodes( const Mask< D >& mask, const Position< D >& anchor )
 {
   std::vector< std::pair< Position< D >, T > > result;
-  append_nodes_( result, mask, anchor );
+  for ( masked_iterator it = masked_begin( mask, anchor ); it != masked_end(); ++it )
+  {
+    result.push_back( *it );
+  }
   return result;
 }
 
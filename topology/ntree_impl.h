@@ -31,81 +31,6 @@
 namespace nest
 {
 
-template < int D, class T, int max_capacity, int max_depth >
-Ntree< D, T, max_capacity, max_depth >::iterator::iterator( Ntree& q )
-  : ntree_( &q )
-  , top_( &q )
-  , node_( 0 )
-{
-  // First leaf
-  while ( not ntree_->is_leaf() )
-  {
-    ntree_ = ntree_->children_[ 0 ];
-  }
-  // Find the first non-empty leaf
-  while ( ntree_->nodes_.empty() )
-  {
-
-    next_leaf_();
-    if ( ntree_ == 0 )
-    {
-      break;
-    }
-  }
-}
-
-template < int D, class T, int max_capacity, int max_depth >
-typename Ntree< D, T, max_capacity, max_depth >::iterator& Ntree< D, T, max_capacity, max_depth >::iterator::
-operator++()
-{
-  node_++;
-
-  while ( node_ >= ntree_->nodes_.size() )
-  {
-
-    next_leaf_();
-
-    node_ = 0;
-    if ( ntree_ == 0 )
-    {
-      break;
-    }
-  }
-
-  return *this;
-}
-
-template < int D, class T, int max_capacity, int max_depth >
-void
-Ntree< D, T, max_capacity, max_depth >::iterator::next_leaf_()
-{
-
-  // If we are on the last subntree, move up
-  while ( ntree_ && ( ntree_ != top_ ) && ( ntree_->my_subquad_ == N - 1 ) )
-  {
-    ntree_ = ntree_->parent_;
-  }
-
-  // Since we stop at the top, this should never happen!
-  assert( ntree_ != 0 );
-
-  // If we have reached the top, mark as invalid and return
-  if ( ntree_ == top_ )
-  {
-    ntree_ = 0;
-    return;
-  }
-
-  // Move to next sibling
-  ntree_ = ntree_->parent_->children_[ ntree_->my_subquad_ + 1 ];
-
-  // Move down if this is not a leaf.
-  while ( not ntree_->is_leaf() )
-  {
-    ntree_ = ntree_->children_[ 0 ];
-  }
-}
-
 // Proper mod which returns non-negative numbers
 static inline double
 mod( double x, double p )
@@ -121,328 +46,260 @@ mod( double x, double p )
 template < int D, class T, int max_capacity, int max_depth >
 Ntree< D, T, max_capacity, max_depth >::masked_iterator::masked_iterator( Ntree< D, T, max_capacity, max_depth >& q,
   const Mask< D >& mask,
-  const Position< D >& anchor )
+  const std::vector< masked_range >& ranges )
   : ntree_( &q )
-  , top_( &q )
-  , allin_top_( 0 )
-  , node_( 0 )
   , mask_( &mask )
-  , anchor_( anchor )
-  , anchors_()
-  , current_anchor_( 0 )
+  , ranges_( ranges )
+  , range_( 0 )
+  , node_( 0 )
 {
-  if ( ntree_->periodic_.any() )
+  if ( not ranges_.empty() )
   {
-    Box< D > mask_bb = mask_->get_bbox();
+    node_ = ranges_[ 0 ].first;
+  }
+  skip_outside_();
+}
 
-    // Move lower left corner of mask into main image of layer
-    for ( int i = 0; i < D; ++i )
+template < int D, class T, int max_capacity, int max_depth >
+void
+Ntree< D, T, max_capacity, max_depth >::masked_iterator::skip_outside_()
+{
+  while ( range_ < ranges_.size() )
+  {
+    const masked_range& range = ranges_[ range_ ];
+    if ( range.all_inside )
     {
-      if ( ntree_->periodic_[ i ] )
+      if ( node_ < range.last )
       {
-        anchor_[ i ] = nest::mod( anchor_[ i ] + mask_bb.lower_left[ i ] - ntree_->lower_left_[ i ],
-                         ntree_->extent_[ i ] ) - mask_bb.lower_left[ i ] + ntree_->lower_left_[ i ];
+        return;
       }
     }
-    anchors_.push_back( anchor_ );
-
-    // Add extra anchors for each dimension where this is needed
-    // (Assumes that the mask is not wider than the layer)
-    for ( int i = 0; i < D; ++i )
+    else
     {
-      if ( ntree_->periodic_[ i ] )
+      for ( ; node_ < range.last; ++node_ )
       {
-        int n = anchors_.size();
-        if ( ( anchor_[ i ] + mask_bb.upper_right[ i ] - ntree_->lower_left_[ i ] ) > ntree_->extent_[ i ] )
+        if ( mask_->inside( ntree_->nodes_[ node_ ].first - range.anchor ) )
         {
-          for ( int j = 0; j < n; ++j )
-          {
-            Position< D > p = anchors_[ j ];
-            p[ i ] -= ntree_->extent_[ i ];
-            anchors_.push_back( p );
-          }
+          return;
         }
       }
     }
-    /*
-          for(int i=0;i<anchors_.size();++i) {
-            std::cout << anchors_[i] << std::endl;
-          }
-          std::cout << "---" << std::endl;
-    */
+
+    ++range_;
+    if ( range_ < ranges_.size() )
+    {
+      node_ = ranges_[ range_ ].first;
+    }
   }
 
-  init_();
+  // Done. Mark as invalid.
+  ntree_ = 0;
+  node_ = 0;
 }
 
 template < int D, class T, int max_capacity, int max_depth >
-void
-Ntree< D, T, max_capacity, max_depth >::masked_iterator::init_()
+typename Ntree< D, T, max_capacity, max_depth >::masked_iterator&
+  Ntree< D, T, max_capacity, max_depth >::masked_iterator::
+  operator++()
 {
-  node_ = 0;
-  allin_top_ = 0;
-  ntree_ = top_;
-
-  if ( mask_->outside( Box< D >( ntree_->lower_left_ - anchor_, ntree_->lower_left_ - anchor_ + ntree_->extent_ ) ) )
-  {
-
-    next_anchor_();
-  }
-  else
-  {
-
-    if ( mask_->inside( Box< D >( ntree_->lower_left_ - anchor_, ntree_->lower_left_ - anchor_ + ntree_->extent_ ) ) )
-    {
-      first_leaf_inside_();
-    }
-    else
-    {
-      first_leaf_();
-    }
-
-    if ( ntree_->nodes_.empty() || ( not mask_->inside( ntree_->nodes_[ node_ ].first - anchor_ ) ) )
-    {
-      ++( *this );
-    }
-  }
+  ++node_;
+  skip_outside_();
+  return *this;
 }
 
 template < int D, class T, int max_capacity, int max_depth >
-void
-Ntree< D, T, max_capacity, max_depth >::masked_iterator::next_anchor_()
+typename Ntree< D, T, max_capacity, max_depth >::masked_iterator
+Ntree< D, T, max_capacity, max_depth >::masked_begin( const Mask< D >& mask, const Position< D >& anchor )
 {
-  ++current_anchor_;
-  if ( current_anchor_ >= anchors_.size() )
-  {
-    // Done. Mark as invalid.
-    ntree_ = 0;
-    node_ = 0;
-  }
-  else
-  {
-    anchor_ = anchors_[ current_anchor_ ];
-    init_();
-  }
+  return masked_begin( mask, std::vector< Position< D > >( 1, anchor ) )[ 0 ];
 }
 
 template < int D, class T, int max_capacity, int max_depth >
-void
-Ntree< D, T, max_capacity, max_depth >::masked_iterator::next_leaf_()
+std::vector< typename Ntree< D, T, max_capacity, max_depth >::masked_iterator >
+Ntree< D, T, max_capacity, max_depth >::masked_begin( const Mask< D >& mask,
+  const std::vector< Position< D > >& anchors )
 {
+  build();
 
-  // There are two states: the initial state, and "all in". In the
-  // all in state, we are in a subtree which is completely inside
-  // the mask. The allin_top_ is the top of this subtree. When
-  // exiting the subtree, the state changes to the initial
-  // state. In the initial state, we must check each quadrant to
-  // see if it is completely inside or outside the mask. If inside,
-  // we go all in. If outside, we move on to the next leaf. If
-  // neither, keep going until we find a leaf. Upon exiting from
-  // this function, we are either done (ntree_==0), or on a leaf
-  // node which at least intersects with the mask. If allin_top_!=0,
-  // the leaf is completely inside the mask.
-
-  if ( allin_top_ )
+  // Apply the mask to all images of all anchors in one traversal
+  std::vector< Position< D > > images;
+  std::vector< index > first_image( anchors.size() + 1, 0 );
+  for ( index a = 0; a < anchors.size(); ++a )
   {
-    // state: all in
-
-    // If we are on the last subtree, move up
-    while ( ntree_ && ( ntree_ != allin_top_ ) && ( ntree_->my_subquad_ == N - 1 ) )
-    {
-      ntree_ = ntree_->parent_;
-    }
-
-    // Since we stop at the top, this should never happen!
-    assert( ntree_ != 0 );
-
-    // If we reached the allin_top_, we are no longer all in.
-    if ( ntree_ != allin_top_ )
-    {
-
-      // Move to next sibling
-      ntree_ = ntree_->parent_->children_[ ntree_->my_subquad_ + 1 ];
-
-      // Move down if this is not a leaf.
-      while ( not ntree_->is_leaf() )
-      {
-        ntree_ = ntree_->children_[ 0 ];
-      }
-      return;
-    }
-
-    allin_top_ = 0;
-    // Will continue as not all in.
+    add_anchor_images_( mask, anchors[ a ], images );
+    first_image[ a + 1 ] = images.size();
   }
 
-  // state: Not all in
+  std::vector< std::vector< masked_range > > image_ranges( images.size() );
+  std::vector< std::vector< index > > active( max_depth + 2 );
 
-  do
+  // The whole tree is tested against the mask before its subregions
+  const Cell_& root = cells_[ 0 ];
+  for ( index i = 0; i < images.size(); ++i )
   {
-
-    // If we are on the last subtree, move up
-    while ( ntree_ && ( ntree_ != top_ ) && ( ntree_->my_subquad_ == N - 1 ) )
+    const Box< D > box( root.lower_left - images[ i ], root.lower_left - images[ i ] + root.extent );
+    if ( mask.outside( box ) )
     {
-      ntree_ = ntree_->parent_;
+      continue;
     }
-
-    // Since we stop at the top, this should never happen!
-    assert( ntree_ != 0 );
-
-    // If we have reached the top, mark as invalid and return
-    if ( ntree_ == top_ )
+    if ( mask.inside( box ) )
     {
-      return next_anchor_();
+      add_range_( root, true, images[ i ], image_ranges[ i ] );
     }
-
-    // Move to next sibling
-    ntree_ = ntree_->parent_->children_[ ntree_->my_subquad_ + 1 ];
-
-    if ( mask_->inside( Box< D >( ntree_->lower_left_ - anchor_, ntree_->lower_left_ - anchor_ + ntree_->extent_ ) ) )
+    else
     {
-      return first_leaf_inside_();
+      active[ 0 ].push_back( i );
     }
+  }
+  if ( not active[ 0 ].empty() )
+  {
+    find_ranges_( 0, 0, mask, images, active, image_ranges );
+  }
 
-  } while (
-    mask_->outside( Box< D >( ntree_->lower_left_ - anchor_, ntree_->lower_left_ - anchor_ + ntree_->extent_ ) ) );
-
-  return first_leaf_();
+  // Nodes found for the images of an anchor are visited in the order of
+  // the images
+  std::vector< masked_iterator > iterators;
+  iterators.reserve( anchors.size() );
+  for ( index a = 0; a < anchors.size(); ++a )
+  {
+    std::vector< masked_range > ranges;
+    for ( index i = first_image[ a ]; i < first_image[ a + 1 ]; ++i )
+    {
+      ranges.insert( ranges.end(), image_ranges[ i ].begin(), image_ranges[ i ].end() );
+    }
+    iterators.push_back( masked_iterator( *this, mask, ranges ) );
+  }
+  return iterators;
 }
 
 template < int D, class T, int max_capacity, int max_depth >
 void
-Ntree< D, T, max_capacity, max_depth >::masked_iterator::first_leaf_()
+Ntree< D, T, max_capacity, max_depth >::add_anchor_images_( const Mask< D >& mask,
+  const Position< D >& anchor,
+  std::vector< Position< D > >& images ) const
 {
-  while ( not ntree_->is_leaf() )
+  if ( not periodic_.any() )
   {
+    images.push_back( anchor );
+    return;
+  }
 
-    ntree_ = ntree_->children_[ 0 ];
+  Box< D > mask_bb = mask.get_bbox();
+  Position< D > main_anchor = anchor;
 
-    if ( mask_->inside( Box< D >( ntree_->lower_left_ - anchor_, ntree_->lower_left_ - anchor_ + ntree_->extent_ ) ) )
+  // Move lower left corner of mask into main image of layer
+  for ( int i = 0; i < D; ++i )
+  {
+    if ( periodic_[ i ] )
     {
-      return first_leaf_inside_();
+      main_anchor[ i ] = nest::mod( main_anchor[ i ] + mask_bb.lower_left[ i ] - lower_left_[ i ], extent_[ i ] )
+        - mask_bb.lower_left[ i ] + lower_left_[ i ];
     }
+  }
+  const index first = images.size();
+  images.push_back( main_anchor );
 
-    if ( mask_->outside( Box< D >( ntree_->lower_left_ - anchor_, ntree_->lower_left_ - anchor_ + ntree_->extent_ ) ) )
+  // Add extra anchors for each dimension where this is needed
+  // (Assumes that the mask is not wider than the layer)
+  for ( int i = 0; i < D; ++i )
+  {
+    if ( periodic_[ i ] )
     {
-      return next_leaf_();
+      const index n = images.size();
+      if ( ( main_anchor[ i ] + mask_bb.upper_right[ i ] - lower_left_[ i ] ) > extent_[ i ] )
+      {
+        for ( index j = first; j < n; ++j )
+        {
+          Position< D > p = images[ j ];
+          p[ i ] -= extent_[ i ];
+          images.push_back( p );
+        }
+      }
     }
   }
 }
 
-
 template < int D, class T, int max_capacity, int max_depth >
 void
-Ntree< D, T, max_capacity, max_depth >::masked_iterator::first_leaf_inside_()
-{
-
-  allin_top_ = ntree_;
-
-  while ( not ntree_->is_leaf() )
-  {
-    ntree_ = ntree_->children_[ 0 ];
-  }
-}
-
-template < int D, class T, int max_capacity, int max_depth >
-typename Ntree< D, T, max_capacity, max_depth >::masked_iterator&
-  Ntree< D, T, max_capacity, max_depth >::masked_iterator::
-  operator++()
+Ntree< D, T, max_capacity, max_depth >::find_ranges_( const index cell,
+  const int depth,
+  const Mask< D >& mask,
+  const std::vector< Position< D > >& anchors,
+  std::vector< std::vector< index > >& active,
+  std::vector< std::vector< masked_range > >& ranges ) const
 {
-  node_++;
+  const Cell_& c = cells_[ cell ];
 
-  if ( allin_top_ == 0 )
+  if ( c.children == 0 )
   {
-    while ( ( node_ < ntree_->nodes_.size() ) && ( not mask_->inside( ntree_->nodes_[ node_ ].first - anchor_ ) ) )
+    // Leaf intersecting the mask: each node has to be tested
+    for ( index k = 0; k < active[ depth ].size(); ++k )
     {
-      node_++;
+      const index a = active[ depth ][ k ];
+      add_range_( c, false, anchors[ a ], ranges[ a ] );
     }
+    return;
   }
 
-  while ( node_ >= ntree_->nodes_.size() )
+  // Visit the subregions in order, so that the ranges for each anchor
+  // are in the order of the nodes
+  for ( index j = 0; j < static_cast< index >( N ); ++j )
   {
+    const Cell_& child = cells_[ c.children + j ];
+    active[ depth + 1 ].clear();
 
-    next_leaf_();
-
-    node_ = 0;
-    if ( ntree_ == 0 )
+    for ( index k = 0; k < active[ depth ].size(); ++k )
     {
-      break;
-    }
-
-    if ( allin_top_ == 0 )
-    {
-      while ( ( node_ < ntree_->nodes_.size() ) && ( not mask_->inside( ntree_->nodes_[ node_ ].first - anchor_ ) ) )
+      const index a = active[ depth ][ k ];
+      const Box< D > box( child.lower_left - anchors[ a ], child.lower_left - anchors[ a ] + child.extent );
+      if ( mask.inside( box ) )
+      {
+        add_range_( child, true, anchors[ a ], ranges[ a ] );
+      }
+      else if ( not mask.outside( box ) )
       {
-        node_++;
+        active[ depth + 1 ].push_back( a );
       }
     }
-  }
-
-  return *this;
-}
 
-template < int D, class T, int max_capacity, int max_depth >
-int
-Ntree< D, T, max_capacity, max_depth >::subquad_( const Position< D >& pos )
-{
-  int r = 0;
-  for ( int i = 0; i < D; ++i )
-  {
-    r += ( 1 << i ) * ( pos[ i ] < lower_left_[ i ] + extent_[ i ] / 2 ? 0 : 1 );
+    if ( not active[ depth + 1 ].empty() )
+    {
+      find_ranges_( c.children + j, depth + 1, mask, anchors, active, ranges );
+    }
   }
-
-  return r;
 }
 
 template < int D, class T, int max_capacity, int max_depth >
 void
-Ntree< D, T, max_capacity, max_depth >::append_nodes_( std::vector< std::pair< Position< D >, T > >& v )
+Ntree< D, T, max_capacity, max_depth >::add_range_( const Cell_& cell,
+  const bool all_inside,
+  const Position< D >& anchor,
+  std::vector< masked_range >& ranges ) const
 {
-  if ( leaf_ )
-  {
-    std::copy( nodes_.begin(), nodes_.end(), std::back_inserter( v ) );
-  }
-  else
+  if ( cell.first == cell.last )
   {
-    for ( int i = 0; i < N; ++i )
-    {
-      children_[ i ]->append_nodes_( v );
-    }
+    return;
   }
+
+  masked_range range;
+  range.first = cell.first;
+  range.last = cell.last;
+  range.all_inside = all_inside;
+  range.anchor = anchor;
+  ranges.push_back( range );
 }
 
 template < int D, class T, int max_capacity, int max_depth >
-void
-Ntree< D, T, max_capacity, max_depth >::append_nodes_( std::vector< std::pair< Position< D >, T > >& v,
-  const Mask< D >& mask,
-  const Position< D >& anchor )
+int
+Ntree< D, T, max_capacity, max_depth >::subquad_( const Cell_& cell, const Position< D >& pos ) const
 {
-  if ( mask.outside( Box< D >( lower_left_ - anchor, lower_left_ - anchor + extent_ ) ) )
-  {
-    return;
-  }
-  if ( mask.inside( Box< D >( lower_left_ - anchor, lower_left_ - anchor + extent_ ) ) )
+  int r = 0;
+  for ( int i = 0; i < D; ++i )
   {
-    return append_nodes_( v );
+    r += ( 1 << i ) * ( pos[ i ] < cell.lower_left[ i ] + cell.extent[ i ] / 2 ? 0 : 1 );
   }
-  if ( leaf_ )
-  {
 
-    for ( typename std::vector< std::pair< Position< D >, T > >::iterator i = nodes_.begin(); i != nodes_.end(); ++i )
-    {
-      if ( mask.inside( i->first - anchor ) )
-      {
-        v.push_back( *i );
-      }
-    }
-  }
-  else
-  {
-    for ( int i = 0; i < N; ++i )
-    {
-      children_[ i ]->append_nodes_( v, mask, anchor );
-    }
-  }
+  return r;
 }
 
 template < int D, class T, int max_capacity, int max_depth >
@@ -468,55 +325,107 @@ Ntree< D, T, max_capacity, max_depth >::insert( Position< D > pos, const T& node
     }
   }
 
-  if ( leaf_ && ( nodes_.size() >= max_capacity ) && ( my_depth_ < max_depth ) )
+  assert( ( pos >= lower_left_ ) && ( pos < lower_left_ + extent_ ) );
+
+  nodes_.push_back( std::pair< Position< D >, T >( pos, node ) );
+  built_ = false;
+
+  return iterator( *this, nodes_.size() - 1 );
+}
+
+template < int D, class T, int max_capacity, int max_depth >
+void
+Ntree< D, T, max_capacity, max_depth >::build()
+{
+  if ( built_ )
   {
-    split_();
+    return;
   }
-  if ( leaf_ )
-  {
 
-    assert( ( pos >= lower_left_ ) && ( pos < lower_left_ + extent_ ) );
+  cells_.clear();
 
-    nodes_.push_back( std::pair< Position< D >, T >( pos, node ) );
+  Cell_ root;
+  root.lower_left = lower_left_;
+  root.extent = extent_;
+  root.first = 0;
+  root.last = nodes_.size();
+  root.children = 0;
+  cells_.push_back( root );
 
-    return iterator( *this, nodes_.size() - 1 );
-  }
-  else
-  {
+  std::vector< value_type > buffer;
+  build_cell_( 0, 0, buffer );
 
-    return children_[ subquad_( pos ) ]->insert( pos, node );
-  }
+  built_ = true;
 }
 
 template < int D, class T, int max_capacity, int max_depth >
 void
-Ntree< D, T, max_capacity, max_depth >::split_()
+Ntree< D, T, max_capacity, max_depth >::build_cell_( const index cell,
+  const int depth,
+  std::vector< value_type >& buffer )
 {
-  assert( leaf_ );
+  const index first = cells_[ cell ].first;
+  const index last = cells_[ cell ].last;
+
+  // A region is split when it receives more than max_capacity nodes
+  if ( ( last - first <= static_cast< index >( max_capacity ) ) or ( depth >= max_depth ) )
+  {
+    return;
+  }
+
+  const index children = cells_.size();
+  cells_[ cell ].children = children;
 
   for ( int j = 0; j < N; ++j )
   {
-    Position< D > lower_left = lower_left_;
+    Cell_ child = Cell_();
+    child.lower_left = cells_[ cell ].lower_left;
     for ( int i = 0; i < D; ++i )
     {
       if ( j & ( 1 << i ) )
       {
-        lower_left[ i ] += extent_[ i ] * 0.5;
+        child.lower_left[ i ] += cells_[ cell ].extent[ i ] * 0.5;
       }
     }
+    child.extent = cells_[ cell ].extent * 0.5;
+    child.children = 0;
+    cells_.push_back( child );
+  }
 
-    children_[ j ] = new Ntree< D, T, max_capacity, max_depth >( lower_left, extent_ * 0.5, 0, this, j );
+  // Stable counting sort of the nodes into the subregions, which keeps
+  // the order of insertion within each subregion
+  std::vector< int > subquad( last - first );
+  index count[ N + 1 ] = {};
+  for ( index k = first; k < last; ++k )
+  {
+    subquad[ k - first ] = subquad_( cells_[ cell ], nodes_[ k ].first );
+    ++count[ subquad[ k - first ] + 1 ];
   }
 
-  for ( typename std::vector< std::pair< Position< D >, T > >::iterator i = nodes_.begin(); i != nodes_.end(); ++i )
+  index offset[ N ];
+  offset[ 0 ] = first;
+  for ( int j = 0; j < N; ++j )
   {
-    children_[ subquad_( i->first ) ]->insert( i->first, i->second );
+    cells_[ children + j ].first = offset[ j ];
+    cells_[ children + j ].last = offset[ j ] + count[ j + 1 ];
+    if ( j + 1 < N )
+    {
+      offset[ j + 1 ] = cells_[ children + j ].last;
+    }
   }
 
-  nodes_.clear();
+  buffer.assign( nodes_.begin() + first, nodes_.begin() + last );
+  for ( index k = 0; k < buffer.size(); ++k )
+  {
+    nodes_[ offset[ subquad[ k ] ]++ ] = buffer[ k ];
+  }
 
-  leaf_ = false;
-}
+  for ( int j = 0; j < N; ++j )
+  {
+    build_cell_( children + j, depth + 1, buffer );
+  }
 }
 
+} // namespace nest
+
 #endif